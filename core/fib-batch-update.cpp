@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fib-batch-update.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/encoding/tlv-nfd.hpp>
+#include <ndn-cxx/util/concepts.hpp>
+
+namespace nfd {
+
+BOOST_CONCEPT_ASSERT((ndn::WireEncodable<FibBatchUpdate>));
+BOOST_CONCEPT_ASSERT((ndn::WireDecodable<FibBatchUpdate>));
+
+FibBatchUpdate::FibBatchUpdate()
+{
+}
+
+FibBatchUpdate::FibBatchUpdate(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+FibBatchUpdate&
+FibBatchUpdate::addAddNextHop(const Name& name, uint64_t faceId, uint64_t cost)
+{
+  m_entries.push_back({ADD_NEXTHOP, name, faceId, cost});
+  m_wire.reset();
+  return *this;
+}
+
+FibBatchUpdate&
+FibBatchUpdate::addRemoveNextHop(const Name& name, uint64_t faceId)
+{
+  m_entries.push_back({REMOVE_NEXTHOP, name, faceId, 0});
+  m_wire.reset();
+  return *this;
+}
+
+template<ndn::encoding::Tag TAG>
+size_t
+FibBatchUpdate::encodeEntry(ndn::EncodingImpl<TAG>& encoder, const Entry& entry)
+{
+  size_t totalLength = 0;
+
+  if (entry.action == ADD_NEXTHOP) {
+    totalLength += ndn::prependNonNegativeIntegerBlock(encoder, tlv::nfd::Cost, entry.cost);
+  }
+  totalLength += ndn::prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId, entry.faceId);
+  totalLength += entry.name.wireEncode(encoder);
+  totalLength += ndn::prependNonNegativeIntegerBlock(encoder, tlv::FibBatchUpdateAction, entry.action);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::FibBatchUpdateEntry);
+  return totalLength;
+}
+
+template<ndn::encoding::Tag TAG>
+size_t
+FibBatchUpdate::wireEncode(ndn::EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++it) {
+    totalLength += encodeEntry(encoder, *it);
+  }
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::FibBatchUpdate);
+  return totalLength;
+}
+
+template size_t
+FibBatchUpdate::wireEncode<ndn::encoding::EncoderTag>(ndn::EncodingImpl<ndn::encoding::EncoderTag>&) const;
+
+template size_t
+FibBatchUpdate::wireEncode<ndn::encoding::EstimatorTag>(ndn::EncodingImpl<ndn::encoding::EstimatorTag>&) const;
+
+Block
+FibBatchUpdate::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  ndn::EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  ndn::EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+FibBatchUpdate::wireDecode(const Block& wire)
+{
+  if (wire.type() != tlv::FibBatchUpdate) {
+    BOOST_THROW_EXCEPTION(Error("expecting FibBatchUpdate block"));
+  }
+
+  m_wire = wire;
+  m_wire.parse();
+  m_entries.clear();
+
+  for (const Block& element : m_wire.elements()) {
+    if (element.type() != tlv::FibBatchUpdateEntry) {
+      BOOST_THROW_EXCEPTION(Error("expecting FibBatchUpdateEntry block"));
+    }
+    element.parse();
+
+    Entry entry;
+    Block::element_const_iterator val = element.elements_begin();
+
+    if (val == element.elements_end() || val->type() != tlv::FibBatchUpdateAction) {
+      BOOST_THROW_EXCEPTION(Error("missing required FibBatchUpdateAction field"));
+    }
+    uint64_t action = ndn::readNonNegativeInteger(*val);
+    if (action != ADD_NEXTHOP && action != REMOVE_NEXTHOP) {
+      BOOST_THROW_EXCEPTION(Error("unknown FibBatchUpdateAction " + to_string(action)));
+    }
+    entry.action = static_cast<Action>(action);
+    ++val;
+
+    if (val == element.elements_end() || val->type() != tlv::Name) {
+      BOOST_THROW_EXCEPTION(Error("missing required Name field"));
+    }
+    entry.name.wireDecode(*val);
+    ++val;
+
+    if (val == element.elements_end() || val->type() != tlv::nfd::FaceId) {
+      BOOST_THROW_EXCEPTION(Error("missing required FaceId field"));
+    }
+    entry.faceId = ndn::readNonNegativeInteger(*val);
+    ++val;
+
+    entry.cost = 0;
+    if (entry.action == ADD_NEXTHOP) {
+      if (val == element.elements_end() || val->type() != tlv::nfd::Cost) {
+        BOOST_THROW_EXCEPTION(Error("missing required Cost field"));
+      }
+      entry.cost = ndn::readNonNegativeInteger(*val);
+      ++val;
+    }
+
+    m_entries.push_back(entry);
+  }
+}
+
+size_t
+FibBatchUpdate::getEntryWireSize(const Entry& entry)
+{
+  ndn::EncodingEstimator estimator;
+  return encodeEntry(estimator, entry);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const FibBatchUpdate::Entry& entry)
+{
+  os << (entry.action == FibBatchUpdate::ADD_NEXTHOP ? "add-nexthop" : "remove-nexthop")
+     << " " << entry.name << " faceid=" << entry.faceId;
+  if (entry.action == FibBatchUpdate::ADD_NEXTHOP) {
+    os << " cost=" << entry.cost;
+  }
+  return os;
+}
+
+} // namespace nfd
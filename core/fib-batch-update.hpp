@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_CORE_FIB_BATCH_UPDATE_HPP
+#define NFD_CORE_FIB_BATCH_UPDATE_HPP
+
+#include "common.hpp"
+#include "nfd-tlv.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/mgmt/control-parameters.hpp>
+
+namespace nfd {
+
+/** \brief parameters of fib/batch-update command
+ *
+ *  A batch carries a sequence of nexthop changes that the FIB Manager applies atomically:
+ *  either every change takes effect, or none does.
+ *
+ *  \code
+ *  FibBatchUpdate ::= FIB-BATCH-UPDATE-TYPE TLV-LENGTH
+ *                       FibBatchUpdateEntry*
+ *
+ *  FibBatchUpdateEntry ::= FIB-BATCH-UPDATE-ENTRY-TYPE TLV-LENGTH
+ *                            FibBatchUpdateAction
+ *                            Name
+ *                            FaceId
+ *                            Cost?
+ *  \endcode
+ */
+class FibBatchUpdate : public ndn::mgmt::ControlParameters
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : tlv::Error(what)
+    {
+    }
+  };
+
+  enum Action {
+    ADD_NEXTHOP    = 0,
+    REMOVE_NEXTHOP = 1
+  };
+
+  /** \brief a nexthop change
+   */
+  struct Entry
+  {
+    Action action;
+    Name name;
+    uint64_t faceId;
+    uint64_t cost; ///< ignored for REMOVE_NEXTHOP
+  };
+
+  typedef std::vector<Entry> EntryList;
+
+public:
+  FibBatchUpdate();
+
+  explicit
+  FibBatchUpdate(const Block& block);
+
+  const EntryList&
+  getEntries() const
+  {
+    return m_entries;
+  }
+
+  FibBatchUpdate&
+  addAddNextHop(const Name& name, uint64_t faceId, uint64_t cost);
+
+  FibBatchUpdate&
+  addRemoveNextHop(const Name& name, uint64_t faceId);
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  bool
+  empty() const
+  {
+    return m_entries.empty();
+  }
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::EncodingImpl<TAG>& encoder) const;
+
+  virtual Block
+  wireEncode() const DECL_FINAL;
+
+  virtual void
+  wireDecode(const Block& wire) DECL_FINAL;
+
+  /** \return encoded size of a single entry
+   *
+   *  Used by senders to split a long list of changes into commands that fit in a packet.
+   */
+  static size_t
+  getEntryWireSize(const Entry& entry);
+
+private:
+  template<ndn::encoding::Tag TAG>
+  static size_t
+  encodeEntry(ndn::EncodingImpl<TAG>& encoder, const Entry& entry);
+
+private:
+  EntryList m_entries;
+
+  mutable Block m_wire;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const FibBatchUpdate::Entry& entry);
+
+} // namespace nfd
+
+#endif // NFD_CORE_FIB_BATCH_UPDATE_HPP
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_NFD_TLV_HPP
+#define NFD_CORE_NFD_TLV_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace tlv {
+
+/** \brief TLV-TYPE numbers of NFD-specific elements
+ *
+ *  All TLV-TYPE numbers that NFD defines outside of NFD Management Protocol are assigned
+ *  here, in ascending order, so that each number has one meaning.
+ *
+ *  Status fields are appended after the fields defined by NFD Management Protocol
+ *  in ForwarderStatus and FaceStatus, so that clients that only decode
+ *  the standard fields are unaffected.
+ *  CongestionStatus is the entry of strategy-choice/congestion dataset, and FibBatchUpdate
+ *  is the parameter of fib/batch-update command; neither is defined by NFD Management Protocol.
+ */
+enum {
+  // PitQuota rejection counters, in ForwarderStatus and FaceStatus
+  NPitCapacityRejects  = 0x0F80,
+  NPitFaceRejects      = 0x0F81,
+  NPitPrefixRejects    = 0x0F82,
+  // PIT entries created by the face, in FaceStatus
+  NPitEntries          = 0x0F83,
+  // packet and byte rates of the face, in FaceStatus; per second, rounded down
+  InPacketRate         = 0x0F84,
+  OutPacketRate        = 0x0F85,
+  InByteRate           = 0x0F86,
+  OutByteRate          = 0x0F87,
+  // send queue of a stream face, in FaceStatus
+  SendQueueBytes       = 0x0F88,
+  NSendQueueDrops      = 0x0F89,
+  // outgoing Interest schedulers of all strategies, in ForwarderStatus:
+  // Interests sent, Interests dropped because of a missed deadline, Interests waiting now
+  NSchedulerSent       = 0x0F8A,
+  NDeadlineMisses      = 0x0F8B,
+  NSchedulerQueued     = 0x0F8C,
+  // fib/batch-update command, see FibBatchUpdate
+  FibBatchUpdate       = 0x0F90,
+  FibBatchUpdateEntry  = 0x0F91,
+  FibBatchUpdateAction = 0x0F92,
+  // strategy-choice/congestion dataset:
+  // CongestionStatus := CONGESTION-STATUS-TYPE TLV-LENGTH
+  //                       Name FaceId CongestionWindow NInFlightInterests NQueuedInterests
+  // CongestionWindow is rounded down to whole Interests
+  CongestionStatus     = 0x0F94,
+  CongestionWindow     = 0x0F95,
+  NInFlightInterests   = 0x0F96,
+  NQueuedInterests     = 0x0F97
+};
+
+} // namespace tlv
+} // namespace nfd
+
+#endif // NFD_CORE_NFD_TLV_HPP
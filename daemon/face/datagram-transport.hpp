@@ -27,12 +27,17 @@
 #define NFD_DAEMON_FACE_DATAGRAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "receive-buffer-pool.hpp"
 #include "core/global-io.hpp"
 #include "face-tracepoint.hpp"
 
 #include <array>
 
-#include <ndn-cxx/util/scheduler.hpp>
+#ifdef __linux__
+#include <cerrno>       // for errno
+#include <cstring>      // for std::memset()
+#include <sys/socket.h> // for recvmmsg() and sendmmsg()
+#endif
 
 namespace nfd {
 
@@ -47,6 +52,12 @@ namespace face {
 struct Unicast {};
 struct Multicast {};
 
+/** \brief maximum number of datagrams received or sent in one system call
+ *
+ *  This is UIO_MAXIOV, the limit of recvmmsg and sendmmsg on Linux.
+ */
+const size_t MAX_DATAGRAM_BATCH_SIZE = 1024;
+
 /** \brief Implements Transport for datagram-based protocols.
  *
  *  \tparam Protocol a datagram-based protocol in Boost.Asio
@@ -60,16 +71,34 @@ public:
   /** \brief Construct datagram transport.
    *
    *  \param socket Protocol-specific socket for the created transport
+   *  \param batchSize maximum number of datagrams received or sent in one system call,
+   *                   see getBatchSize
    */
   explicit
-  DatagramTransport(typename protocol::socket&& socket);
+  DatagramTransport(typename protocol::socket&& socket, size_t batchSize = 1);
 
   /** \brief Construct datagram transport.
    */
   explicit
-  DatagramTransport(typename protocol::endpoint remoteEndpoint);
+  DatagramTransport(typename protocol::endpoint remoteEndpoint, size_t batchSize = 1);
+
+  /** \return maximum number of datagrams received or sent in one system call
+   *
+   *  When this is greater than 1, all datagrams that are ready when the socket becomes readable
+   *  are received with one recvmmsg call, up to this many, into a ring of pre-allocated buffers,
+   *  and then copied into the receive buffer pool.
+   *  Packets sent during one turn of the event loop are queued and sent together with sendmmsg.
+   *  Batching is only available on Linux; elsewhere this is always 1.
+   */
+  size_t
+  getBatchSize() const;
 
   /** \brief Receive datagram, translate buffer into packet, deliver to parent class.
+   *
+   *  The datagram is copied into the receive buffer pool. Datagrams read by the transport
+   *  itself without batching are received directly into the pool and are not copied.
+   *  While such a receive is pending, the datagram is copied into its own buffer instead,
+   *  because the pending receive owns the write position of the pool.
    */
   void
   receiveDatagram(const uint8_t* buffer, size_t nBytesReceived,
@@ -114,8 +143,58 @@ protected:
   static EndpointId
   makeEndpointId(const typename protocol::endpoint& ep);
 
+  /** \brief format local and remote endpoints for tracepoints
+   *
+   *  This should be invoked whenever m_localEndpoint or m_remoteEndpoint changes,
+   *  so that sending and receiving a packet does not format them.
+   */
+  void
+  updateEndpointStrings();
+
+  /** \brief wait for the next datagram, or the next batch of datagrams
+   *
+   *  Does nothing if a receive is already pending.
+   */
+  void
+  startReceive();
+
+#ifdef __linux__
+  /** \brief queue a packet to be sent with sendmmsg, together with other packets
+   *         sent during the same turn of the event loop
+   *  \param socket the socket to send on
+   *  \param destination destination of the packet; nullptr if \p socket is connected
+   *  \pre getBatchSize() > 1
+   */
+  void
+  enqueueBatchedSend(typename protocol::socket& socket,
+                     const typename protocol::endpoint* destination, const Block& packet);
+#endif // __linux__
+
+private:
+  /** \brief translate the pending datagram in the receive buffer pool into packet,
+   *         deliver to parent class
+   */
+  void
+  deliverDatagram(size_t nBytesReceived);
+
+  /** \brief deliver a datagram decoded into \p element to parent class
+   */
+  void
+  deliverElement(bool isOk, Block&& element, size_t nBytesReceived);
+
   void
-  printStatistics();
+  initBatch(size_t batchSize);
+
+#ifdef __linux__
+  void
+  handleReceiveBatch(const boost::system::error_code& error);
+
+  /** \brief send queued packets, until the queue is empty or the socket buffer is full
+   */
+  void
+  handleSendReady(typename protocol::socket& socket, const typename protocol::endpoint* destination,
+                  const boost::system::error_code& error);
+#endif // __linux__
 
 protected:
   typename protocol::socket m_socket;
@@ -125,58 +204,60 @@ protected:
   NFD_LOG_INCLASS_DECLARE();
 
 private:
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  ReceiveBufferPool m_receivePool;
   bool m_hasBeenUsedRecently;
   typename protocol::endpoint m_remoteEndpoint;
   typename protocol::endpoint m_localEndpoint;
   bool m_isConnected;
   bool m_inConnection;
-
-  // Stat
-  ndn::util::Scheduler m_scheduler;
-  int m_packetReceived;
-  int m_packetSent;
-  time::steady_clock::TimePoint m_lastPrintTime;
-  uint32_t m_statIntervalMs;
-
+  bool m_isReceiving; ///< whether a receive is pending on m_socket
+  std::string m_localEndpointStr;
+  std::string m_remoteEndpointStr;
+
+  size_t m_batchSize;
+#ifdef __linux__
+  // batched receive
+  std::vector<std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE>> m_receiveBuffers;
+  std::vector<typename protocol::endpoint> m_receiveSenders;
+  std::vector<iovec> m_receiveIovecs;
+  std::vector<mmsghdr> m_receiveMsgs;
+
+  // batched send
+  std::vector<Block> m_sendQueue;
+  std::vector<iovec> m_sendIovecs;
+  std::vector<mmsghdr> m_sendMsgs;
+  bool m_isSendScheduled;
+#endif // __linux__
 };
 
 
 template<class T, class U>
-DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket)
+DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket,
+                                           size_t batchSize)
   : m_socket(std::move(socket))
   , m_hasBeenUsedRecently(false) // TODO add remote endpoint
-  , m_scheduler(getGlobalIoService())
+  , m_isConnected(true) // the socket is ready to use
+  , m_inConnection(false)
+  , m_isReceiving(false)
 {
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
-                              bind(&DatagramTransport<T, U>::handleReceive, this,
-                                   boost::asio::placeholders::error,
-                                   boost::asio::placeholders::bytes_transferred));
-
-  m_statIntervalMs = 500;
-
-  m_packetSent = 0;
-  m_packetReceived = 0;
-  m_lastPrintTime = time::steady_clock::now();
-  m_scheduler.scheduleEvent(time::milliseconds(m_statIntervalMs), bind(&DatagramTransport::printStatistics, this));
+  this->updateEndpointStrings();
+  this->initBatch(batchSize);
+  this->startReceive();
   // TODO set class local and remote endpoint
 }
 
 template<class T, class U>
-DatagramTransport<T, U>::DatagramTransport(typename protocol::endpoint remoteEndpoint)
+DatagramTransport<T, U>::DatagramTransport(typename protocol::endpoint remoteEndpoint,
+                                           size_t batchSize)
   : m_socket(getGlobalIoService(), remoteEndpoint.protocol())
   , m_hasBeenUsedRecently(false)
   , m_remoteEndpoint(remoteEndpoint)
-  , m_scheduler(getGlobalIoService())
+  , m_isReceiving(false)
 {
-  m_statIntervalMs = 500;
+  this->updateEndpointStrings();
+  this->initBatch(batchSize);
   m_isConnected = false;
   m_inConnection = false;
-
-  m_packetSent = 0;
-  m_packetReceived = 0;
-  m_lastPrintTime = time::steady_clock::now();
-  m_scheduler.scheduleEvent(time::milliseconds(m_statIntervalMs), bind(&DatagramTransport::printStatistics, this));
 }
 
 template<class T, class U>
@@ -221,6 +302,13 @@ DatagramTransport<T, U>::doSend(Transport::Packet&& packet)
                                                     boost::asio::placeholders::error));
     }
 
+#ifdef __linux__
+    if (m_batchSize > 1) {
+      this->enqueueBatchedSend(m_socket, nullptr, packet.packet);
+      return;
+    }
+#endif // __linux__
+
     m_socket.async_send(boost::asio::buffer(packet.packet),
                         bind(&DatagramTransport<T, U>::handleSend, this,
                              boost::asio::placeholders::error,
@@ -244,33 +332,51 @@ DatagramTransport<T, U>::receiveDatagram(const uint8_t* buffer, size_t nBytesRec
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Received from : "<< m_remoteEndpoint << " -> " << nBytesReceived << " bytes");
+  if (m_isReceiving && m_batchSize == 1) {
+    // the pending receive would overwrite the datagram at the write position of the pool
+    bool isOk = false;
+    Block element;
+    std::tie(isOk, element) = Block::fromBuffer(buffer, nBytesReceived);
+    return this->deliverElement(isOk, std::move(element), nBytesReceived);
+  }
 
-  // TODO better conversion
-  std::ostringstream local;
-  local << m_localEndpoint;
-  std::ostringstream remote;
-  remote << m_remoteEndpoint;
+  m_receivePool.prepare();
+  m_receivePool.write(buffer, nBytesReceived);
+  this->deliverDatagram(nBytesReceived);
+}
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::deliverDatagram(size_t nBytesReceived)
+{
   bool isOk = false;
   Block element;
-  std::tie(isOk, element) = Block::fromBuffer(buffer, nBytesReceived);
+  std::tie(isOk, element) = m_receivePool.extractBlock();
+  m_receivePool.discardPending();
+  this->deliverElement(isOk, std::move(element), nBytesReceived);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::deliverElement(bool isOk, Block&& element, size_t nBytesReceived)
+{
+  NFD_LOG_FACE_TRACE("Received from : "<< m_remoteEndpoint << " -> " << nBytesReceived << " bytes");
+
   if (!isOk) {
     NFD_LOG_FACE_WARN("Failed to parse incoming packet");
-    tracepoint(faceLog, packet_received_error, local.str().c_str(), remote.str().c_str(), nBytesReceived, 1);
+    tracepoint(faceLog, packet_received_error, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesReceived, 1);
     // This packet won't extend the face lifetime
     return;
   }
   if (element.size() != nBytesReceived) {
     NFD_LOG_FACE_WARN("Received datagram size and decoded element size don't match E: " << element.size() << " R: " <<  nBytesReceived);
-    tracepoint(faceLog, packet_received_error, local.str().c_str(), remote.str().c_str(), nBytesReceived, 2);
+    tracepoint(faceLog, packet_received_error, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesReceived, 2);
     // This packet won't extend the face lifetime
     return;
   }
   m_hasBeenUsedRecently = true;
 
-  ++m_packetReceived;
-  tracepoint(faceLog, packet_received, local.str().c_str(), remote.str().c_str(), nBytesReceived);
+  tracepoint(faceLog, packet_received, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesReceived);
 
   Transport::Packet tp(std::move(element));
   tp.remoteEndpoint = makeEndpointId(m_sender);
@@ -283,6 +389,7 @@ DatagramTransport<T, U>::rebindSocket(typename protocol::endpoint localEndpoint)
 
 {
   m_localEndpoint = localEndpoint; // TODO We need this to retry the socket binding (is it useful?)
+  this->updateEndpointStrings();
 
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
@@ -346,52 +453,222 @@ DatagramTransport<T, U>::handleConnect(const boost::system::error_code& error)
 
   m_isConnected = true;
 
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+  this->startReceive();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error,
+                                       size_t nBytesReceived)
+{
+  m_isReceiving = false;
+
+  if (error) {
+    processErrorCode(error);
+  }
+  else {
+    m_receivePool.commit(nBytesReceived);
+    this->deliverDatagram(nBytesReceived);
+  }
+
+  if (m_socket.is_open())
+    this->startReceive();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::startReceive()
+{
+  // after rebindSocket, the receive cancelled on the old socket restarts the receive, which
+  // handleConnect would otherwise do a second time
+  if (m_isReceiving)
+    return;
+  m_isReceiving = true;
+
+#ifdef __linux__
+  if (m_batchSize > 1) {
+    // wait for readiness only, datagrams are then read with recvmmsg
+    m_socket.async_receive(boost::asio::null_buffers(),
+                           bind(&DatagramTransport<T, U>::handleReceiveBatch, this,
+                                boost::asio::placeholders::error));
+    return;
+  }
+#endif // __linux__
+
+  // receive directly into the pool; a datagram larger than MAX_NDN_PACKET_SIZE is truncated
+  m_receivePool.prepare();
+  m_socket.async_receive_from(boost::asio::buffer(m_receivePool.getWritePosition(),
+                                                  ndn::MAX_NDN_PACKET_SIZE), m_sender,
                               bind(&DatagramTransport<T, U>::handleReceive, this,
                                    boost::asio::placeholders::error,
                                    boost::asio::placeholders::bytes_transferred));
 }
 
+#ifdef __linux__
 template<class T, class U>
 void
-DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error,
-                                       size_t nBytesReceived)
+DatagramTransport<T, U>::initBatch(size_t batchSize)
 {
-  receiveDatagram(m_receiveBuffer.data(), nBytesReceived, error);
+  m_batchSize = std::min(std::max<size_t>(batchSize, 1), MAX_DATAGRAM_BATCH_SIZE);
+  m_isSendScheduled = false;
+  if (m_batchSize == 1)
+    return;
+
+  m_receiveBuffers.resize(m_batchSize);
+  m_receiveSenders.resize(m_batchSize);
+  m_receiveIovecs.resize(m_batchSize);
+  m_receiveMsgs.resize(m_batchSize);
+  for (size_t i = 0; i < m_batchSize; ++i) {
+    m_receiveIovecs[i].iov_base = m_receiveBuffers[i].data();
+    m_receiveIovecs[i].iov_len = m_receiveBuffers[i].size();
+    std::memset(&m_receiveMsgs[i], 0, sizeof(mmsghdr));
+    m_receiveMsgs[i].msg_hdr.msg_name = m_receiveSenders[i].data();
+    m_receiveMsgs[i].msg_hdr.msg_iov = &m_receiveIovecs[i];
+    m_receiveMsgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  m_sendQueue.reserve(m_batchSize);
+  m_sendIovecs.resize(m_batchSize);
+  m_sendMsgs.resize(m_batchSize);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleReceiveBatch(const boost::system::error_code& error)
+{
+  m_isReceiving = false;
+
+  if (error) {
+    processErrorCode(error);
+  }
+  else {
+    for (size_t i = 0; i < m_batchSize; ++i) {
+      m_receiveMsgs[i].msg_hdr.msg_namelen = m_receiveSenders[i].capacity();
+    }
+
+    int nReceived = ::recvmmsg(m_socket.native_handle(), m_receiveMsgs.data(), m_batchSize,
+                               MSG_DONTWAIT, nullptr);
+    if (nReceived < 0) {
+      int errorNo = errno;
+      if (errorNo != EAGAIN && errorNo != EWOULDBLOCK && errorNo != EINTR) {
+        processErrorCode(boost::system::error_code(errorNo, boost::system::system_category()));
+      }
+    }
+
+    // the buffers can be reused right away, because receiveDatagram copies the datagram
+    for (int i = 0; i < nReceived && m_socket.is_open(); ++i) {
+      m_receiveSenders[i].resize(m_receiveMsgs[i].msg_hdr.msg_namelen);
+      m_sender = m_receiveSenders[i];
+      receiveDatagram(m_receiveBuffers[i].data(), m_receiveMsgs[i].msg_len, error);
+    }
+  }
 
   if (m_socket.is_open())
-    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
-                                bind(&DatagramTransport<T, U>::handleReceive, this,
-                                     boost::asio::placeholders::error,
-                                     boost::asio::placeholders::bytes_transferred));
+    this->startReceive();
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::enqueueBatchedSend(typename protocol::socket& socket,
+                                            const typename protocol::endpoint* destination,
+                                            const Block& packet)
+{
+  BOOST_ASSERT(m_batchSize > 1);
+
+  m_sendQueue.push_back(packet);
+  if (m_isSendScheduled)
+    return;
+
+  m_isSendScheduled = true;
+  getGlobalIoService().post(bind(&DatagramTransport<T, U>::handleSendReady, this,
+                                 ref(socket), destination, boost::system::error_code()));
 }
 
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleSendReady(typename protocol::socket& socket,
+                                         const typename protocol::endpoint* destination,
+                                         const boost::system::error_code& error)
+{
+  if (error) { // socket is closed
+    m_sendQueue.clear();
+    m_isSendScheduled = false;
+    return;
+  }
+
+  size_t nSent = 0;
+  while (nSent < m_sendQueue.size() && socket.is_open()) {
+    size_t nMsgs = std::min(m_batchSize, m_sendQueue.size() - nSent);
+    for (size_t i = 0; i < nMsgs; ++i) {
+      const Block& packet = m_sendQueue[nSent + i];
+      m_sendIovecs[i].iov_base = const_cast<uint8_t*>(packet.wire());
+      m_sendIovecs[i].iov_len = packet.size();
+      std::memset(&m_sendMsgs[i], 0, sizeof(mmsghdr));
+      if (destination != nullptr) {
+        m_sendMsgs[i].msg_hdr.msg_name = const_cast<sockaddr*>(destination->data());
+        m_sendMsgs[i].msg_hdr.msg_namelen = destination->size();
+      }
+      m_sendMsgs[i].msg_hdr.msg_iov = &m_sendIovecs[i];
+      m_sendMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int nDone = ::sendmmsg(socket.native_handle(), m_sendMsgs.data(), nMsgs, MSG_DONTWAIT);
+    if (nDone < 0) {
+      int errorNo = errno;
+      if (errorNo == EAGAIN || errorNo == EWOULDBLOCK) {
+        // socket buffer is full, continue when the socket becomes writable
+        m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + nSent);
+        socket.async_send(boost::asio::null_buffers(),
+                          bind(&DatagramTransport<T, U>::handleSendReady, this,
+                               ref(socket), destination, boost::asio::placeholders::error));
+        return;
+      }
+
+      // the first packet failed; like async_send, report the error and drop the packet
+      handleSend(boost::system::error_code(errorNo, boost::system::system_category()), 0,
+                 m_sendQueue[nSent]);
+      ++nSent;
+      continue;
+    }
+
+    for (int i = 0; i < nDone; ++i) {
+      handleSend(boost::system::error_code(), m_sendMsgs[i].msg_len, m_sendQueue[nSent + i]);
+    }
+    nSent += nDone;
+  }
+
+  m_sendQueue.clear();
+  m_isSendScheduled = false;
+}
+#else
+template<class T, class U>
+void
+DatagramTransport<T, U>::initBatch(size_t batchSize)
+{
+  // recvmmsg and sendmmsg are available only on Linux
+  m_batchSize = 1;
+}
+#endif // __linux__
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::handleSend(const boost::system::error_code& error,
                                     size_t nBytesSent, const Block& payload)
 // 'payload' is unused; it's needed to retain the underlying Buffer
 {
-  // TODO better conversion
-  std::ostringstream local;
-  local << m_localEndpoint;
-  std::ostringstream remote;
-  remote << m_remoteEndpoint;
-
   if (error) {
     NFD_LOG_FACE_DEBUG(" NOT sent - Error socket");
-    tracepoint(faceLog, packet_sent_error, local.str().c_str(), remote.str().c_str(), nBytesSent, 1);
+    tracepoint(faceLog, packet_sent_error, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesSent, 1);
     return processErrorCode(error);
   }
 
   if (!m_isConnected) {
     NFD_LOG_FACE_DEBUG(" NOT sent - Connection error ");
-    tracepoint(faceLog, packet_sent_error, local.str().c_str(), remote.str().c_str(), nBytesSent, 2);
+    tracepoint(faceLog, packet_sent_error, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesSent, 2);
   }
   else {
-    ++m_packetSent;
     //NFD_LOG_FACE_DEBUG("Successfully sent: " << nBytesSent << " bytes");
-    tracepoint(faceLog, packet_sent, local.str().c_str(), remote.str().c_str(), nBytesSent);
+    tracepoint(faceLog, packet_sent, m_localEndpointStr.c_str(), m_remoteEndpointStr.c_str(), nBytesSent);
   }
 }
 
@@ -420,6 +697,13 @@ DatagramTransport<T, U>::processErrorCode(const boost::system::error_code& error
   doClose();
 }
 
+template<class T, class U>
+inline size_t
+DatagramTransport<T, U>::getBatchSize() const
+{
+  return m_batchSize;
+}
+
 template<class T, class U>
 inline bool
 DatagramTransport<T, U>::hasBeenUsedRecently() const
@@ -442,26 +726,16 @@ DatagramTransport<T, U>::makeEndpointId(const typename protocol::endpoint& ep)
 }
 
 template<class T, class U>
-inline void
-DatagramTransport<T, U>::printStatistics()
+void
+DatagramTransport<T, U>::updateEndpointStrings()
 {
-  time::milliseconds lastRunningTime =
-      time::duration_cast<time::milliseconds> (time::steady_clock::now() - m_lastPrintTime);
-
-  if (m_packetReceived > 0 || m_packetSent > 0) {
-    NFD_LOG_FACE_INFO( std::endl
-              << "Speed: " << static_cast<double>(m_packetReceived * 1407) / lastRunningTime.count() << " KB/s \t"
-              << "S:   " << m_packetSent << "  \t"
-              << "R:   " << m_packetReceived << "  \t"
-              << "D:   " << m_packetSent - m_packetReceived << "  \t"
-              );
-  }
-
-  m_lastPrintTime = time::steady_clock::now();
-  m_packetReceived = 0;
-  m_packetSent = 0;
+  std::ostringstream local;
+  local << m_localEndpoint;
+  m_localEndpointStr = local.str();
 
-  m_scheduler.scheduleEvent(time::milliseconds(m_statIntervalMs), bind(&DatagramTransport::printStatistics, this));
+  std::ostringstream remote;
+  remote << m_remoteEndpoint;
+  m_remoteEndpointStr = remote.str();
 }
 
 } // namespace face
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "face-stats.hpp"
+
+namespace nfd {
+namespace face {
+
+const time::milliseconds FaceStats::MIN_SAMPLE_INTERVAL(1000);
+
+FaceStats::Rates::Rates()
+  : nInPackets(0.0)
+  , nOutPackets(0.0)
+  , nInBytes(0.0)
+  , nOutBytes(0.0)
+{
+}
+
+FaceStats::Sample::Sample(const Face& face)
+  : time(time::steady_clock::now())
+  , nInPackets(face.getCounters().nInPackets)
+  , nOutPackets(face.getCounters().nOutPackets)
+  , nInBytes(face.getCounters().nInBytes)
+  , nOutBytes(face.getCounters().nOutBytes)
+{
+}
+
+void
+FaceStats::addFace(const Face& face)
+{
+  m_samples.erase(face.getId());
+  m_samples.emplace(face.getId(), Sample(face));
+}
+
+void
+FaceStats::removeFace(FaceId faceId)
+{
+  m_samples.erase(faceId);
+}
+
+const FaceStats::Rates&
+FaceStats::getRates(const Face& face)
+{
+  auto it = m_samples.find(face.getId());
+  if (it == m_samples.end()) {
+    // face was added before this FaceStats existed
+    return m_samples.emplace(face.getId(), Sample(face)).first->second.rates;
+  }
+
+  Sample& previous = it->second;
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (now - previous.time < MIN_SAMPLE_INTERVAL) {
+    return previous.rates;
+  }
+
+  Sample current(face);
+  double seconds = time::duration_cast<time::microseconds>(current.time - previous.time).count() /
+                   1000000.0;
+  auto computeRate = [seconds] (uint64_t currentCount, uint64_t previousCount) {
+    // a counter that went backwards has been reset
+    return currentCount < previousCount ? 0.0 : (currentCount - previousCount) / seconds;
+  };
+  current.rates.nInPackets = computeRate(current.nInPackets, previous.nInPackets);
+  current.rates.nOutPackets = computeRate(current.nOutPackets, previous.nOutPackets);
+  current.rates.nInBytes = computeRate(current.nInBytes, previous.nInBytes);
+  current.rates.nOutBytes = computeRate(current.nOutBytes, previous.nOutBytes);
+  previous = current;
+  return previous.rates;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FACE_FACE_STATS_HPP
+#define NFD_DAEMON_FACE_FACE_STATS_HPP
+
+#include "face.hpp"
+
+namespace nfd {
+namespace face {
+
+/** \brief computes packet and byte rates of faces from their counters
+ *
+ *  Counters are sampled on demand, when the rates of a face are requested, so that
+ *  there is no periodic work per face. A rate is the average between the previous sample
+ *  and the current sample. Samples less than MIN_SAMPLE_INTERVAL apart return the rates
+ *  of the previous sample, so that frequent requests do not produce noisy rates.
+ */
+class FaceStats : noncopyable
+{
+public:
+  /** \brief rates per second
+   */
+  class Rates
+  {
+  public:
+    Rates();
+
+  public:
+    double nInPackets;
+    double nOutPackets;
+    double nInBytes;
+    double nOutBytes;
+  };
+
+  /** \brief takes the first sample of face
+   *
+   *  This should be invoked when a face is added, so that the first rates requested
+   *  are averages since the face was added.
+   */
+  void
+  addFace(const Face& face);
+
+  /** \brief forgets samples of face
+   *
+   *  This should be invoked when a face is removed.
+   */
+  void
+  removeFace(FaceId faceId);
+
+  /** \brief samples counters of face if MIN_SAMPLE_INTERVAL has passed since the previous sample
+   *  \return rates between the last two samples; all zero if face has only one sample
+   */
+  const Rates&
+  getRates(const Face& face);
+
+public:
+  static const time::milliseconds MIN_SAMPLE_INTERVAL;
+
+private:
+  class Sample
+  {
+  public:
+    explicit
+    Sample(const Face& face);
+
+  public:
+    time::steady_clock::TimePoint time;
+    uint64_t nInPackets;
+    uint64_t nOutPackets;
+    uint64_t nInBytes;
+    uint64_t nOutBytes;
+    Rates rates;
+  };
+
+  std::unordered_map<FaceId, Sample> m_samples;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_FACE_STATS_HPP
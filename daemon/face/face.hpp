@@ -79,6 +79,9 @@ public:
   Transport*
   getTransport();
 
+  const Transport*
+  getTransport() const;
+
 public: // upper interface connected to forwarding
   /** \brief sends Interest on Face
    */
@@ -203,6 +206,12 @@ Face::getTransport()
   return m_transport.get();
 }
 
+inline const Transport*
+Face::getTransport() const
+{
+  return m_transport.get();
+}
+
 inline void
 Face::sendInterest(const Interest& interest)
 {
@@ -155,6 +155,13 @@ void
 GenericLinkService::doReceivePacket(Transport::Packet&& packet)
 {
   try {
+    if (packet.packet.type() == tlv::Interest || packet.packet.type() == tlv::Data) {
+      // bare network-layer packet: decode it in place, instead of wrapping it in an LpPacket
+      // and copying the fragment out of it
+      this->decodeNetPacket(packet.packet, lp::Packet());
+      return;
+    }
+
     lp::Packet pkt(packet.packet);
 
     if (!pkt.has<lp::FragmentField>()) {
@@ -35,8 +35,9 @@ NFD_LOG_INCLASS_2TEMPLATE_SPECIALIZATION_DEFINE(DatagramTransport, MulticastUdpT
 MulticastUdpTransport::MulticastUdpTransport(const protocol::endpoint& localEndpoint,
                                              const protocol::endpoint& multicastGroup,
                                              protocol::socket&& recvSocket,
-                                             protocol::socket&& sendSocket)
-  : DatagramTransport(std::move(recvSocket))
+                                             protocol::socket&& sendSocket,
+                                             size_t batchSize)
+  : DatagramTransport(std::move(recvSocket), batchSize)
   , m_multicastGroup(multicastGroup)
   , m_sendSocket(std::move(sendSocket))
 {
@@ -64,6 +65,13 @@ MulticastUdpTransport::doSend(Transport::Packet&& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+#ifdef __linux__
+  if (getBatchSize() > 1) {
+    this->enqueueBatchedSend(m_sendSocket, &m_multicastGroup, packet.packet);
+    return;
+  }
+#endif // __linux__
+
   m_sendSocket.async_send_to(boost::asio::buffer(packet.packet), m_multicastGroup,
                              bind(&MulticastUdpTransport::handleSend, this,
                                   boost::asio::placeholders::error,
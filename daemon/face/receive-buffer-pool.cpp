@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "receive-buffer-pool.hpp"
+
+#include <cstring>
+
+namespace nfd {
+namespace face {
+
+const size_t ReceiveBufferPool::DEFAULT_SLAB_SIZE = 4 * ndn::MAX_NDN_PACKET_SIZE;
+const size_t ReceiveBufferPool::DEFAULT_MAX_SLABS = 16;
+
+ReceiveBufferPool::ReceiveBufferPool(size_t slabSize, size_t maxSlabs)
+  : m_slabSize(std::max(slabSize, ndn::MAX_NDN_PACKET_SIZE))
+  , m_maxSlabs(std::max<size_t>(maxSlabs, 1))
+  , m_nextReplacement(0)
+  , m_begin(0)
+  , m_end(0)
+  , m_nAllocatedSlabs(0)
+  , m_nReusedSlabs(0)
+  , m_nCopiedBytes(0)
+{
+}
+
+void
+ReceiveBufferPool::prepare()
+{
+  if (m_slab != nullptr && m_slab->size() - m_begin >= ndn::MAX_NDN_PACKET_SIZE) {
+    return;
+  }
+
+  // release the current slab first, so that it can be reused if no Block references it
+  shared_ptr<ndn::Buffer> oldSlab = std::move(m_slab);
+  size_t nPending = this->getPendingSize();
+  if (nPending == 0) {
+    oldSlab.reset();
+  }
+
+  m_slab = this->acquireSlab();
+  if (nPending > 0) {
+    std::memcpy(m_slab->buf(), oldSlab->buf() + m_begin, nPending);
+    m_nCopiedBytes += nPending;
+  }
+  m_begin = 0;
+  m_end = nPending;
+}
+
+void
+ReceiveBufferPool::commit(size_t nBytes)
+{
+  BOOST_ASSERT(nBytes <= this->getWritableSize());
+  m_end += nBytes;
+}
+
+void
+ReceiveBufferPool::write(const uint8_t* buffer, size_t nBytes)
+{
+  BOOST_ASSERT(nBytes <= this->getWritableSize());
+  std::memcpy(this->getWritePosition(), buffer, nBytes);
+  m_nCopiedBytes += nBytes;
+  m_end += nBytes;
+}
+
+std::tuple<bool, Block>
+ReceiveBufferPool::extractBlock()
+{
+  if (m_slab == nullptr) {
+    return std::make_tuple(false, Block());
+  }
+
+  ndn::Buffer::const_iterator begin = m_slab->begin() + m_begin;
+  ndn::Buffer::const_iterator end = m_slab->begin() + m_end;
+  ndn::Buffer::const_iterator valueBegin = begin;
+
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readType(valueBegin, end, type) ||
+      !tlv::readVarNumber(valueBegin, end, length) ||
+      length > static_cast<uint64_t>(end - valueBegin) ||
+      length > ndn::MAX_NDN_PACKET_SIZE - static_cast<size_t>(valueBegin - begin)) {
+    return std::make_tuple(false, Block());
+  }
+
+  ndn::Buffer::const_iterator valueEnd = valueBegin + length;
+  m_begin += valueEnd - begin;
+  return std::make_tuple(true, Block(m_slab, type, begin, valueEnd, valueBegin, valueEnd));
+}
+
+void
+ReceiveBufferPool::discardPending()
+{
+  m_begin = m_end;
+}
+
+shared_ptr<ndn::Buffer>
+ReceiveBufferPool::acquireSlab()
+{
+  for (const shared_ptr<ndn::Buffer>& slab : m_slabs) {
+    if (slab.use_count() == 1) {
+      ++m_nReusedSlabs;
+      return slab;
+    }
+  }
+
+  ++m_nAllocatedSlabs;
+  auto slab = make_shared<ndn::Buffer>(m_slabSize);
+  if (m_slabs.size() < m_maxSlabs) {
+    m_slabs.push_back(slab);
+  }
+  else {
+    // every slab is referenced by some Block; stop tracking one of them,
+    // it will be freed when its last Block is released
+    m_slabs[m_nextReplacement] = slab;
+    m_nextReplacement = (m_nextReplacement + 1) % m_maxSlabs;
+  }
+  return slab;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+#define NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/encoding/buffer.hpp>
+
+namespace nfd {
+namespace face {
+
+/** \brief receive buffer of a transport, made of reference-counted slabs
+ *
+ *  A transport reads from its socket directly into the current slab, after the octets that
+ *  have already been received. Each complete packet is extracted as a Block that references
+ *  a slice of the slab, so that the packet is not copied between the socket and the forwarding
+ *  tables. A slab stays alive as long as any Block references it, and is reused once
+ *  all of them have been released.
+ *
+ *  A retained Block keeps its whole slab alive. Tables that keep packets for long,
+ *  i.e. the ContentStore and the PIT (entries and in-records), copy them out of the slab.
+ */
+class ReceiveBufferPool : noncopyable
+{
+public:
+  /** \param slabSize size of each slab; must be at least ndn::MAX_NDN_PACKET_SIZE
+   *  \param maxSlabs maximum number of slabs kept for reuse
+   */
+  explicit
+  ReceiveBufferPool(size_t slabSize = DEFAULT_SLAB_SIZE, size_t maxSlabs = DEFAULT_MAX_SLABS);
+
+  /** \brief make room for a packet of up to ndn::MAX_NDN_PACKET_SIZE octets
+   *
+   *  If the current slab cannot hold a complete packet starting at the first pending octet,
+   *  switches to a slab that is not referenced by any Block, and moves pending octets there.
+   *  \post getWritableSize() > 0, and getPendingSize() + getWritableSize() >= MAX_NDN_PACKET_SIZE
+   */
+  void
+  prepare();
+
+  /** \return where the next received octets should be written
+   *  \pre prepare() has been invoked since the last commit
+   */
+  uint8_t*
+  getWritePosition();
+
+  size_t
+  getWritableSize() const;
+
+  /** \brief marks \p nBytes octets written at getWritePosition() as pending
+   */
+  void
+  commit(size_t nBytes);
+
+  /** \brief copies \p nBytes octets into the slab and marks them as pending
+   *
+   *  This is used when a packet could not be received directly into the slab.
+   *  \pre prepare() has been invoked, and nBytes <= getWritableSize()
+   */
+  void
+  write(const uint8_t* buffer, size_t nBytes);
+
+  /** \return number of octets received but not yet extracted
+   */
+  size_t
+  getPendingSize() const;
+
+  /** \brief extracts the first complete TLV element from pending octets, without copying
+   *  \return whether a complete element is pending, and the element
+   *
+   *  An element larger than ndn::MAX_NDN_PACKET_SIZE is never extracted, even when the slab
+   *  holds all of it; a stream transport fails once that many octets are pending.
+   */
+  std::tuple<bool, Block>
+  extractBlock();
+
+  /** \brief drops all pending octets
+   */
+  void
+  discardPending();
+
+  /** \return number of slabs allocated
+   */
+  uint64_t
+  getNAllocatedSlabs() const
+  {
+    return m_nAllocatedSlabs;
+  }
+
+  /** \return number of times a slab was reused after all its Blocks had been released
+   */
+  uint64_t
+  getNReusedSlabs() const
+  {
+    return m_nReusedSlabs;
+  }
+
+  /** \return number of octets copied, by write() or when moving pending octets to another slab
+   */
+  uint64_t
+  getNCopiedBytes() const
+  {
+    return m_nCopiedBytes;
+  }
+
+public:
+  static const size_t DEFAULT_SLAB_SIZE;
+  static const size_t DEFAULT_MAX_SLABS;
+
+private:
+  shared_ptr<ndn::Buffer>
+  acquireSlab();
+
+private:
+  const size_t m_slabSize;
+  const size_t m_maxSlabs;
+  std::vector<shared_ptr<ndn::Buffer>> m_slabs;
+  size_t m_nextReplacement;
+
+  shared_ptr<ndn::Buffer> m_slab;
+  size_t m_begin; ///< offset of first pending octet in m_slab
+  size_t m_end; ///< offset after last pending octet in m_slab
+
+  uint64_t m_nAllocatedSlabs;
+  uint64_t m_nReusedSlabs;
+  uint64_t m_nCopiedBytes;
+};
+
+inline uint8_t*
+ReceiveBufferPool::getWritePosition()
+{
+  BOOST_ASSERT(m_slab != nullptr);
+  return m_slab->buf() + m_end;
+}
+
+inline size_t
+ReceiveBufferPool::getWritableSize() const
+{
+  return m_slab == nullptr ? 0 : m_slab->size() - m_end;
+}
+
+inline size_t
+ReceiveBufferPool::getPendingSize() const
+{
+  return m_end - m_begin;
+}
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
@@ -27,23 +27,50 @@
 #define NFD_DAEMON_FACE_STREAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "receive-buffer-pool.hpp"
 #include "core/global-io.hpp"
 
-#include <queue>
+#include <deque>
 
 namespace nfd {
 namespace face {
 
+/** \brief counters provided by StreamTransport
+ *  \note The type name 'StreamTransportCounters' is implementation detail.
+ *        Use 'StreamTransport::Counters' in public API.
+ */
+class StreamTransportCounters : public virtual Transport::Counters
+{
+public:
+  /** \brief octets in the send queue, including those being written
+   */
+  SimpleCounter nSendQueueBytes;
+
+  /** \brief count of outgoing packets dropped because the send queue was full
+   *
+   *  These packets are included in nOutPackets and nOutBytes.
+   */
+  PacketCounter nSendQueueDrops;
+};
+
 /** \brief Implements Transport for stream-based protocols.
+ *
+ *  Packets sent while a write is in progress are queued, and then written together
+ *  with one gathered write, up to MAX_GATHERED_PACKETS packets or MAX_GATHERED_BYTES octets.
  *
  *  \tparam Protocol a stream-based protocol in Boost.Asio
  */
 template<class Protocol>
 class StreamTransport : public Transport
+                      , protected virtual StreamTransportCounters
 {
 public:
   typedef Protocol protocol;
 
+  /** \brief counters provided by StreamTransport
+   */
+  typedef StreamTransportCounters Counters;
+
   /** \brief Construct stream transport.
    *
    *  \param socket Protocol-specific socket for the created transport
@@ -51,6 +78,32 @@ public:
   explicit
   StreamTransport(typename protocol::socket&& socket);
 
+  virtual const Counters&
+  getCounters() const DECL_OVERRIDE;
+
+  /** \return maximum octets in the send queue; 0 means unlimited
+   */
+  size_t
+  getSendQueueLimit() const;
+
+  /** \brief set maximum octets in the send queue
+   *
+   *  A packet sent when it would not fit in the send queue is dropped, unless the queue is empty.
+   *  \param limit maximum octets; 0 means unlimited
+   */
+  void
+  setSendQueueLimit(size_t limit);
+
+public:
+  /** \brief maximum number of packets written with one gathered write
+   */
+  static const size_t MAX_GATHERED_PACKETS = 64;
+
+  /** \brief maximum octets written with one gathered write,
+   *         unless the first packet alone is larger
+   */
+  static const size_t MAX_GATHERED_BYTES = 65536;
+
 protected:
   virtual void
   doClose() DECL_OVERRIDE;
@@ -68,6 +121,9 @@ protected:
   handleSend(const boost::system::error_code& error,
              size_t nBytesSent);
 
+  void
+  startReceive();
+
   void
   handleReceive(const boost::system::error_code& error,
                 size_t nBytesReceived);
@@ -81,21 +137,45 @@ protected:
   NFD_LOG_INCLASS_DECLARE();
 
 private:
-  uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
-  size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
+  ReceiveBufferPool m_receivePool;
+  std::deque<Block> m_sendQueue;
+  size_t m_sendQueueBytes;
+  size_t m_sendQueueLimit;
+  std::vector<boost::asio::const_buffer> m_gatheredBuffers;
+  size_t m_nGathered; ///< number of packets at the front of m_sendQueue being written
 };
 
 
 template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
-  , m_receiveBufferSize(0)
+  , m_sendQueueBytes(0)
+  , m_sendQueueLimit(0)
+  , m_nGathered(0)
 {
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer, ndn::MAX_NDN_PACKET_SIZE),
-                         bind(&StreamTransport<T>::handleReceive, this,
-                              boost::asio::placeholders::error,
-                              boost::asio::placeholders::bytes_transferred));
+  m_gatheredBuffers.reserve(MAX_GATHERED_PACKETS);
+  this->startReceive();
+}
+
+template<class T>
+const typename StreamTransport<T>::Counters&
+StreamTransport<T>::getCounters() const
+{
+  return *this;
+}
+
+template<class T>
+size_t
+StreamTransport<T>::getSendQueueLimit() const
+{
+  return m_sendQueueLimit;
+}
+
+template<class T>
+void
+StreamTransport<T>::setSendQueueLimit(size_t limit)
+{
+  m_sendQueueLimit = limit;
 }
 
 template<class T>
@@ -137,8 +217,11 @@ StreamTransport<T>::deferredClose()
   NFD_LOG_FACE_TRACE(__func__);
 
   // clear send queue
-  std::queue<Block> emptyQueue;
+  std::deque<Block> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
+  m_sendQueueBytes = 0;
+  m_nGathered = 0;
+  this->nSendQueueBytes.set(0);
 
   // use the non-throwing variant and ignore errors, if any
   boost::system::error_code error;
@@ -154,7 +237,16 @@ StreamTransport<T>::doSend(Transport::Packet&& packet)
   NFD_LOG_FACE_TRACE(__func__);
 
   bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet.packet);
+  if (!wasQueueEmpty && m_sendQueueLimit > 0 &&
+      m_sendQueueBytes + packet.packet.size() > m_sendQueueLimit) {
+    NFD_LOG_FACE_DEBUG("Send queue full (" << m_sendQueueBytes << " bytes): DROP");
+    ++this->nSendQueueDrops;
+    return;
+  }
+
+  m_sendQueue.push_back(std::move(packet.packet));
+  m_sendQueueBytes += m_sendQueue.back().size();
+  this->nSendQueueBytes.set(m_sendQueueBytes);
 
   if (wasQueueEmpty)
     sendFromQueue();
@@ -164,7 +256,20 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  // gather queued packets into one write; they stay in the queue until handleSend
+  m_gatheredBuffers.clear();
+  size_t nBytes = 0;
+  for (const Block& block : m_sendQueue) {
+    if (m_gatheredBuffers.size() == MAX_GATHERED_PACKETS ||
+        (!m_gatheredBuffers.empty() && nBytes + block.size() > MAX_GATHERED_BYTES)) {
+      break;
+    }
+    m_gatheredBuffers.push_back(boost::asio::buffer(block));
+    nBytes += block.size();
+  }
+  m_nGathered = m_gatheredBuffers.size();
+
+  boost::asio::async_write(m_socket, m_gatheredBuffers,
                            bind(&StreamTransport<T>::handleSend, this,
                                 boost::asio::placeholders::error,
                                 boost::asio::placeholders::bytes_transferred));
@@ -178,15 +283,33 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes in "
+                     << m_nGathered << " packets");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  m_sendQueue.pop();
+  BOOST_ASSERT(m_sendQueue.size() >= m_nGathered);
+  BOOST_ASSERT(m_sendQueueBytes >= nBytesSent);
+  m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + m_nGathered);
+  m_sendQueueBytes -= nBytesSent;
+  this->nSendQueueBytes.set(m_sendQueueBytes);
+  m_nGathered = 0;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
 }
 
+template<class T>
+void
+StreamTransport<T>::startReceive()
+{
+  // an incomplete packet is moved to a new slab only when the current slab cannot hold it
+  m_receivePool.prepare();
+  m_socket.async_receive(boost::asio::buffer(m_receivePool.getWritePosition(),
+                                             m_receivePool.getWritableSize()),
+                         bind(&StreamTransport<T>::handleReceive, this,
+                              boost::asio::placeholders::error,
+                              boost::asio::placeholders::bytes_transferred));
+}
+
 template<class T>
 void
 StreamTransport<T>::handleReceive(const boost::system::error_code& error,
@@ -197,45 +320,26 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
 
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
-  m_receiveBufferSize += nBytesReceived;
-
-  size_t offset = 0;
+  m_receivePool.commit(nBytesReceived);
 
   bool isOk = true;
   Block element;
-  while (m_receiveBufferSize - offset > 0) {
-    std::tie(isOk, element) = Block::fromBuffer(m_receiveBuffer + offset, m_receiveBufferSize - offset);
+  while (m_receivePool.getPendingSize() > 0) {
+    std::tie(isOk, element) = m_receivePool.extractBlock();
     if (!isOk)
       break;
 
-    offset += element.size();
-    BOOST_ASSERT(offset <= m_receiveBufferSize);
-
     this->receive(Transport::Packet(std::move(element)));
   }
 
-  if (!isOk && m_receiveBufferSize == ndn::MAX_NDN_PACKET_SIZE && offset == 0) {
+  if (!isOk && m_receivePool.getPendingSize() >= ndn::MAX_NDN_PACKET_SIZE) {
     NFD_LOG_FACE_WARN("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
     return;
   }
 
-  if (offset > 0) {
-    if (offset != m_receiveBufferSize) {
-      std::copy(m_receiveBuffer + offset, m_receiveBuffer + m_receiveBufferSize, m_receiveBuffer);
-      m_receiveBufferSize -= offset;
-    }
-    else {
-      m_receiveBufferSize = 0;
-    }
-  }
-
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer + m_receiveBufferSize,
-                                             ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize),
-                         bind(&StreamTransport<T>::handleReceive, this,
-                              boost::asio::placeholders::error,
-                              boost::asio::placeholders::bytes_transferred));
+  this->startReceive();
 }
 
 template<class T>
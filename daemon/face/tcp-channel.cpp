@@ -34,10 +34,11 @@ NFD_LOG_INIT("TcpChannel");
 
 namespace ip = boost::asio::ip;
 
-TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint)
+TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint, size_t sendQueueLimit)
   : m_localEndpoint(localEndpoint)
   , m_acceptor(getGlobalIoService())
   , m_acceptSocket(getGlobalIoService())
+  , m_sendQueueLimit(sendQueueLimit)
 {
   setUri(FaceUri(m_localEndpoint));
 }
@@ -108,6 +109,7 @@ TcpChannel::createFace(ip::tcp::socket&& socket,
                                   : ndn::nfd::FACE_PERSISTENCY_PERSISTENT;
     auto linkService = make_unique<face::GenericLinkService>();
     auto transport = make_unique<face::TcpTransport>(std::move(socket), persistency);
+    transport->setSendQueueLimit(m_sendQueueLimit);
     face = make_shared<Face>(std::move(linkService), std::move(transport));
 
     m_channelFaces[remoteEndpoint] = face;
@@ -50,9 +50,12 @@ public:
    *
    * To enable creation faces upon incoming connections,
    * one needs to explicitly call TcpChannel::listen method.
+   *
+   * \param sendQueueLimit maximum octets in the send queue of created faces; 0 means unlimited,
+   *                       see face::StreamTransport::setSendQueueLimit
    */
   explicit
-  TcpChannel(const tcp::Endpoint& localEndpoint);
+  TcpChannel(const tcp::Endpoint& localEndpoint, size_t sendQueueLimit = 0);
 
   /**
    * \brief Enable listening on the local endpoint, accept connections,
@@ -118,6 +121,7 @@ private:
   tcp::Endpoint m_localEndpoint;
   boost::asio::ip::tcp::acceptor m_acceptor;
   boost::asio::ip::tcp::socket m_acceptSocket;
+  size_t m_sendQueueLimit;
 };
 
 inline bool
@@ -35,6 +35,11 @@ namespace ip = boost::asio::ip;
 
 NFD_LOG_INIT("TcpFactory");
 
+TcpFactory::TcpFactory()
+  : m_sendQueueLimit(0)
+{
+}
+
 void
 TcpFactory::prohibitEndpoint(const tcp::Endpoint& endpoint)
 {
@@ -82,7 +87,7 @@ TcpFactory::createChannel(const tcp::Endpoint& endpoint)
   if (channel)
     return channel;
 
-  channel = make_shared<TcpChannel>(endpoint);
+  channel = make_shared<TcpChannel>(endpoint, m_sendQueueLimit);
   m_channels[endpoint] = channel;
   prohibitEndpoint(endpoint);
 
@@ -47,6 +47,22 @@ public:
     }
   };
 
+  TcpFactory();
+
+  /**
+   * \brief Set the maximum octets in the send queue of faces created afterwards
+   *
+   * Existing channels and faces keep their limit.
+   *
+   * \param limit maximum octets; 0 means unlimited
+   * \sa face::StreamTransport::setSendQueueLimit
+   */
+  void
+  setSendQueueLimit(size_t limit);
+
+  size_t
+  getSendQueueLimit() const;
+
   /**
    * \brief Create TCP-based channel using tcp::Endpoint
    *
@@ -110,11 +126,24 @@ private:
 
 private:
   std::map<tcp::Endpoint, shared_ptr<TcpChannel>> m_channels;
+  size_t m_sendQueueLimit;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::set<tcp::Endpoint> m_prohibitedEndpoints;
 };
 
+inline void
+TcpFactory::setSendQueueLimit(size_t limit)
+{
+  m_sendQueueLimit = limit;
+}
+
+inline size_t
+TcpFactory::getSendQueueLimit() const
+{
+  return m_sendQueueLimit;
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_FACE_TCP_FACTORY_HPP
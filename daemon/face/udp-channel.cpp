@@ -38,10 +38,12 @@ using namespace boost::asio;
 
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        const shared_ptr<ndn::util::NetworkInterface>& ni,
-                       const time::seconds& timeout)
+                       const time::seconds& timeout,
+                       size_t batchSize)
   : m_localEndpoint(localEndpoint)
   , m_socket(getGlobalIoService())
   , m_idleFaceTimeout(timeout)
+  , m_batchSize(batchSize)
   , m_networkInterface(ni)
 {
   setUri(FaceUri(m_localEndpoint));
@@ -202,7 +204,8 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint, ndn::nfd::FacePersis
   //TODO mio auto
   unique_ptr<face::UnicastUdpTransport> transport =
       make_unique<face::UnicastUdpTransport>(std::move(socket), persistency,
-                                             m_idleFaceTimeout, m_networkInterface);
+                                             m_idleFaceTimeout, m_networkInterface,
+                                             m_batchSize);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
 
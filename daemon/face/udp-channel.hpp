@@ -50,11 +50,15 @@ public:
    * The created socket is bound to the localEndpoint.
    * reuse_address option is set
    *
+   * \param batchSize maximum number of datagrams received or sent in one system call
+   *                  by the faces of this channel
+   *
    * \throw UdpChannel::Error if bind on the socket fails
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              const shared_ptr<ndn::util::NetworkInterface>& ni,
-             const time::seconds& timeout);
+             const time::seconds& timeout,
+             size_t batchSize = 1);
 
   /**
    * \brief Get number of faces in the channel
@@ -133,6 +137,8 @@ private:
    */
   time::seconds m_idleFaceTimeout;
 
+  size_t m_batchSize;
+
   uint8_t m_inputBuffer[ndn::MAX_NDN_PACKET_SIZE];
 
   shared_ptr<ndn::util::NetworkInterface> m_networkInterface;
@@ -42,6 +42,11 @@ namespace ip = boost::asio::ip;
 
 NFD_LOG_INIT("UdpFactory");
 
+UdpFactory::UdpFactory()
+  : m_batchSize(1)
+{
+}
+
 void
 UdpFactory::prohibitEndpoint(const udp::Endpoint& endpoint)
 {
@@ -112,7 +117,7 @@ UdpFactory::createChannel(const udp::Endpoint& endpoint,
                                 "endpoint is already allocated for a UDP multicast face"));
   }
 
-  channel = make_shared<UdpChannel>(endpoint, ni, timeout);
+  channel = make_shared<UdpChannel>(endpoint, ni, timeout, m_batchSize);
   m_channels[endpoint] = channel;
   prohibitEndpoint(endpoint);
 
@@ -212,7 +217,8 @@ UdpFactory::createMulticastFace(const udp::Endpoint& localEndpoint,
   auto linkService = make_unique<face::GenericLinkService>();
   auto transport = make_unique<face::MulticastUdpTransport>(localEndpoint, multicastEndpoint,
                                                             std::move(receiveSocket),
-                                                            std::move(sendSocket));
+                                                            std::move(sendSocket),
+                                                            m_batchSize);
   face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_multicastFaces[localEndpoint] = face;
@@ -246,7 +252,8 @@ shared_ptr<nfd::face::Face> UdpFactory::createInterfaceFace(short localEndpointP
   // TODO How we handle local address already in use?
 
   auto linkService = make_unique<face::GenericLinkService>();
-  auto transport = make_unique<face::UnicastUdpTransport>(localEndpointPort, remoteEndpoint, ni);
+  auto transport = make_unique<face::UnicastUdpTransport>(localEndpointPort, remoteEndpoint, ni,
+                                                          m_batchSize);
   face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   auto& faces = m_interfaceFaces[ni->getName()];
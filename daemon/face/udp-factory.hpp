@@ -53,6 +53,22 @@ public:
 
   typedef std::map<udp::Endpoint, shared_ptr<Face>> FaceMap;
 
+  UdpFactory();
+
+  /**
+   * \brief Set the maximum number of datagrams received or sent in one system call
+   *        by faces created afterwards
+   *
+   * Existing channels and faces keep their batch size.
+   *
+   * \sa face::DatagramTransport::getBatchSize
+   */
+  void
+  setBatchSize(size_t batchSize);
+
+  size_t
+  getBatchSize() const;
+
   /**
    * \brief Create UDP-based channel using udp::Endpoint
    *
@@ -210,11 +226,24 @@ private:
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
   FaceMap m_multicastFaces;
   std::map<std::string, FaceMap> m_interfaceFaces;
+  size_t m_batchSize;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::set<udp::Endpoint> m_prohibitedEndpoints;
 };
 
+inline void
+UdpFactory::setBatchSize(size_t batchSize)
+{
+  m_batchSize = batchSize;
+}
+
+inline size_t
+UdpFactory::getBatchSize() const
+{
+  return m_batchSize;
+}
+
 inline const UdpFactory::FaceMap&
 UdpFactory::getMulticastFaces() const
 {
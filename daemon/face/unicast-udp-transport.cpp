@@ -42,8 +42,9 @@ NFD_LOG_INCLASS_TEMPLATE_SPECIALIZATION_DEFINE(DatagramTransport, UnicastUdpTran
 UnicastUdpTransport::UnicastUdpTransport(protocol::socket&& socket,
                                          ndn::nfd::FacePersistency persistency,
                                          time::nanoseconds idleTimeout,
-                                         const shared_ptr<ndn::util::NetworkInterface>& ni)
-  : DatagramTransport(std::move(socket)) // TODO what if we don't want to specify a socket?
+                                         const shared_ptr<ndn::util::NetworkInterface>& ni,
+                                         size_t batchSize)
+  : DatagramTransport(std::move(socket), batchSize) // TODO what if we don't want to specify a socket?
   , m_idleTimeout(idleTimeout)
   , m_networkInterface(ni)
   , m_hasAddress(false)
@@ -92,8 +93,9 @@ UnicastUdpTransport::UnicastUdpTransport(protocol::socket&& socket,
 
 UnicastUdpTransport::UnicastUdpTransport(short localEndpointPort,
                                          udp::Endpoint remoteEndpoint,
-                                         const shared_ptr<ndn::util::NetworkInterface>& ni)
-  : DatagramTransport(remoteEndpoint)
+                                         const shared_ptr<ndn::util::NetworkInterface>& ni,
+                                         size_t batchSize)
+  : DatagramTransport(remoteEndpoint, batchSize)
   , m_networkInterface(ni)
   , m_hasAddress(false)
   , m_localEndpointPort(localEndpointPort)
@@ -43,11 +43,13 @@ public:
   UnicastUdpTransport(protocol::socket&& socket,
                       ndn::nfd::FacePersistency persistency,
                       time::nanoseconds idleTimeout,
-                      const shared_ptr<ndn::util::NetworkInterface>& ni);
+                      const shared_ptr<ndn::util::NetworkInterface>& ni,
+                      size_t batchSize = 1);
 
   UnicastUdpTransport(short localEndpointPort,
                       udp::Endpoint remoteEndpoint,
-                      const shared_ptr<ndn::util::NetworkInterface>& ni);
+                      const shared_ptr<ndn::util::NetworkInterface>& ni,
+                      size_t batchSize = 1);
 
   virtual std::string
   getInterfaceName() const DECL_FINAL;
@@ -35,10 +35,12 @@ namespace nfd {
 
 NFD_LOG_INIT("UnixStreamChannel");
 
-UnixStreamChannel::UnixStreamChannel(const unix_stream::Endpoint& endpoint)
+UnixStreamChannel::UnixStreamChannel(const unix_stream::Endpoint& endpoint,
+                                     size_t sendQueueLimit)
   : m_endpoint(endpoint)
   , m_acceptor(getGlobalIoService())
   , m_socket(getGlobalIoService())
+  , m_sendQueueLimit(sendQueueLimit)
 {
   setUri(FaceUri(m_endpoint));
 }
@@ -134,6 +136,7 @@ UnixStreamChannel::handleAccept(const boost::system::error_code& error,
 
   auto linkService = make_unique<face::GenericLinkService>();
   auto transport = make_unique<face::UnixStreamTransport>(std::move(m_socket));
+  transport->setSendQueueLimit(m_sendQueueLimit);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
   onFaceCreated(face);
 
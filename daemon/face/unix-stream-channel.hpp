@@ -55,9 +55,12 @@ public:
    *
    * To enable creation of faces upon incoming connections, one
    * needs to explicitly call UnixStreamChannel::listen method.
+   *
+   * \param sendQueueLimit maximum octets in the send queue of created faces; 0 means unlimited,
+   *                       see face::StreamTransport::setSendQueueLimit
    */
   explicit
-  UnixStreamChannel(const unix_stream::Endpoint& endpoint);
+  UnixStreamChannel(const unix_stream::Endpoint& endpoint, size_t sendQueueLimit = 0);
 
   ~UnixStreamChannel() DECL_OVERRIDE;
 
@@ -92,6 +95,7 @@ private:
   unix_stream::Endpoint m_endpoint;
   boost::asio::local::stream_protocol::acceptor m_acceptor;
   boost::asio::local::stream_protocol::socket m_socket;
+  size_t m_sendQueueLimit;
 };
 
 inline bool
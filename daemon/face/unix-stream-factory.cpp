@@ -29,6 +29,11 @@
 
 namespace nfd {
 
+UnixStreamFactory::UnixStreamFactory()
+  : m_sendQueueLimit(0)
+{
+}
+
 shared_ptr<UnixStreamChannel>
 UnixStreamFactory::createChannel(const std::string& unixSocketPath)
 {
@@ -40,7 +45,7 @@ UnixStreamFactory::createChannel(const std::string& unixSocketPath)
   if (channel)
     return channel;
 
-  channel = make_shared<UnixStreamChannel>(endpoint);
+  channel = make_shared<UnixStreamChannel>(endpoint, m_sendQueueLimit);
   m_channels[endpoint] = channel;
   return channel;
 }
@@ -47,6 +47,22 @@ public:
     }
   };
 
+  UnixStreamFactory();
+
+  /**
+   * \brief Set the maximum octets in the send queue of faces created afterwards
+   *
+   * Existing channels and faces keep their limit.
+   *
+   * \param limit maximum octets; 0 means unlimited
+   * \sa face::StreamTransport::setSendQueueLimit
+   */
+  void
+  setSendQueueLimit(size_t limit);
+
+  size_t
+  getSendQueueLimit() const;
+
   /**
    * \brief Create stream-oriented Unix channel using specified socket path
    *
@@ -84,8 +100,21 @@ private:
 
 private:
   std::map<unix_stream::Endpoint, shared_ptr<UnixStreamChannel>> m_channels;
+  size_t m_sendQueueLimit;
 };
 
+inline void
+UnixStreamFactory::setSendQueueLimit(size_t limit)
+{
+  m_sendQueueLimit = limit;
+}
+
+inline size_t
+UnixStreamFactory::getSendQueueLimit() const
+{
+  return m_sendQueueLimit;
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_FACE_UNIX_STREAM_FACTORY_HPP
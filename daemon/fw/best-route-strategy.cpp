@@ -44,7 +44,7 @@ static inline bool
 predicate_PitEntry_canForwardTo_NextHop(shared_ptr<pit::Entry> pitEntry,
                                         const fib::NextHop& nexthop)
 {
-  return pitEntry->canForwardTo(*nexthop.getFace());
+  return pitEntry->canForwardTo(nexthop.getFace());
 }
 
 void
@@ -67,7 +67,7 @@ BestRouteStrategy::afterReceiveInterest(const Face& inFace,
     return;
   }
 
-  shared_ptr<Face> outFace = it->getFace();
+  shared_ptr<Face> outFace = it->getFace().shared_from_this();
   this->sendInterest(pitEntry, outFace);
 }
 
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "congestion-window.hpp"
+
+namespace nfd {
+namespace fw {
+
+CongestionWindow::Options::Options()
+  : initialWindow(4.0)
+  , minWindow(1.0)
+  , maxWindow(1024.0)
+  , decreaseFactor(0.5)
+{
+}
+
+CongestionWindow::CongestionWindow(const Options& options)
+  : m_options(options)
+{
+  BOOST_ASSERT(m_options.minWindow >= 1.0);
+  BOOST_ASSERT(m_options.minWindow <= m_options.initialWindow);
+  BOOST_ASSERT(m_options.initialWindow <= m_options.maxWindow);
+  BOOST_ASSERT(m_options.decreaseFactor > 0.0 && m_options.decreaseFactor < 1.0);
+  this->reset();
+}
+
+void
+CongestionWindow::reset()
+{
+  m_window = m_options.initialWindow;
+  m_ssthresh = std::numeric_limits<double>::infinity();
+  m_lastDecrease = time::steady_clock::TimePoint::min();
+}
+
+void
+CongestionWindow::increase()
+{
+  if (m_window < m_ssthresh) {
+    m_window += 1.0;
+  }
+  else {
+    m_window += 1.0 / m_window;
+  }
+  m_window = std::min(m_window, m_options.maxWindow);
+}
+
+bool
+CongestionWindow::decrease(const time::steady_clock::TimePoint& sendTime)
+{
+  if (sendTime < m_lastDecrease) {
+    return false;
+  }
+
+  m_window = std::max(m_window * m_options.decreaseFactor, m_options.minWindow);
+  m_ssthresh = m_window;
+  m_lastDecrease = time::steady_clock::now();
+  return true;
+}
+
+} // namespace fw
+} // namespace nfd
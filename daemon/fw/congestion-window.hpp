@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_CONGESTION_WINDOW_HPP
+#define NFD_DAEMON_FW_CONGESTION_WINDOW_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief AIMD congestion window of an upstream face, in Interests
+ *
+ *  Below the slow start threshold, the window grows by one Interest per Data;
+ *  above it, the window grows by about one Interest per window of Data.
+ *  On a timeout or a Congestion Nack, the window is multiplied by decreaseFactor
+ *  and the slow start threshold is set to the new window. The window is decreased
+ *  at most once per round trip: a loss of an Interest sent before the last decrease
+ *  belongs to the same congestion event and is ignored.
+ */
+class CongestionWindow
+{
+public:
+  class Options
+  {
+  public:
+    Options();
+
+  public:
+    double initialWindow;
+    double minWindow;
+    double maxWindow;
+    double decreaseFactor;
+  };
+
+  explicit
+  CongestionWindow(const Options& options = Options());
+
+  /** \return window size in Interests, which is at least minWindow
+   */
+  double
+  getSize() const
+  {
+    return m_window;
+  }
+
+  double
+  getSlowStartThreshold() const
+  {
+    return m_ssthresh;
+  }
+
+  /** \return whether another Interest may be sent when \p nInFlight Interests are in flight
+   */
+  bool
+  canSend(size_t nInFlight) const
+  {
+    return nInFlight < static_cast<size_t>(m_window);
+  }
+
+  /** \brief record a Data arrival
+   */
+  void
+  increase();
+
+  /** \brief record a timeout or a Congestion Nack
+   *  \param sendTime when the lost Interest was last sent
+   *  \return whether the window is decreased
+   */
+  bool
+  decrease(const time::steady_clock::TimePoint& sendTime);
+
+  void
+  reset();
+
+private:
+  Options m_options;
+  double m_window;
+  double m_ssthresh;
+  time::steady_clock::TimePoint m_lastDecrease;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CONGESTION_WINDOW_HPP
@@ -36,6 +36,8 @@ NFD_LOG_INIT("FaceTable");
 FaceTable::FaceTable(Forwarder& forwarder)
   : m_forwarder(forwarder)
   , m_lastFaceId(face::FACEID_RESERVED_MAX)
+  , m_slots(face::FACEID_RESERVED_MAX + 1)
+  , m_nFaces(0)
 {
 }
 
@@ -47,43 +49,61 @@ FaceTable::~FaceTable()
 shared_ptr<Face>
 FaceTable::get(FaceId id) const
 {
-  std::map<FaceId, shared_ptr<Face> >::const_iterator i = m_faces.find(id);
-  return (i == m_faces.end()) ? (shared_ptr<Face>()) : (i->second);
+  if (id <= face::FACEID_RESERVED_MAX) {
+    return m_slots[id];
+  }
+
+  auto it = m_index.find(id);
+  return it == m_index.end() ? nullptr : m_slots[it->second];
 }
 
 size_t
 FaceTable::size() const
 {
-  return m_faces.size();
+  return m_nFaces;
 }
 
 void
 FaceTable::add(shared_ptr<Face> face)
 {
-  if (face->getId() != face::INVALID_FACEID && m_faces.count(face->getId()) > 0) {
+  if (face->getId() != face::INVALID_FACEID && this->get(face->getId()) != nullptr) {
     NFD_LOG_WARN("Trying to add existing face id=" << face->getId() << " to the face table");
     return;
   }
 
   FaceId faceId = ++m_lastFaceId;
   BOOST_ASSERT(faceId > face::FACEID_RESERVED_MAX);
-  this->addImpl(face, faceId);
+
+  size_t index = 0;
+  if (!m_freeSlots.empty()) {
+    index = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else {
+    index = m_slots.size();
+    m_slots.emplace_back();
+  }
+  BOOST_ASSERT(index > face::FACEID_RESERVED_MAX);
+
+  m_index[faceId] = index;
+  this->addImpl(face, faceId, index);
 }
 
 void
 FaceTable::addReserved(shared_ptr<Face> face, FaceId faceId)
 {
   BOOST_ASSERT(face->getId() == face::INVALID_FACEID);
-  BOOST_ASSERT(m_faces.count(face->getId()) == 0);
   BOOST_ASSERT(faceId <= face::FACEID_RESERVED_MAX);
-  this->addImpl(face, faceId);
+  BOOST_ASSERT(m_slots[faceId] == nullptr);
+  this->addImpl(face, faceId, faceId);
 }
 
 void
-FaceTable::addImpl(shared_ptr<Face> face, FaceId faceId)
+FaceTable::addImpl(shared_ptr<Face> face, FaceId faceId, size_t index)
 {
   face->setId(faceId);
-  m_faces[faceId] = face;
+  m_slots[index] = face;
+  ++m_nFaces;
   NFD_LOG_INFO("Added face id=" << faceId << " remote=" << face->getRemoteUri()
                                           << " local=" << face->getLocalUri());
 
@@ -101,7 +121,17 @@ FaceTable::remove(shared_ptr<Face> face)
   this->beforeRemove(face);
 
   FaceId faceId = face->getId();
-  m_faces.erase(faceId);
+  if (faceId <= face::FACEID_RESERVED_MAX) {
+    m_slots[faceId].reset();
+  }
+  else {
+    auto it = m_index.find(faceId);
+    BOOST_ASSERT(it != m_index.end());
+    m_slots[it->second].reset();
+    m_freeSlots.push_back(it->second);
+    m_index.erase(it);
+  }
+  --m_nFaces;
   face->setId(face::INVALID_FACEID);
 
   NFD_LOG_INFO("Removed face id=" << faceId <<
@@ -117,7 +147,8 @@ FaceTable::remove(shared_ptr<Face> face)
 FaceTable::ForwardRange
 FaceTable::getForwardRange() const
 {
-  return m_faces | boost::adaptors::map_values;
+  return m_slots | boost::adaptors::filtered(IsOccupied())
+                 | boost::adaptors::transformed(GetFace());
 }
 
 FaceTable::const_iterator
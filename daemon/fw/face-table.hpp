@@ -27,13 +27,20 @@
 #define NFD_DAEMON_FW_FACE_TABLE_HPP
 
 #include "face/face.hpp"
-#include <boost/range/adaptor/map.hpp>
+#include <boost/range/adaptor/filtered.hpp>
+#include <boost/range/adaptor/transformed.hpp>
+#include <unordered_map>
 
 namespace nfd {
 
 class Forwarder;
 
 /** \brief container of all Faces
+ *
+ *  Faces are stored in a vector of slots; the slot of a removed face is reused by a later
+ *  face, so that the vector stays dense under face churn. FaceIds are assigned
+ *  monotonically and are never reused; a hash index maps each FaceId to its slot.
+ *  Reserved FaceIds occupy the first slots and bypass the index.
  */
 class FaceTable : noncopyable
 {
@@ -57,10 +64,32 @@ public:
   size_t
   size() const;
 
-public: // enumeration
-  typedef std::map<FaceId, shared_ptr<Face>> FaceMap;
+private:
+  typedef std::vector<shared_ptr<Face>> SlotTable;
+
+  struct IsOccupied
+  {
+    bool
+    operator()(const shared_ptr<Face>& face) const
+    {
+      return face != nullptr;
+    }
+  };
+
+  struct GetFace
+  {
+    typedef const shared_ptr<Face>& result_type;
+
+    result_type
+    operator()(const shared_ptr<Face>& face) const
+    {
+      return face;
+    }
+  };
 
-  typedef boost::select_second_const_range<FaceMap> ForwardRange;
+public: // enumeration
+  typedef boost::transformed_range<GetFace,
+            const boost::filtered_range<IsOccupied, const SlotTable>> ForwardRange;
 
   /** \brief ForwardIterator for shared_ptr<Face>
    */
@@ -85,7 +114,7 @@ public: // signals
 
 private:
   void
-  addImpl(shared_ptr<Face> face, FaceId faceId);
+  addImpl(shared_ptr<Face> face, FaceId faceId, size_t index);
 
   void
   remove(shared_ptr<Face> face);
@@ -96,7 +125,10 @@ private:
 private:
   Forwarder& m_forwarder;
   FaceId m_lastFaceId;
-  FaceMap m_faces;
+  SlotTable m_slots;
+  std::vector<size_t> m_freeSlots; ///< indexes of reusable slots, used as a stack
+  std::unordered_map<FaceId, size_t> m_index; ///< FaceId => slot, except reserved FaceIds
+  size_t m_nFaces;
 };
 
 } // namespace nfd
@@ -45,8 +45,13 @@ Forwarder::Forwarder()
   , m_pit(m_nameTree)
   , m_measurements(m_nameTree)
   , m_strategyChoice(m_nameTree, fw::makeDefaultStrategy(*this))
+  , m_linkCache(m_fib, m_networkRegionTable)
 {
   fw::installStrategies(*this);
+
+  m_faceTable.beforeRemove.connect([this] (shared_ptr<Face> face) {
+    m_pit.getQuota().removeFace(face->getId());
+  });
 }
 
 Forwarder::~Forwarder()
@@ -121,6 +126,15 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     return;
   }
 
+  // PIT overload protection, before anything is allocated in NameTree
+  PitQuota::RejectReason rejectReason = m_pit.getQuota().check(interest.getName(), inFace.getId(),
+                                                               m_pit.size());
+  if (rejectReason != PitQuota::REJECT_NONE && m_pit.find(interest) == nullptr) {
+    // goto Interest over quota pipeline
+    this->onInterestOverQuota(inFace, interest, rejectReason);
+    return;
+  }
+
   // PIT insert
   shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
 
@@ -173,6 +187,31 @@ Forwarder::onInterestLoop(Face& inFace, const Interest& interest,
   inFace.sendNack(nack);
 }
 
+void
+Forwarder::onInterestOverQuota(Face& inFace, const Interest& interest,
+                               PitQuota::RejectReason reason)
+{
+  m_pit.getQuota().recordReject(reason, inFace.getId());
+
+  // if multi-access face, drop
+  if (inFace.getLinkType() == ndn::nfd::LINK_TYPE_MULTI_ACCESS) {
+    NFD_LOG_DEBUG("onInterestOverQuota face=" << inFace.getId() <<
+                  " interest=" << interest.getName() <<
+                  " reason=" << reason << " drop");
+    return;
+  }
+
+  NFD_LOG_DEBUG("onInterestOverQuota face=" << inFace.getId() <<
+                " interest=" << interest.getName() <<
+                " reason=" << reason << " send-Nack-congestion");
+
+  // send Nack with reason=CONGESTION
+  // note: Don't enter outgoing Nack pipeline because it needs an in-record.
+  lp::Nack nack(interest);
+  nack.setReason(lp::NackReason::CONGESTION);
+  inFace.sendNack(nack);
+}
+
 void
 Forwarder::onContentStoreMiss(const Face& inFace,
                               shared_ptr<pit::Entry> pitEntry,
@@ -180,13 +219,6 @@ Forwarder::onContentStoreMiss(const Face& inFace,
 {
   NFD_LOG_DEBUG("onContentStoreMiss interest=" << interest.getName());
 
-  shared_ptr<Face> face = const_pointer_cast<Face>(inFace.shared_from_this());
-  // insert InRecord
-  pitEntry->insertOrUpdateInRecord(face, interest);
-
-  // set PIT unsatisfy timer
-  this->setUnsatisfyTimer(pitEntry);
-
   shared_ptr<fib::Entry> fibEntry;
   // has Link object?
   if (!interest.hasLink()) {
@@ -195,10 +227,10 @@ Forwarder::onContentStoreMiss(const Face& inFace,
     NFD_LOG_TRACE("onContentStoreMiss noLinkObject");
   }
   else {
-    const Link& link = interest.getLink();
+    const LinkCache::Result& linkResult = m_linkCache.evaluate(interest.getLink());
 
     // in producer region?
-    if (m_networkRegionTable.isInProducerRegion(link)) {
+    if (linkResult.isInProducerRegion) {
       // FIB lookup with Interest name
       fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
       NFD_LOG_TRACE("onContentStoreMiss inProducerRegion");
@@ -210,23 +242,14 @@ Forwarder::onContentStoreMiss(const Face& inFace,
       NFD_LOG_TRACE("onContentStoreMiss hasSelectedDelegation=" << interest.getSelectedDelegation());
     }
     else {
-      // FIB lookup with first delegation Name
-      fibEntry = m_fib.findLongestPrefixMatch(link.getDelegations().begin()->second);
-
-      // in default-free zone?
-      bool isDefaultFreeZone = !(fibEntry->getPrefix().size() == 0 && fibEntry->hasNextHops());
-      if (isDefaultFreeZone) {
-        // choose and set SelectedDelegation
-        for (const std::pair<uint32_t, Name>& delegation : link.getDelegations()) {
-          const Name& delegationName = delegation.second;
-          fibEntry = m_fib.findLongestPrefixMatch(delegationName);
-          if (fibEntry->hasNextHops()) {
-            const_cast<Interest&>(interest).setSelectedDelegation(delegationName);
-            NFD_LOG_TRACE("onContentStoreMiss enterDefaultFreeZone"
-                          << " setSelectedDelegation=" << delegationName);
-            break;
-          }
-        }
+      // FIB lookup with delegation chosen by LinkCache
+      fibEntry = linkResult.fibEntry;
+
+      // entering default-free zone?
+      if (!linkResult.selectedDelegation.empty()) {
+        const_cast<Interest&>(interest).setSelectedDelegation(linkResult.selectedDelegation);
+        NFD_LOG_TRACE("onContentStoreMiss enterDefaultFreeZone"
+                      << " setSelectedDelegation=" << linkResult.selectedDelegation);
       }
       else {
         NFD_LOG_TRACE("onContentStoreMiss inConsumerRegion");
@@ -234,6 +257,13 @@ Forwarder::onContentStoreMiss(const Face& inFace,
     }
   }
 
+  // insert InRecord, after SelectedDelegation is set because the in-record keeps the wire
+  shared_ptr<Face> face = const_pointer_cast<Face>(inFace.shared_from_this());
+  pitEntry->insertOrUpdateInRecord(face, interest);
+
+  // set PIT unsatisfy timer
+  this->setUnsatisfyTimer(pitEntry);
+
   // dispatch to strategy
   BOOST_ASSERT(fibEntry != nullptr);
   this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
@@ -307,13 +337,17 @@ Forwarder::onOutgoingInterest(shared_ptr<pit::Entry> pitEntry, Face& outFace,
   pit::InRecordCollection::const_iterator pickedInRecord = std::max_element(
     inRecords.begin(), inRecords.end(), bind(&compare_pickInterest, _1, _2, &outFace));
   BOOST_ASSERT(pickedInRecord != inRecords.end());
-  shared_ptr<Interest> interest = const_pointer_cast<Interest>(
-    pickedInRecord->getInterest().shared_from_this());
+  const Interest* interest = &pickedInRecord->getInterest();
 
+  shared_ptr<Interest> interestWithNewNonce;
   if (wantNewNonce) {
-    interest = make_shared<Interest>(*interest);
+    // decode from a copy of the wire, because setNonce writes the Nonce in place
+    const Block& wire = pickedInRecord->getInterestWire();
+    interestWithNewNonce = make_shared<Interest>(Block(wire.wire(), wire.size()));
+    interestWithNewNonce->setTag(interest->getTag<lp::IncomingFaceIdTag>());
     static boost::random::uniform_int_distribution<uint32_t> dist;
-    interest->setNonce(dist(getGlobalRng()));
+    interestWithNewNonce->setNonce(dist(getGlobalRng()));
+    interest = interestWithNewNonce.get();
   }
 
   // insert OutRecord
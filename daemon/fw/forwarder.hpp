@@ -30,6 +30,8 @@
 #include "core/scheduler.hpp"
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
+#include "link-cache.hpp"
+#include "retx-timer-wheel.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
 #include "table/cs.hpp"
@@ -123,6 +125,12 @@ public: // forwarding entrypoints and tables
   NetworkRegionTable&
   getNetworkRegionTable();
 
+public: // strategy support
+  /** \brief timer wheel that runs retransmission timers of all strategies
+   */
+  fw::RetxTimerWheel&
+  getRetxTimerWheel();
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief incoming Interest pipeline
    */
@@ -135,6 +143,15 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   onInterestLoop(Face& inFace, const Interest& interest,
                  shared_ptr<pit::Entry> pitEntry);
 
+  /** \brief Interest over quota pipeline
+   *
+   *  Invoked when a new PIT entry would exceed PitQuota.
+   *  The Interest is rejected with a Nack, or dropped if inFace is multi-access.
+   */
+  VIRTUAL_WITH_TESTS void
+  onInterestOverQuota(Face& inFace, const Interest& interest,
+                      PitQuota::RejectReason reason);
+
   /** \brief Content Store miss pipeline
   */
   VIRTUAL_WITH_TESTS void
@@ -230,6 +247,9 @@ private:
 
   FaceTable m_faceTable;
 
+  // declared before m_strategyChoice, so that it outlives the strategies
+  fw::RetxTimerWheel m_retxTimerWheel;
+
   // tables
   NameTree           m_nameTree;
   Fib                m_fib;
@@ -240,6 +260,8 @@ private:
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
 
+  LinkCache m_linkCache;
+
   static const Name LOCALHOST_NAME;
 
   // allow Strategy (base class) to enter pipelines
@@ -318,6 +340,12 @@ Forwarder::getNetworkRegionTable()
   return m_networkRegionTable;
 }
 
+inline fw::RetxTimerWheel&
+Forwarder::getRetxTimerWheel()
+{
+  return m_retxTimerWheel;
+}
+
 #ifdef WITH_TESTS
 inline void
 Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> trigger)
@@ -0,0 +1,289 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "interest-scheduler.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("InterestScheduler");
+
+const int InterestScheduler::DEFAULT_PRIORITY_CLASS = 1;
+
+InterestScheduler::InterestScheduler(const SendInterest& sendInterest)
+  : m_sendInterest(sendInterest)
+  , m_rate(0)
+  , m_burst(1)
+  , m_nextSeqNo(0)
+{
+}
+
+void
+InterestScheduler::setRate(double rate, size_t burst)
+{
+  if (rate < 0) {
+    BOOST_THROW_EXCEPTION(Error("Rate must not be negative"));
+  }
+  if (burst == 0) {
+    BOOST_THROW_EXCEPTION(Error("Burst must be at least 1"));
+  }
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (m_rate > 0) {
+    for (auto& faceAndQueue : m_queues) {
+      this->refill(faceAndQueue.second, now);
+    }
+  }
+
+  m_rate = rate;
+  m_burst = burst;
+
+  if (m_rate > 0) {
+    for (auto& faceAndQueue : m_queues) {
+      faceAndQueue.second.tokens = std::min(faceAndQueue.second.tokens, static_cast<double>(m_burst));
+    }
+    return;
+  }
+
+  // unlimited: flush all queues
+  for (auto& faceAndQueue : m_queues) {
+    FaceQueue& queue = faceAndQueue.second;
+    shared_ptr<Face> face = queue.face.lock();
+    for (; !queue.items.empty(); queue.items.pop()) {
+      shared_ptr<pit::Entry> pitEntry = queue.items.top().pitEntry.lock();
+      if (face != nullptr && pitEntry != nullptr) {
+        this->send(pitEntry, face, queue.items.top().expectedRtt, now);
+      }
+    }
+  }
+  m_queues.clear();
+}
+
+void
+InterestScheduler::setPriorityClass(const Name& prefix, int priorityClass)
+{
+  m_priorityClasses[prefix] = priorityClass;
+}
+
+void
+InterestScheduler::clearPriorityClasses()
+{
+  m_priorityClasses.clear();
+}
+
+int
+InterestScheduler::getPriorityClass(const Name& name) const
+{
+  if (m_priorityClasses.empty()) {
+    return DEFAULT_PRIORITY_CLASS;
+  }
+
+  for (size_t prefixLen = name.size() + 1; prefixLen > 0; --prefixLen) {
+    auto it = m_priorityClasses.find(name.getPrefix(prefixLen - 1));
+    if (it != m_priorityClasses.end()) {
+      return it->second;
+    }
+  }
+  return DEFAULT_PRIORITY_CLASS;
+}
+
+void
+InterestScheduler::schedule(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace,
+                            const time::nanoseconds& expectedRtt)
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (m_rate <= 0) {
+    this->send(pitEntry, outFace, expectedRtt, now);
+    return;
+  }
+
+  FaceId faceId = outFace->getId();
+  auto it = m_queues.find(faceId);
+  if (it == m_queues.end()) {
+    it = m_queues.emplace(std::piecewise_construct, std::forward_as_tuple(faceId),
+                          std::forward_as_tuple(outFace, static_cast<double>(m_burst))).first;
+  }
+  FaceQueue& queue = it->second;
+  this->refill(queue, now);
+
+  if (queue.items.empty() && queue.tokens >= 1) {
+    if (this->send(pitEntry, outFace, expectedRtt, now) == SENT) {
+      queue.tokens -= 1;
+    }
+    return;
+  }
+
+  QueueItem item;
+  item.deadline = getDeadline(*pitEntry);
+  if (item.deadline == time::steady_clock::TimePoint()) {
+    return;
+  }
+  if (now + expectedRtt > item.deadline) {
+    ++m_counters.nDeadlineMissed;
+    NFD_LOG_DEBUG(pitEntry->getName() << " to=" << faceId << " deadline-missed on enqueue");
+    return;
+  }
+
+  item.pitEntry = pitEntry;
+  item.priorityClass = this->getPriorityClass(pitEntry->getName());
+  item.expectedRtt = expectedRtt;
+  item.seqNo = m_nextSeqNo++;
+  queue.items.push(item);
+
+  this->scheduleDequeue(faceId, queue);
+}
+
+size_t
+InterestScheduler::getQueueLength(FaceId faceId) const
+{
+  auto it = m_queues.find(faceId);
+  return it == m_queues.end() ? 0 : it->second.items.size();
+}
+
+size_t
+InterestScheduler::getQueueLength() const
+{
+  size_t length = 0;
+  for (const auto& faceAndQueue : m_queues) {
+    length += faceAndQueue.second.items.size();
+  }
+  return length;
+}
+
+void
+InterestScheduler::removeFace(FaceId faceId)
+{
+  m_queues.erase(faceId);
+}
+
+bool
+InterestScheduler::QueueItemCompare::operator()(const QueueItem& a, const QueueItem& b) const
+{
+  // priority_queue puts the greatest element on top, so "less" means "sent later"
+  if (a.priorityClass != b.priorityClass) {
+    return a.priorityClass > b.priorityClass;
+  }
+  if (a.deadline != b.deadline) {
+    return a.deadline > b.deadline;
+  }
+  return a.seqNo > b.seqNo;
+}
+
+InterestScheduler::FaceQueue::FaceQueue(const shared_ptr<Face>& face, double tokens)
+  : face(face)
+  , tokens(tokens)
+  , lastRefill(time::steady_clock::now())
+  , isDequeueScheduled(false)
+{
+}
+
+void
+InterestScheduler::refill(FaceQueue& queue, const time::steady_clock::TimePoint& now) const
+{
+  double elapsed = time::duration_cast<time::nanoseconds>(now - queue.lastRefill).count() / 1e9;
+  queue.tokens = std::min(static_cast<double>(m_burst), queue.tokens + elapsed * m_rate);
+  queue.lastRefill = now;
+}
+
+void
+InterestScheduler::dequeue(FaceId faceId)
+{
+  auto it = m_queues.find(faceId);
+  if (it == m_queues.end()) {
+    return;
+  }
+  FaceQueue& queue = it->second;
+  queue.isDequeueScheduled = false;
+
+  shared_ptr<Face> face = queue.face.lock();
+  if (face == nullptr) {
+    m_queues.erase(it);
+    return;
+  }
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  this->refill(queue, now);
+  while (!queue.items.empty() && queue.tokens >= 1) {
+    QueueItem item = queue.items.top();
+    queue.items.pop();
+
+    shared_ptr<pit::Entry> pitEntry = item.pitEntry.lock();
+    if (pitEntry != nullptr &&
+        this->send(pitEntry, face, item.expectedRtt, now) == SENT) {
+      queue.tokens -= 1;
+    }
+  }
+
+  this->scheduleDequeue(faceId, queue);
+}
+
+void
+InterestScheduler::scheduleDequeue(FaceId faceId, FaceQueue& queue)
+{
+  if (queue.items.empty() || queue.isDequeueScheduled) {
+    return;
+  }
+
+  double wait = std::max(0.0, (1 - queue.tokens) / m_rate);
+  queue.dequeueEvent = scheduler::schedule(time::nanoseconds(static_cast<int64_t>(std::ceil(wait * 1e9))),
+                                           bind(&InterestScheduler::dequeue, this, faceId));
+  queue.isDequeueScheduled = true;
+}
+
+InterestScheduler::SendResult
+InterestScheduler::send(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace,
+                        const time::nanoseconds& expectedRtt, const time::steady_clock::TimePoint& now)
+{
+  time::steady_clock::TimePoint deadline = getDeadline(*pitEntry);
+  if (deadline == time::steady_clock::TimePoint()) {
+    return GONE;
+  }
+
+  // without a rate limit, the Interest is not delayed by the scheduler
+  if (m_rate > 0 && now + expectedRtt > deadline) {
+    ++m_counters.nDeadlineMissed;
+    NFD_LOG_DEBUG(pitEntry->getName() << " to=" << outFace->getId() << " deadline-missed");
+    return DEADLINE_MISSED;
+  }
+
+  m_sendInterest(pitEntry, outFace);
+  ++m_counters.nSent;
+  return SENT;
+}
+
+time::steady_clock::TimePoint
+InterestScheduler::getDeadline(const pit::Entry& pitEntry)
+{
+  time::steady_clock::TimePoint deadline;
+  for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
+    deadline = std::max(deadline, inRecord.getExpiry());
+  }
+  return deadline;
+}
+
+} // namespace fw
+} // namespace nfd
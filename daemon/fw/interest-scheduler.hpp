@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_INTEREST_SCHEDULER_HPP
+#define NFD_DAEMON_FW_INTEREST_SCHEDULER_HPP
+
+#include "face/face.hpp"
+#include "table/pit-entry.hpp"
+#include "core/counter.hpp"
+#include "core/scheduler.hpp"
+
+#include <queue>
+
+namespace nfd {
+namespace fw {
+
+/** \brief per-face outgoing Interest scheduler
+ *
+ *  Interests are sent to each face at no more than a configured rate, which should match
+ *  the uplink capacity. Interests that exceed the rate wait in a per-face queue, ordered
+ *  first by the priority class of their Name, and then by deadline, which is the latest
+ *  expiry of the in-records of their PIT entry.
+ *
+ *  An Interest is dropped instead of sent if its deadline comes before the time it would
+ *  be sent plus the expected RTT of the face, because its Data could not arrive in time.
+ *  When the rate is unlimited, every Interest is sent immediately and none is dropped.
+ *
+ *  Counters and queue lengths of all schedulers are reported in ForwarderStatus.
+ */
+class InterestScheduler : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  typedef function<void(const shared_ptr<pit::Entry>& pitEntry,
+                        const shared_ptr<Face>& outFace)> SendInterest;
+
+  class Counters
+  {
+  public:
+    PacketCounter nSent;
+
+    /// Interests dropped because their deadline would be missed
+    PacketCounter nDeadlineMissed;
+  };
+
+  /** \param sendInterest invoked to send an Interest when it is scheduled
+   */
+  explicit
+  InterestScheduler(const SendInterest& sendInterest);
+
+  /** \brief set the send rate of every face
+   *  \param rate Interests per second, 0 for unlimited
+   *  \param burst number of Interests that can be sent back-to-back, at least 1
+   *  \throw Error rate is negative or burst is zero
+   */
+  void
+  setRate(double rate, size_t burst = 1);
+
+  double
+  getRate() const
+  {
+    return m_rate;
+  }
+
+  size_t
+  getBurst() const
+  {
+    return m_burst;
+  }
+
+  /** \brief set priority class of Interests under \p prefix
+   *
+   *  Lower values are sent first. Names without a priority class have DEFAULT_PRIORITY_CLASS.
+   */
+  void
+  setPriorityClass(const Name& prefix, int priorityClass);
+
+  void
+  clearPriorityClasses();
+
+  /** \return priority class of the longest prefix of \p name that has one,
+   *          or DEFAULT_PRIORITY_CLASS
+   */
+  int
+  getPriorityClass(const Name& name) const;
+
+  /** \brief send the Interest of \p pitEntry to \p outFace, now or when the face has capacity
+   *  \param expectedRtt expected time between sending the Interest and the Data arrival
+   */
+  void
+  schedule(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace,
+           const time::nanoseconds& expectedRtt);
+
+  /** \return number of Interests waiting for \p faceId
+   */
+  size_t
+  getQueueLength(FaceId faceId) const;
+
+  /** \return number of Interests waiting for all faces
+   */
+  size_t
+  getQueueLength() const;
+
+  /** \brief discard the queue of a face
+   */
+  void
+  removeFace(FaceId faceId);
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
+public:
+  static const int DEFAULT_PRIORITY_CLASS;
+
+private:
+  class QueueItem
+  {
+  public:
+    weak_ptr<pit::Entry> pitEntry;
+    int priorityClass;
+    time::steady_clock::TimePoint deadline;
+    time::nanoseconds expectedRtt;
+    uint64_t seqNo; ///< keeps FIFO order among equal keys
+  };
+
+  /** \brief orders the QueueItem that should be sent first at the top of a priority_queue
+   */
+  class QueueItemCompare
+  {
+  public:
+    bool
+    operator()(const QueueItem& a, const QueueItem& b) const;
+  };
+
+  class FaceQueue
+  {
+  public:
+    FaceQueue(const shared_ptr<Face>& face, double tokens);
+
+  public:
+    weak_ptr<Face> face;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, QueueItemCompare> items;
+    double tokens;
+    time::steady_clock::TimePoint lastRefill;
+    scheduler::ScopedEventId dequeueEvent;
+    bool isDequeueScheduled;
+  };
+
+  /** \brief add tokens for the time elapsed since last refill
+   */
+  void
+  refill(FaceQueue& queue, const time::steady_clock::TimePoint& now) const;
+
+  /** \brief send queued Interests while there are tokens, then wait for the next token
+   */
+  void
+  dequeue(FaceId faceId);
+
+  /** \brief schedule dequeue when the next token is available, if the queue is not empty
+   */
+  void
+  scheduleDequeue(FaceId faceId, FaceQueue& queue);
+
+  enum SendResult {
+    SENT,
+    DEADLINE_MISSED,
+    GONE ///< PIT entry is deleted or satisfied
+  };
+
+  SendResult
+  send(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace,
+       const time::nanoseconds& expectedRtt, const time::steady_clock::TimePoint& now);
+
+  /** \return the latest in-record expiry, or a default-constructed TimePoint if there is none
+   */
+  static time::steady_clock::TimePoint
+  getDeadline(const pit::Entry& pitEntry);
+
+private:
+  SendInterest m_sendInterest;
+  double m_rate;
+  size_t m_burst;
+  std::map<Name, int> m_priorityClasses;
+  std::unordered_map<FaceId, FaceQueue> m_queues;
+  uint64_t m_nextSeqNo;
+  Counters m_counters;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_INTEREST_SCHEDULER_HPP
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "interface-weights.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+namespace nfd {
+namespace fw {
+
+InterfaceWeights::InterfaceWeights(const WeightMap& weights)
+  : m_defaults(weights)
+  , m_weights(weights)
+{
+}
+
+void
+InterfaceWeights::setDefaults(const WeightMap& weights)
+{
+  m_defaults = weights;
+  this->assign(weights);
+}
+
+void
+InterfaceWeights::reset()
+{
+  this->assign(m_defaults);
+}
+
+void
+InterfaceWeights::assign(const WeightMap& weights)
+{
+  m_weights = weights;
+  m_faceWeights.clear();
+}
+
+void
+InterfaceWeights::set(const std::string& interfaceName, int weight)
+{
+  m_weights[interfaceName] = weight;
+  m_faceWeights.clear();
+}
+
+int
+InterfaceWeights::get(const std::string& interfaceName) const
+{
+  auto it = m_weights.find(interfaceName);
+  return it == m_weights.end() ? 0 : it->second;
+}
+
+int
+InterfaceWeights::getFaceWeight(const Face& face) const
+{
+  FaceId id = face.getId();
+  if (id == INVALID_FACEID) {
+    return this->get(face.getInterfaceName());
+  }
+
+  auto it = m_faceWeights.find(id);
+  if (it == m_faceWeights.end()) {
+    it = m_faceWeights.emplace(id, this->get(face.getInterfaceName())).first;
+  }
+  return it->second;
+}
+
+void
+InterfaceWeights::removeFace(FaceId faceId)
+{
+  m_faceWeights.erase(faceId);
+}
+
+InterfaceWeights::WeightMap
+InterfaceWeights::parse(const std::string& input)
+{
+  WeightMap weights;
+
+  std::vector<std::string> items;
+  boost::split(items, input, boost::is_any_of(","));
+  for (std::string& item : items) {
+    boost::trim(item);
+    if (item.empty()) {
+      continue;
+    }
+
+    size_t pos = item.find('=');
+    if (pos == std::string::npos || pos == 0) {
+      BOOST_THROW_EXCEPTION(Error("Malformed interface weight \"" + item + "\""));
+    }
+
+    std::string interfaceName = boost::trim_copy(item.substr(0, pos));
+    try {
+      weights[interfaceName] = boost::lexical_cast<int>(boost::trim_copy(item.substr(pos + 1)));
+    }
+    catch (const boost::bad_lexical_cast&) {
+      BOOST_THROW_EXCEPTION(Error("Invalid weight for interface \"" + interfaceName + "\""));
+    }
+  }
+
+  return weights;
+}
+
+} // namespace fw
+} // namespace nfd
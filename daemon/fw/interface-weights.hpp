@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_INTERFACE_WEIGHTS_HPP
+#define NFD_DAEMON_FW_INTERFACE_WEIGHTS_HPP
+
+#include "face/face.hpp"
+
+#include <unordered_map>
+
+namespace nfd {
+namespace fw {
+
+/** \brief maps network interface names to weights, for strategies that select upstreams
+ *         according to the interface of a face
+ *
+ *  Interfaces without an assigned weight have weight zero. The weights given at
+ *  construction or to setDefaults are the built-in weights of the strategy, which are
+ *  restored by reset.
+ *
+ *  Weights are looked up per Interest, so the weight of each face is cached by FaceId.
+ *  The interface name of a face does not change, so the cache is cleared only when
+ *  weights are updated; the owner calls removeFace when a face is removed.
+ */
+class InterfaceWeights : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  typedef std::map<std::string /*interfaceName*/, int> WeightMap;
+
+  /** \param weights built-in weights, which are also the initial weights
+   */
+  explicit
+  InterfaceWeights(const WeightMap& weights = WeightMap());
+
+  /** \brief replace built-in weights, and make them the current weights
+   */
+  void
+  setDefaults(const WeightMap& weights);
+
+  /** \brief restore built-in weights
+   */
+  void
+  reset();
+
+  /** \brief replace all weights
+   */
+  void
+  assign(const WeightMap& weights);
+
+  /** \brief set weight of one interface, keeping other weights
+   */
+  void
+  set(const std::string& interfaceName, int weight);
+
+  /** \return weight of an interface
+   */
+  int
+  get(const std::string& interfaceName) const;
+
+  /** \return weight of the interface of \p face
+   */
+  int
+  getFaceWeight(const Face& face) const;
+
+  /** \brief forget the cached weight of a removed face
+   */
+  void
+  removeFace(FaceId faceId);
+
+  const WeightMap&
+  getWeights() const;
+
+  /** \brief parse weights in the format "eth0=2,wlan0=1"
+   *  \throw Error input is malformed
+   */
+  static WeightMap
+  parse(const std::string& input);
+
+private:
+  WeightMap m_defaults;
+  WeightMap m_weights;
+
+  mutable std::unordered_map<FaceId, int> m_faceWeights;
+};
+
+inline const InterfaceWeights::WeightMap&
+InterfaceWeights::getWeights() const
+{
+  return m_weights;
+}
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_INTERFACE_WEIGHTS_HPP
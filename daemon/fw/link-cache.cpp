@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "link-cache.hpp"
+
+namespace nfd {
+
+const size_t LinkCache::DEFAULT_CAPACITY = 4096;
+
+LinkCache::LinkCache(const Fib& fib, const NetworkRegionTable& networkRegionTable,
+                     size_t capacity)
+  : m_fib(fib)
+  , m_networkRegionTable(networkRegionTable)
+  , m_capacity(capacity)
+  , m_fibVersion(fib.getVersion())
+  , m_networkRegionTableVersion(networkRegionTable.getVersion())
+{
+}
+
+const LinkCache::Result&
+LinkCache::evaluate(const Link& link)
+{
+  if (m_fibVersion != m_fib.getVersion() ||
+      m_networkRegionTableVersion != m_networkRegionTable.getVersion()) {
+    m_results.clear();
+    m_fibVersion = m_fib.getVersion();
+    m_networkRegionTableVersion = m_networkRegionTable.getVersion();
+  }
+
+  // getFullName computes the implicit digest once, and caches it in the Link object
+  const name::Component& digest = link.getFullName().get(-1);
+  std::string key(reinterpret_cast<const char*>(digest.value()), digest.value_size());
+
+  auto it = m_results.find(key);
+  if (it != m_results.end()) {
+    return it->second;
+  }
+
+  if (m_results.size() >= m_capacity) {
+    m_results.clear();
+  }
+  return m_results.emplace(std::move(key), this->evaluateUncached(link)).first->second;
+}
+
+LinkCache::Result
+LinkCache::evaluateUncached(const Link& link) const
+{
+  Result res;
+  res.isInProducerRegion = m_networkRegionTable.isInProducerRegion(link);
+  if (res.isInProducerRegion) {
+    return res;
+  }
+
+  // FIB lookup with first delegation Name
+  res.fibEntry = m_fib.findLongestPrefixMatch(link.getDelegations().begin()->second);
+
+  // in default-free zone?
+  bool isDefaultFreeZone = !(res.fibEntry->getPrefix().size() == 0 && res.fibEntry->hasNextHops());
+  if (isDefaultFreeZone) {
+    // choose SelectedDelegation
+    for (const std::pair<uint32_t, Name>& delegation : link.getDelegations()) {
+      const Name& delegationName = delegation.second;
+      res.fibEntry = m_fib.findLongestPrefixMatch(delegationName);
+      if (res.fibEntry->hasNextHops()) {
+        res.selectedDelegation = delegationName;
+        break;
+      }
+    }
+  }
+  return res;
+}
+
+} // namespace nfd
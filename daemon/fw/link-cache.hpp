@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_LINK_CACHE_HPP
+#define NFD_DAEMON_FW_LINK_CACHE_HPP
+
+#include "table/fib.hpp"
+#include "table/network-region-table.hpp"
+
+namespace nfd {
+
+/** \brief caches the forwarding decision for Link objects
+ *
+ *  Evaluating a Link object requires a NetworkRegionTable lookup and, outside the producer
+ *  region, up to one FIB longest prefix match per delegation. Consumers usually attach the
+ *  same Link to many Interests, so the result is cached by the implicit digest of the Link.
+ *
+ *  The cache is flushed whenever FIB or NetworkRegionTable changes, as indicated by
+ *  their version numbers. It is also flushed when it reaches its capacity.
+ */
+class LinkCache : noncopyable
+{
+public:
+  /** \brief outcome of evaluating a Link object
+   */
+  struct Result
+  {
+    /** \brief whether the Interest has reached a producer region
+     *
+     *  If true, the Interest should be forwarded according to its Name,
+     *  and other fields are unused.
+     */
+    bool isInProducerRegion;
+
+    /** \brief FIB entry to use when Interest does not carry a SelectedDelegation
+     */
+    shared_ptr<fib::Entry> fibEntry;
+
+    /** \brief SelectedDelegation to set on the Interest when entering default-free zone
+     *
+     *  This is empty if SelectedDelegation should not be set.
+     */
+    Name selectedDelegation;
+  };
+
+  LinkCache(const Fib& fib, const NetworkRegionTable& networkRegionTable,
+            size_t capacity = DEFAULT_CAPACITY);
+
+  /** \brief evaluate a Link object, or return the cached result
+   *  \return a reference that is valid until the next call
+   */
+  const Result&
+  evaluate(const Link& link);
+
+  size_t
+  size() const;
+
+public:
+  static const size_t DEFAULT_CAPACITY;
+
+private:
+  Result
+  evaluateUncached(const Link& link) const;
+
+private:
+  const Fib& m_fib;
+  const NetworkRegionTable& m_networkRegionTable;
+  size_t m_capacity;
+
+  uint64_t m_fibVersion;
+  uint64_t m_networkRegionTableVersion;
+
+  /// Link implicit digest => result
+  std::unordered_map<std::string, Result> m_results;
+};
+
+inline size_t
+LinkCache::size() const
+{
+  return m_results.size();
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_LINK_CACHE_HPP
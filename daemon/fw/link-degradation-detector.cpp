@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "link-degradation-detector.hpp"
+
+namespace nfd {
+namespace fw {
+
+/// weight of a new RTT sample in smoothed RTT
+static const double RTT_SAMPLE_WEIGHT = 0.25;
+
+/// RTT inflation is not evaluated until the minimum RTT is based on this many samples
+static const size_t MIN_RTT_SAMPLES = 4;
+
+/// weight of a new interval in the average number of Data per rate interval
+static const double RATE_SAMPLE_WEIGHT = 0.25;
+
+/// delivery rate drop is not evaluated when fewer Data are expected in a rate interval
+static const double MIN_EXPECTED_DELIVERIES = 4;
+
+LinkDegradationDetector::Options::Options()
+  : rttInflationFactor(3.0)
+  , minRttInflation(50)
+  , maxConsecutiveTimeouts(3)
+  , deliveryRateDropFactor(0.25)
+  , rateInterval(250)
+{
+}
+
+LinkDegradationDetector::LinkDegradationDetector(const Options& options)
+  : m_options(options)
+{
+  this->reset();
+}
+
+void
+LinkDegradationDetector::reset()
+{
+  m_reason = NONE;
+  m_lastData = time::steady_clock::now();
+  m_nConsecutiveTimeouts = 0;
+  m_minRtt = -1;
+  m_sRtt = -1;
+  m_nRttSamples = 0;
+  m_rateIntervalStart = m_lastData;
+  m_nSentInInterval = 0;
+  m_nDataInInterval = 0;
+  m_avgDelivered = -1;
+}
+
+bool
+LinkDegradationDetector::afterSendInterest(bool isRetransmission)
+{
+  bool wasDegraded = this->isDegraded();
+  this->updateDeliveryRate(time::steady_clock::now());
+  ++m_nSentInInterval;
+
+  if (isRetransmission && ++m_nConsecutiveTimeouts >= m_options.maxConsecutiveTimeouts) {
+    this->setDegraded(CONSECUTIVE_TIMEOUTS);
+  }
+  return !wasDegraded && this->isDegraded();
+}
+
+bool
+LinkDegradationDetector::afterReceiveData(const time::nanoseconds& rtt, bool isAmbiguous)
+{
+  bool wasDegraded = this->isDegraded();
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  this->updateDeliveryRate(now);
+  ++m_nDataInInterval;
+  m_lastData = now;
+  m_nConsecutiveTimeouts = 0;
+
+  if (isAmbiguous) {
+    return !wasDegraded && this->isDegraded();
+  }
+
+  double sample = time::duration_cast<time::microseconds>(rtt).count() / 1000.0;
+  if (m_minRtt < 0 || sample < m_minRtt) {
+    m_minRtt = sample;
+  }
+  m_sRtt = m_nRttSamples == 0 ? sample :
+           (1 - RTT_SAMPLE_WEIGHT) * m_sRtt + RTT_SAMPLE_WEIGHT * sample;
+  ++m_nRttSamples;
+
+  if (wasDegraded && m_reason != DELIVERY_RATE_DROP && !this->isRttInflated(sample)) {
+    // recovered: restart smoothing from the healthy sample
+    m_reason = NONE;
+    m_sRtt = sample;
+  }
+  else if (m_nRttSamples >= MIN_RTT_SAMPLES && this->isRttInflated(m_sRtt)) {
+    this->setDegraded(RTT_INFLATION);
+  }
+  return !wasDegraded && this->isDegraded();
+}
+
+void
+LinkDegradationDetector::setDegraded(Reason reason)
+{
+  if (m_reason == NONE) {
+    m_reason = reason;
+  }
+}
+
+void
+LinkDegradationDetector::updateDeliveryRate(const time::steady_clock::TimePoint& now)
+{
+  if (now - m_rateIntervalStart < m_options.rateInterval) {
+    return;
+  }
+
+  // Data cannot be expected beyond the demand, so that an idle consumer is not a rate drop
+  double expected = m_avgDelivered < 0 ? 0 :
+                    std::min(m_avgDelivered, static_cast<double>(m_nSentInInterval));
+  bool isDrop = expected >= MIN_EXPECTED_DELIVERIES &&
+                m_nDataInInterval < m_options.deliveryRateDropFactor * expected;
+
+  if (isDrop) {
+    // average is not updated, so that the rate before the drop remains the baseline
+    this->setDegraded(DELIVERY_RATE_DROP);
+  }
+  else if (m_nDataInInterval > 0) {
+    m_avgDelivered = m_avgDelivered < 0 ? m_nDataInInterval :
+                     (1 - RATE_SAMPLE_WEIGHT) * m_avgDelivered + RATE_SAMPLE_WEIGHT * m_nDataInInterval;
+    if (m_reason == DELIVERY_RATE_DROP) {
+      m_reason = NONE;
+    }
+  }
+
+  // intervals without any event are skipped rather than counted as idle
+  m_rateIntervalStart = now;
+  m_nSentInInterval = 0;
+  m_nDataInInterval = 0;
+}
+
+bool
+LinkDegradationDetector::isRttInflated(double rtt) const
+{
+  return m_minRtt >= 0 &&
+         rtt > m_options.rttInflationFactor * m_minRtt &&
+         rtt > m_minRtt + m_options.minRttInflation.count();
+}
+
+std::ostream&
+operator<<(std::ostream& os, LinkDegradationDetector::Reason reason)
+{
+  switch (reason) {
+  case LinkDegradationDetector::NONE:
+    return os << "none";
+  case LinkDegradationDetector::RTT_INFLATION:
+    return os << "rtt-inflation";
+  case LinkDegradationDetector::CONSECUTIVE_TIMEOUTS:
+    return os << "consecutive-timeouts";
+  case LinkDegradationDetector::DELIVERY_RATE_DROP:
+    return os << "delivery-rate-drop";
+  }
+  return os << static_cast<int>(reason);
+}
+
+} // namespace fw
+} // namespace nfd
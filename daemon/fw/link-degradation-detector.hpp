@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_LINK_DEGRADATION_DETECTOR_HPP
+#define NFD_DAEMON_FW_LINK_DEGRADATION_DETECTOR_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief detects that an upstream link is degrading before its interface is declared down
+ *
+ *  The link is considered degraded when any of the following happens:
+ *  \li RTT inflation: smoothed RTT exceeds both rttInflationFactor times the minimum RTT,
+ *      and the minimum RTT plus minRttInflation
+ *  \li consecutive timeouts: maxConsecutiveTimeouts Interests are retransmitted in a row
+ *      without any Data arriving in between
+ *  \li delivery rate drop: over a rateInterval in which there is enough demand,
+ *      fewer than deliveryRateDropFactor times the expected Data arrive
+ *
+ *  The link recovers when a Data of an Interest that was not retransmitted arrives
+ *  with an RTT that is not inflated.
+ */
+class LinkDegradationDetector
+{
+public:
+  enum Reason {
+    NONE,
+    RTT_INFLATION,
+    CONSECUTIVE_TIMEOUTS,
+    DELIVERY_RATE_DROP
+  };
+
+  class Options
+  {
+  public:
+    Options();
+
+  public:
+    double rttInflationFactor;
+    time::milliseconds minRttInflation;
+    size_t maxConsecutiveTimeouts;
+    double deliveryRateDropFactor;
+    time::milliseconds rateInterval;
+  };
+
+  explicit
+  LinkDegradationDetector(const Options& options = Options());
+
+  /** \brief record an Interest transmission on the link
+   *  \param isRetransmission whether the previous transmission of the Interest timed out
+   *  \return whether the link has just become degraded
+   */
+  bool
+  afterSendInterest(bool isRetransmission);
+
+  /** \brief record a Data arrival on the link
+   *  \param rtt time since the last transmission of the Interest
+   *  \param isAmbiguous whether the Interest was retransmitted, so that \p rtt is not
+   *                     a valid RTT sample
+   *  \return whether the link has just become degraded
+   */
+  bool
+  afterReceiveData(const time::nanoseconds& rtt, bool isAmbiguous);
+
+  bool
+  isDegraded() const
+  {
+    return m_reason != NONE;
+  }
+
+  /** \return why the link is degraded, or NONE
+   */
+  Reason
+  getReason() const
+  {
+    return m_reason;
+  }
+
+  /** \return when a Data last arrived on the link, or when the detector was created or reset
+   *          if no Data has arrived
+   */
+  time::steady_clock::TimePoint
+  getLastDataTime() const
+  {
+    return m_lastData;
+  }
+
+  void
+  reset();
+
+private:
+  /** \brief set the reason, unless the link is already degraded
+   */
+  void
+  setDegraded(Reason reason);
+
+  /** \brief close the rate interval if it has elapsed, and evaluate its delivery rate
+   */
+  void
+  updateDeliveryRate(const time::steady_clock::TimePoint& now);
+
+  bool
+  isRttInflated(double rtt) const;
+
+private:
+  Options m_options;
+  Reason m_reason;
+  time::steady_clock::TimePoint m_lastData;
+
+  size_t m_nConsecutiveTimeouts;
+
+  /// in milliseconds, negative if there is no sample
+  double m_minRtt;
+  double m_sRtt;
+  size_t m_nRttSamples;
+
+  time::steady_clock::TimePoint m_rateIntervalStart;
+  size_t m_nSentInInterval;
+  size_t m_nDataInInterval;
+  /// Data per rate interval, negative if not measured
+  double m_avgDelivered;
+};
+
+std::ostream&
+operator<<(std::ostream& os, LinkDegradationDetector::Reason reason);
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_LINK_DEGRADATION_DETECTOR_HPP
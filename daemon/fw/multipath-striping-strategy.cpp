@@ -0,0 +1,363 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "multipath-striping-strategy.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("MultipathStripingStrategy");
+
+const Name MultipathStripingStrategy::STRATEGY_NAME("ndn:/localhost/nfd/strategy/multipath-striping/%FD%01");
+NFD_REGISTER_STRATEGY(MultipathStripingStrategy);
+
+const size_t MultipathStripingStrategy::MIN_WINDOW = 4;
+const double MultipathStripingStrategy::WINDOW_GAIN = 2.0;
+const time::nanoseconds MultipathStripingStrategy::RATE_SAMPLE_INTERVAL = time::milliseconds(100);
+const double MultipathStripingStrategy::RATE_SAMPLE_WEIGHT = 0.5;
+
+MultipathStripingStrategy::MultipathStripingStrategy(Forwarder& forwarder, const Name& name)
+  : RetriesStrategy(forwarder, name)
+  , m_removeFaceInfoConn(this->beforeRemoveFace.connect(
+                         bind(&MultipathStripingStrategy::removeFaceInfo, this, _1)))
+{
+  // Interests are already spread over all upstreams in proportion to their delivery rate,
+  // so duplicating them away from a congested upstream would only waste capacity
+  this->setProactiveHandover(false);
+  // the in-flight window of each upstream already bounds outstanding Interests
+  this->setCongestionControl(false);
+}
+
+MultipathStripingStrategy::~MultipathStripingStrategy()
+{
+}
+
+static inline bool
+predicate_NextHop_eligible(const shared_ptr<pit::Entry>& pitEntry,
+                           const fib::NextHop& nexthop, FaceId currentDownstream)
+{
+  Face& upstream = nexthop.getFace();
+
+  // upstream is current downstream
+  if (upstream.getId() == currentDownstream)
+    return false;
+
+  // forwarding would violate scope
+  if (pitEntry->violatesScope(upstream))
+    return false;
+
+  if (upstream.getState() == face::TransportState::DOWN)
+    return false;
+
+  return true;
+}
+
+void
+MultipathStripingStrategy::afterReceiveInterest(const Face& inFace,
+                                                const Interest& interest,
+                                                shared_ptr<fib::Entry> fibEntry,
+                                                shared_ptr<pit::Entry> pitEntry)
+{
+  PitInfo* pi = pitEntry->getOrCreateStrategyInfo<PitInfo>();
+
+  // a retransmission of a held Interest keeps its place in the held queue
+  if (pi->isHeld) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " held");
+    return;
+  }
+
+  // a retransmission from downstream stays on the face of the original Interest
+  if (pi->outFace != face::INVALID_FACEID) {
+    shared_ptr<Face> outFace = this->getFace(pi->outFace);
+    if (outFace != nullptr && outFace->getState() != face::TransportState::DOWN) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmit-to=" << outFace->getId());
+      this->insertPendingInterest(interest, outFace, fibEntry, pitEntry);
+      return;
+    }
+    this->releaseInFlight(*pitEntry);
+  }
+
+  bool isWindowFull = false;
+  shared_ptr<Face> outFace = this->selectNexthop(inFace.getId(), *fibEntry, pitEntry, isWindowFull);
+  if (isWindowFull) {
+    pi->isHeld = true;
+    m_heldInterests.push_back(HeldInterest{pitEntry, fibEntry, inFace.getId()});
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " held=" << m_heldInterests.size());
+    return;
+  }
+  if (outFace == nullptr) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, inFace, nackHeader);
+    this->rejectPendingInterest(pitEntry);
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " to=" << outFace->getId());
+  this->sendToNexthop(interest, outFace, fibEntry, pitEntry);
+}
+
+void
+MultipathStripingStrategy::beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry)
+{
+  this->releaseInFlight(*pitEntry);
+  this->dispatchHeldInterests();
+}
+
+void
+MultipathStripingStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                            shared_ptr<fib::Entry> fibEntry,
+                                            shared_ptr<pit::Entry> pitEntry)
+{
+  RetriesStrategy::afterReceiveNack(inFace, nack, fibEntry, pitEntry);
+  this->dispatchHeldInterests();
+}
+
+void
+MultipathStripingStrategy::beforeSatisfyPendingInterest(const pit::Entry& pitEntry,
+                                                        const Face& inFace, const Data& data,
+                                                        const std::vector<time::steady_clock::TimePoint>& retriesTimes)
+{
+  this->releaseInFlight(pitEntry);
+
+  if (!retriesTimes.empty()) {
+    auto it = m_faceInfos.find(inFace.getId());
+    if (it != m_faceInfos.end()) {
+      it->second.recordDelivery(retriesTimes);
+    }
+  }
+
+  this->dispatchHeldInterests();
+}
+
+void
+MultipathStripingStrategy::beforeNackFailover(const pit::Entry& pitEntry, const Face& nackFace,
+                                              const Face* newFace)
+{
+  this->releaseInFlight(pitEntry);
+  if (newFace == nullptr) {
+    return;
+  }
+
+  PitInfo* pi = pitEntry.getStrategyInfo<PitInfo>();
+  if (pi == nullptr) {
+    return;
+  }
+  ++m_faceInfos[newFace->getId()].nInFlight;
+  pi->outFace = newFace->getId();
+}
+
+shared_ptr<Face>
+MultipathStripingStrategy::selectNexthop(FaceId inFace, const fib::Entry& fibEntry,
+                                         const shared_ptr<pit::Entry>& pitEntry, bool& isWindowFull)
+{
+  // a face that has recently returned a Nack is chosen only if every eligible face has
+  Face* bestFace = nullptr;
+  bool isBestBackedOff = true;
+  double bestUtilization = std::numeric_limits<double>::max();
+  isWindowFull = false;
+  for (const fib::NextHop& nexthop : fibEntry.getNextHops()) {
+    if (!predicate_NextHop_eligible(pitEntry, nexthop, inFace)) {
+      continue;
+    }
+
+    const FaceInfo& fi = m_faceInfos[nexthop.getFace().getId()];
+    if (fi.nInFlight >= fi.getWindow()) {
+      isWindowFull = true;
+      continue;
+    }
+
+    bool isBackedOff = this->isNackBackedOff(fibEntry, nexthop.getFace());
+    double utilization = static_cast<double>(fi.nInFlight + 1) / fi.getWindow();
+    if ((isBestBackedOff && !isBackedOff) ||
+        (isBestBackedOff == isBackedOff && utilization < bestUtilization)) {
+      isBestBackedOff = isBackedOff;
+      bestUtilization = utilization;
+      bestFace = &nexthop.getFace();
+    }
+  }
+
+  if (bestFace == nullptr) {
+    return nullptr;
+  }
+  isWindowFull = false;
+  return bestFace->shared_from_this();
+}
+
+void
+MultipathStripingStrategy::sendToNexthop(const Interest& interest, shared_ptr<Face> outFace,
+                                         shared_ptr<fib::Entry> fibEntry,
+                                         shared_ptr<pit::Entry> pitEntry)
+{
+  FaceInfo& fi = m_faceInfos[outFace->getId()];
+  ++fi.nInFlight;
+  pitEntry->getOrCreateStrategyInfo<PitInfo>()->outFace = outFace->getId();
+
+  NFD_LOG_TRACE(interest << " to=" << outFace->getId() <<
+                " inFlight=" << fi.nInFlight << " window=" << fi.getWindow());
+  this->insertPendingInterest(interest, outFace, fibEntry, pitEntry);
+}
+
+void
+MultipathStripingStrategy::dispatchHeldInterests()
+{
+  while (!m_heldInterests.empty()) {
+    const HeldInterest& held = m_heldInterests.front();
+    shared_ptr<pit::Entry> pitEntry = held.pitEntry.lock();
+    PitInfo* pi = pitEntry == nullptr ? nullptr : pitEntry->getStrategyInfo<PitInfo>();
+    if (pi == nullptr || !pi->isHeld) {
+      // satisfied or expired while held
+      m_heldInterests.pop_front();
+      continue;
+    }
+
+    shared_ptr<fib::Entry> fibEntry = held.fibEntry.lock();
+    bool isWindowFull = false;
+    shared_ptr<Face> outFace;
+    if (fibEntry != nullptr) {
+      outFace = this->selectNexthop(held.inFace, *fibEntry, pitEntry, isWindowFull);
+    }
+    if (isWindowFull) {
+      return;
+    }
+
+    FaceId inFace = held.inFace;
+    m_heldInterests.pop_front();
+    pi->isHeld = false;
+
+    if (outFace == nullptr) {
+      NFD_LOG_DEBUG(pitEntry->getInterest() << " from=" << inFace << " held noNextHop");
+
+      lp::NackHeader nackHeader;
+      nackHeader.setReason(lp::NackReason::NO_ROUTE);
+      this->sendNacks(pitEntry, nackHeader);
+      this->rejectPendingInterest(pitEntry);
+      continue;
+    }
+
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " from=" << inFace << " held to=" << outFace->getId());
+    this->sendToNexthop(pitEntry->getInterest(), outFace, fibEntry, pitEntry);
+  }
+}
+
+void
+MultipathStripingStrategy::releaseInFlight(const pit::Entry& pitEntry)
+{
+  PitInfo* pi = pitEntry.getStrategyInfo<PitInfo>();
+  if (pi == nullptr) {
+    return;
+  }
+
+  pi->isHeld = false;
+  if (pi->outFace == face::INVALID_FACEID) {
+    return;
+  }
+
+  auto it = m_faceInfos.find(pi->outFace);
+  if (it != m_faceInfos.end() && it->second.nInFlight > 0) {
+    --it->second.nInFlight;
+  }
+  pi->outFace = face::INVALID_FACEID;
+}
+
+const MultipathStripingStrategy::FaceInfo*
+MultipathStripingStrategy::getFaceInfo(FaceId faceId) const
+{
+  auto it = m_faceInfos.find(faceId);
+  return it == m_faceInfos.end() ? nullptr : &it->second;
+}
+
+size_t
+MultipathStripingStrategy::getNHeldInterests() const
+{
+  return m_heldInterests.size();
+}
+
+void
+MultipathStripingStrategy::removeFaceInfo(shared_ptr<Face> face)
+{
+  m_faceInfos.erase(face->getId());
+}
+
+MultipathStripingStrategy::PitInfo::PitInfo()
+  : outFace(face::INVALID_FACEID)
+  , isHeld(false)
+{
+}
+
+MultipathStripingStrategy::FaceInfo::FaceInfo()
+  : nInFlight(0)
+  , deliveryRate(0.0)
+  , m_nDeliveredInInterval(0)
+{
+}
+
+size_t
+MultipathStripingStrategy::FaceInfo::getWindow() const
+{
+  float minRtt = rtt.getMinRtt();
+  if (deliveryRate <= 0.0 || minRtt <= 0) {
+    return MIN_WINDOW;
+  }
+
+  double bdp = deliveryRate * minRtt / 1000;
+  return std::max(MIN_WINDOW, static_cast<size_t>(std::ceil(WINDOW_GAIN * bdp)));
+}
+
+void
+MultipathStripingStrategy::FaceInfo::recordDelivery(const std::vector<time::steady_clock::TimePoint>& retriesTimes)
+{
+  rtt.addRttMeasurement(retriesTimes);
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (m_rateIntervalStart == time::steady_clock::TimePoint()) {
+    // the first Data starts the interval, but is not counted in it
+    m_rateIntervalStart = now;
+    return;
+  }
+
+  ++m_nDeliveredInInterval;
+  time::nanoseconds elapsed = now - m_rateIntervalStart;
+  if (elapsed < RATE_SAMPLE_INTERVAL) {
+    return;
+  }
+
+  double sample = m_nDeliveredInInterval / time::duration_cast<time::duration<double>>(elapsed).count();
+  if (deliveryRate <= 0.0) {
+    deliveryRate = sample;
+  }
+  else {
+    deliveryRate = (1 - RATE_SAMPLE_WEIGHT) * deliveryRate + RATE_SAMPLE_WEIGHT * sample;
+  }
+  m_rateIntervalStart = now;
+  m_nDeliveredInInterval = 0;
+}
+
+} // namespace fw
+} // namespace nfd
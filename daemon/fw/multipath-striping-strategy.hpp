@@ -0,0 +1,206 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_MULTIPATH_STRIPING_STRATEGY_HPP
+#define NFD_DAEMON_FW_MULTIPATH_STRIPING_STRATEGY_HPP
+
+#include "retries-strategy.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Multipath Striping Strategy version 1
+ *
+ *  This strategy aggregates the capacity of all upstreams of a namespace,
+ *  such as WLAN and cellular interfaces that are up at the same time.
+ *
+ *  Each upstream face has an in-flight window of WINDOW_GAIN times its bandwidth-delay product,
+ *  where the bandwidth is the delivery rate measured from Data arrivals, and the delay is the
+ *  minimum RTT from RttEstimatorRetries. A new Interest is sent to the face whose window is
+ *  least utilized, so that Interests are split across faces in proportion to delivery rate.
+ *  A face whose window is full is not chosen. When the windows of all eligible faces are full,
+ *  the Interest is held, and sent in arrival order when a Data or an expiry opens a window.
+ *  Lost Interests are retransmitted on the same face by RetriesStrategy.
+ *  An Interest that fails over to another face after a Nack is counted on the new face,
+ *  even if that face's window is full.
+ */
+class MultipathStripingStrategy : public RetriesStrategy
+{
+public:
+  MultipathStripingStrategy(Forwarder& forwarder, const Name& name = STRATEGY_NAME);
+
+  virtual
+  ~MultipathStripingStrategy();
+
+public: // triggers
+  virtual void
+  afterReceiveInterest(const Face& inFace,
+                       const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+  virtual void
+  beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+  virtual void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+protected:
+  virtual void
+  beforeSatisfyPendingInterest(const pit::Entry& pitEntry, const Face& inFace, const Data& data,
+                               const std::vector<time::steady_clock::TimePoint>& retriesTimes) DECL_OVERRIDE;
+
+  virtual void
+  beforeNackFailover(const pit::Entry& pitEntry, const Face& nackFace,
+                     const Face* newFace) DECL_OVERRIDE;
+
+public:
+  /** \brief per-face state
+   */
+  class FaceInfo
+  {
+  public:
+    FaceInfo();
+
+    /** \return in-flight window, in number of Interests
+     */
+    size_t
+    getWindow() const;
+
+    /** \brief record a Data arrival
+     *  \param retriesTimes send times of the Interest on this face
+     */
+    void
+    recordDelivery(const std::vector<time::steady_clock::TimePoint>& retriesTimes);
+
+  public:
+    /// number of Interests sent on this face and not yet satisfied or expired
+    size_t nInFlight;
+
+    /// delivery rate in Data per second, zero if not measured
+    double deliveryRate;
+
+    RttEstimatorRetries rtt;
+
+  private:
+    time::steady_clock::TimePoint m_rateIntervalStart;
+    size_t m_nDeliveredInInterval;
+  };
+
+  /** \return per-face state, or nullptr if no Interest has been sent on the face
+   */
+  const FaceInfo*
+  getFaceInfo(FaceId faceId) const;
+
+  /** \return number of Interests waiting for a window to open
+   */
+  size_t
+  getNHeldInterests() const;
+
+private:
+  /** \brief StrategyInfo on PIT entry
+   */
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1040;
+    }
+
+    PitInfo();
+
+  public:
+    /// face that the Interest is counted as in-flight on, INVALID_FACEID if none
+    FaceId outFace;
+
+    /// whether the Interest waits in the held queue
+    bool isHeld;
+  };
+
+  /** \brief an Interest waiting for a window to open
+   */
+  struct HeldInterest
+  {
+    weak_ptr<pit::Entry> pitEntry;
+    weak_ptr<fib::Entry> fibEntry;
+    FaceId inFace;
+  };
+
+  /** \brief choose the eligible nexthop with the least utilized window that is not full
+   *  \param[out] isWindowFull set to true if there are eligible nexthops, but all windows are full
+   *  \return the chosen face, or nullptr if no nexthop can be chosen
+   */
+  shared_ptr<Face>
+  selectNexthop(FaceId inFace, const fib::Entry& fibEntry,
+                const shared_ptr<pit::Entry>& pitEntry, bool& isWindowFull);
+
+  /** \brief count the Interest as in-flight on \p outFace, and send it
+   */
+  void
+  sendToNexthop(const Interest& interest, shared_ptr<Face> outFace,
+                shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry);
+
+  /** \brief send held Interests, in arrival order, until all windows are full again
+   */
+  void
+  dispatchHeldInterests();
+
+  /** \brief stop counting the Interest of \p pitEntry as in-flight
+   */
+  void
+  releaseInFlight(const pit::Entry& pitEntry);
+
+  void
+  removeFaceInfo(shared_ptr<Face> face);
+
+public:
+  static const Name STRATEGY_NAME;
+
+  /// window when delivery rate or RTT is not yet measured, and lower bound of the window
+  static const size_t MIN_WINDOW;
+
+  /// window as a multiple of the bandwidth-delay product
+  static const double WINDOW_GAIN;
+
+  /// minimum interval over which a delivery rate sample is taken
+  static const time::nanoseconds RATE_SAMPLE_INTERVAL;
+
+  /// weight of a new delivery rate sample
+  static const double RATE_SAMPLE_WEIGHT;
+
+private:
+  std::unordered_map<FaceId, FaceInfo> m_faceInfos;
+  std::deque<HeldInterest> m_heldInterests;
+  signal::ScopedConnection m_removeFaceInfoConn;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_MULTIPATH_STRIPING_STRATEGY_HPP
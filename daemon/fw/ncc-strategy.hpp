@@ -118,10 +118,10 @@ protected:
   };
 
 protected:
-  shared_ptr<MeasurementsEntryInfo>
+  MeasurementsEntryInfo*
   getMeasurementsEntryInfo(shared_ptr<measurements::Entry> entry);
 
-  shared_ptr<MeasurementsEntryInfo>
+  MeasurementsEntryInfo*
   getMeasurementsEntryInfo(shared_ptr<pit::Entry> entry);
 
   /// propagate to another upstream
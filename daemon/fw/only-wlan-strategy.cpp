@@ -38,11 +38,7 @@ OnlyWlanStrategy::OnlyWlanStrategy(Forwarder& forwarder, const Name& name)
   : WeightedRandomStrategy(forwarder, name)
 {
   // Set weight 1 to preferred interface, 0 to the other
-  m_interfacesInfo.insert(std::make_pair("eth0",InterfaceInfo("eth0", 0)));
-  //m_interfacesInfo.insert(std::make_pair("enp2s0",InterfaceInfo("enp2s0", 0)));
-  m_interfacesInfo.insert(std::make_pair("wwan0",InterfaceInfo("wwan0", 0)));
-  m_interfacesInfo.insert(std::make_pair("wlan0",InterfaceInfo("wlan0", 1)));
-  m_interfacesInfo.insert(std::make_pair("wlp4s0",InterfaceInfo("wlp4s0", 1)));
+  m_interfaceWeights.setDefaults({{"eth0", 0}, {"wwan0", 0}, {"wlan0", 1}, {"wlp4s0", 1}});
 }
 
 OnlyWlanStrategy::~OnlyWlanStrategy()
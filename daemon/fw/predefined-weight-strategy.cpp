@@ -38,11 +38,7 @@ PredefinedWeightStrategy::PredefinedWeightStrategy(Forwarder& forwarder, const N
   : WeightedRandomStrategy(forwarder, name)
 {
   // Set weight 1 to preferred interface, 0 to the other
-  m_interfacesInfo.insert(std::make_pair("eth0",InterfaceInfo("eth0", 1)));
-  //m_interfacesInfo.insert(std::make_pair("enp2s0",InterfaceInfo("enp2s0", 1)));
-  m_interfacesInfo.insert(std::make_pair("wwan0",InterfaceInfo("wwan0", 1)));
-  m_interfacesInfo.insert(std::make_pair("wlan0",InterfaceInfo("wlan0", 1)));
-  m_interfacesInfo.insert(std::make_pair("wlp4s0",InterfaceInfo("wlp4s0", 1)));
+  m_interfaceWeights.setDefaults({{"eth0", 1}, {"wwan0", 1}, {"wlan0", 1}, {"wlp4s0", 1}});
 }
 
 PredefinedWeightStrategy::~PredefinedWeightStrategy()
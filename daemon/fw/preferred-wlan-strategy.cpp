@@ -47,17 +47,19 @@ PreferredWlanStrategy::PreferredWlanStrategy(Forwarder& forwarder, const Name& n
 
 
   // Set weight 2 to preferred interface, 1 to the secondary, 0 to unused
-  m_interfacesInfo.insert(std::make_pair("eth0",InterfaceInfo("eth0", 2)));
-  //m_interfacesInfo.insert(std::make_pair("enp2s0",InterfaceInfo("enp2s0", 0)));
-  m_interfacesInfo.insert(std::make_pair("wwan0",InterfaceInfo("wwan0", 0)));
-  m_interfacesInfo.insert(std::make_pair("wlan0",InterfaceInfo("wlan0", 1)));
-  m_interfacesInfo.insert(std::make_pair("wlp4s0",InterfaceInfo("wlp4s0", 0)));
+  m_interfaceWeights.setDefaults({{"eth0", 2}, {"wwan0", 0}, {"wlan0", 1}, {"wlp4s0", 0}});
 }
 
 PreferredWlanStrategy::~PreferredWlanStrategy()
 {
 }
 
+InterfaceWeights*
+PreferredWlanStrategy::getInterfaceWeights()
+{
+  return &m_interfaceWeights;
+}
+
 /** \brief determines whether a NextHop is eligible
  *  \param pitEntry PIT entry
  *  \param nexthop next hop
@@ -72,17 +74,17 @@ predicate_NextHop_eligible(const shared_ptr<pit::Entry>& pitEntry,
                            int weight = 0,
                            int selWeight = 0)
 {
-  shared_ptr<Face> upstream = nexthop.getFace();
+  Face& upstream = nexthop.getFace();
 
   // upstream is current downstream
-  if (upstream->getId() == currentDownstream)
+  if (upstream.getId() == currentDownstream)
     return false;
 
   // forwarding would violate scope
-  if (pitEntry->violatesScope(*upstream))
+  if (pitEntry->violatesScope(upstream))
     return false;
 
-  if (upstream->getState() == nfd::face::TransportState::DOWN)
+  if (upstream.getState() == nfd::face::TransportState::DOWN)
     return false;
 
   if (weight != selWeight)
@@ -99,36 +101,35 @@ PreferredWlanStrategy::afterReceiveInterest(const Face& inFace,
 {
   float totalWeight = 0;
   const fib::NextHopList& nexthops = fibEntry->getNextHops();
-  std::map<int, shared_ptr<Face>> eligibleFaces;
-
-  // get face with weight == 1
-  for (const fib::NextHop& nextHop : nexthops) {
-    if (predicate_NextHop_eligible(pitEntry, nextHop, inFace.getId(), 2, getFaceWeight(nextHop.getFace()))) {
-      shared_ptr<Face> outFace = nextHop.getFace();
-      int prob = getFaceWeight(outFace);
-      if (prob > 0) {
-
-        totalWeight += prob;
-        eligibleFaces[totalWeight] = outFace;
-        //NFD_LOG_DEBUG("Eligible face: " << outFace->getId());
-      }
-    }
-  }
+  std::map<int, Face*> eligibleFaces;
 
-  // if no face with weight 1 are eligible get face with weight == 0
-  if (eligibleFaces.size() == 0) {
+  auto collectEligibleFaces = [&] (int selWeight, bool wantSkipBackedOff) {
     for (const fib::NextHop& nextHop : nexthops) {
-      if (predicate_NextHop_eligible(pitEntry, nextHop, inFace.getId(), 1, getFaceWeight(nextHop.getFace()))) {
-        shared_ptr<Face> outFace = nextHop.getFace();
+      if (predicate_NextHop_eligible(pitEntry, nextHop, inFace.getId(), selWeight, getFaceWeight(nextHop.getFace())) &&
+          !(wantSkipBackedOff && this->isNackBackedOff(*fibEntry, nextHop.getFace()))) {
+        Face& outFace = nextHop.getFace();
         int prob = getFaceWeight(outFace);
         if (prob > 0) {
 
           totalWeight += prob;
-          eligibleFaces[totalWeight] = outFace;
+          eligibleFaces[totalWeight] = &outFace;
           //NFD_LOG_DEBUG("Eligible face: " << outFace->getId());
         }
       }
     }
+  };
+
+  // get face with weight == 2, unless it has recently returned a Nack
+  collectEligibleFaces(2, true);
+
+  // if no face with weight 2 are eligible get face with weight == 1
+  if (eligibleFaces.size() == 0) {
+    collectEligibleFaces(1, false);
+  }
+
+  // a backed off face with weight == 2 is better than nothing
+  if (eligibleFaces.size() == 0) {
+    collectEligibleFaces(2, false);
   }
 
   if (eligibleFaces.size() > 0) {
@@ -136,12 +137,12 @@ PreferredWlanStrategy::afterReceiveInterest(const Face& inFace,
     int randomValue = dis(m_randomGen);
 
     auto it = std::find_if(eligibleFaces.begin(), eligibleFaces.end(),
-                            [randomValue] (const std::pair<const int,shared_ptr<Face>>& hop) {
+                            [randomValue] (const std::pair<const int, Face*>& hop) {
                                              return randomValue <= hop.first;
                                            });
 
     if (it != eligibleFaces.end()) {
-      shared_ptr<Face> outFace = it->second;
+      shared_ptr<Face> outFace = it->second->shared_from_this();
       NFD_LOG_DEBUG("Interest to interface: " << outFace->getInterfaceName());
       //this->sendInterest(pitEntry, outFace);
 
@@ -173,25 +174,16 @@ PreferredWlanStrategy::afterReceiveInterest(const Face& inFace,
 }
 
 int
-PreferredWlanStrategy::getFaceWeight(const shared_ptr<Face>& face) const
+PreferredWlanStrategy::getFaceWeight(const Face& face) const
 {
-  std::string nicName = face->getInterfaceName();
-  auto it = m_interfacesInfo.find(nicName);
-  if (it != m_interfacesInfo.end())
-    return it->second.weight;
-
-  return 0;
+  return m_interfaceWeights.getFaceWeight(face);
 }
 
 bool
 PreferredWlanStrategy::isMainInterface(std::string interfaceName)
 {
   // return true if weight is 2
-  auto it = m_interfacesInfo.find(interfaceName);
-  if (it != m_interfacesInfo.end() && it->second.weight == 2)
-    return true;
-
-  return false;
+  return m_interfaceWeights.get(interfaceName) == 2;
 }
 
 } // namespace fw
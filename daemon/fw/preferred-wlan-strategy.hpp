@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FW_PREFERRED_WLAN_STRATEGY_HPP
 
 #include "retries-strategy.hpp"
+#include "interface-weights.hpp"
 
 #include <ndn-cxx/util/scheduler.hpp>
 #include <ndn-cxx/util/network-interface.hpp>
@@ -55,25 +56,12 @@ public:
   //virtual void
   //beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
 
-
+  virtual InterfaceWeights*
+  getInterfaceWeights() DECL_OVERRIDE;
 
 protected:
-  class InterfaceInfo
-  {
-  public:
-    InterfaceInfo(std::string name, int weight) :
-      name(name), weight(weight) {}
-
-  public:
-    std::string name;
-    int weight; // TODO uint
-    shared_ptr<ndn::util::NetworkInterface> ni;
-  };
-
-  typedef std::unordered_map<std::string, InterfaceInfo> interfacesInfos;
-
   int
-  getFaceWeight(const shared_ptr<nfd::face::Face>& face) const;
+  getFaceWeight(const nfd::face::Face& face) const;
 
   virtual bool
   isMainInterface(std::string interfaceName) DECL_OVERRIDE;
@@ -82,7 +70,7 @@ public:
   static const Name STRATEGY_NAME;
 
 private:
-  interfacesInfos m_interfacesInfo;
+  InterfaceWeights m_interfaceWeights;
   std::mt19937 m_randomGen;
 };
 
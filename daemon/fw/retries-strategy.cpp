@@ -26,8 +26,8 @@
 #include "retries-strategy.hpp"
 #include "core/logger.hpp"
 #include "strategies-tracepoint.hpp"
-#include "core/global-io.hpp"
 #include "core/global-network-monitor.hpp"
+#include "interface-weights.hpp"
 
 
 namespace nfd {
@@ -35,12 +35,19 @@ namespace fw {
 
 NFD_LOG_INIT("RetriesStrategy");
 
+const time::milliseconds RetriesStrategy::NACK_BACKOFF_INITIAL(250);
+const time::milliseconds RetriesStrategy::NACK_BACKOFF_MAX(8000);
+
 RetriesStrategy::RetriesStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder, name)
-  , m_scheduler(getGlobalIoService())
   , m_name(name)
   , m_pendingInterests()
   , m_interestZombieTime(time::milliseconds(100))
+  , m_isProactiveHandoverEnabled(true)
+  , m_isCongestionControlEnabled(true)
+  , m_isDrainingQueues(false)
+  , m_removeFaceStateConn(this->beforeRemoveFace.connect(
+                          bind(&RetriesStrategy::removeFaceState, this, _1)))
 {
   getGlobalNetworkMonitor().onInterfaceAdded.connect(bind(&RetriesStrategy::handleInterfaceAdded, this, _1));
   getGlobalNetworkMonitor().onInterfaceRemoved.connect(bind(&RetriesStrategy::handleInterfaceRemoved, this, _1));
@@ -53,19 +60,15 @@ RetriesStrategy::~RetriesStrategy()
 shared_ptr<RetriesStrategy::PendingInterest>
 RetriesStrategy::updatePendingInterest(const shared_ptr<pit::Entry>& pitEntry, const Interest& interest)
 {
-  for (shared_ptr<PendingInterest>& pi : m_pendingInterests) {
-    if (pi->pitEntry->getName() == pitEntry->getName()) {
-      pi->pitEntry = pitEntry;
-      if (pi->deleteEvent != nullptr)
-        m_scheduler.cancelEvent(*(pi->deleteEvent));
-      pi->deleteEvent = make_shared<ndn::util::scheduler::EventId>(
-                          m_scheduler.scheduleEvent(time::milliseconds(interest.getInterestLifetime().count() + m_interestZombieTime.count()),
-                                                    bind(&RetriesStrategy::removePendingInterest, this, pi)));
-      return pi;
-    }
+  auto indexIt = m_pendingInterestIndex.find(pitEntry->getName());
+  if (indexIt == m_pendingInterestIndex.end()) {
+    return nullptr;
   }
 
-  return nullptr;
+  shared_ptr<PendingInterest> pi = *indexIt->second;
+  pi->pitEntry = pitEntry;
+  pi->deleteTimer.schedule(interest.getInterestLifetime() + m_interestZombieTime);
+  return pi;
 }
 
 void
@@ -77,22 +80,23 @@ RetriesStrategy::insertPendingInterest(const Interest& interest,
   auto pi = updatePendingInterest(pitEntry, interest);
 
   if (pi == nullptr) { // New pending interest
-    pi = make_shared<PendingInterest>(PendingInterest(fibEntry, pitEntry));
+    pi = make_shared<PendingInterest>(*this, pitEntry);
 
     const fib::NextHopList& nexthops = fibEntry->getNextHops();
     for (const fib::NextHop& nextHop : nexthops) {
-      pi->nextHops.push_back(nextHop.getFace()); // TODO weak ptr to face?
+      pi->nextHops.emplace_back(*this, *pi, nextHop.getFace().shared_from_this()); // TODO weak ptr to face?
     }
 
     m_pendingInterests.push_back(pi);
-    pi->deleteEvent = make_shared<ndn::util::scheduler::EventId>(
-                        m_scheduler.scheduleEvent(time::milliseconds(interest.getInterestLifetime().count() + m_interestZombieTime.count()),
-                                                  bind(&RetriesStrategy::removePendingInterest, this, pi)));
+    m_pendingInterestIndex.emplace(pitEntry->getName(), std::prev(m_pendingInterests.end()));
+    pi->deleteTimer.schedule(interest.getInterestLifetime() + m_interestZombieTime);
   }
   // TODO we assume that the fib don't change during the execution, we should update next hops list
 
-  if (outFace != nullptr)
+  if (outFace != nullptr) {
     sendPendingInterest(pitEntry, outFace, pi);
+    this->drainCongestionQueues();
+  }
 }
 
 void
@@ -100,6 +104,10 @@ RetriesStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                                        const nfd::face::Face& inFace,
                                        const ndn::Data& data)
 {
+  static const std::vector<time::steady_clock::TimePoint> NO_RETRIES;
+  const std::vector<time::steady_clock::TimePoint>* inFaceRetries = &NO_RETRIES;
+  shared_ptr<PendingInterest> pi; // keeps inFaceRetries valid
+
   if (pitEntry->hasValidLocalInRecord()) {
 
     //NFD_LOG_INFO("Data received " << pitEntry->getName());
@@ -121,46 +129,58 @@ RetriesStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
     float rtt = -1;
     int nRetries = 0;
     int retrieveTime = -1;
+    bool isLinkDegraded = false;
+
+    auto indexIt = m_pendingInterestIndex.find(pitEntry->getName());
+    if (indexIt != m_pendingInterestIndex.end() && (*indexIt->second)->pitEntry == pitEntry) {
+      pi = *indexIt->second;
+      for (auto& nextHop : pi->nextHops) {
+        if (nextHop.outFace->getId() != face::INVALID_FACEID && nextHop.outFace->getId() == inFace.getId()) {
+          if (hasOutRecords && !nextHop.retriesTimes.empty()) {
+            nRetries = nextHop.retriesTimes.size() - 1;
+            retrieveTime = (time::duration_cast<time::milliseconds> (time::steady_clock::now() - nextHop.retriesTimes[0])).count();
+            rtt = rttEstimators[nextHop.outFace->getInterfaceName()].addRttMeasurement(nextHop.retriesTimes);
+            this->addPrefixRttMeasurement(data, nextHop.outFace->getInterfaceName(), nextHop.retriesTimes);
+            inFaceRetries = &nextHop.retriesTimes;
+            if (nextHop.isInFlight) {
+              Upstream& upstream = m_upstreams[inFace.getId()];
+              upstream.window.increase();
+              this->traceCongestion(inFace.getId(), upstream);
+            }
+            if (m_isProactiveHandoverEnabled)
+              isLinkDegraded = m_links[inFace.getId()].detector.afterReceiveData(
+                                 time::steady_clock::now() - nextHop.retriesTimes.back(),
+                                 nextHop.retriesTimes.size() > 1);
+          }
+          break;
+        }
+      }
+
+      if (pi->handoverFrom != face::INVALID_FACEID && pi->handoverFrom != inFace.getId()) {
+        auto link = m_links.find(pi->handoverFrom);
+        if (link != m_links.end() && !link->second.isSwitchTraced) {
+          link->second.isSwitchTraced = true;
+          auto switchLatency = time::duration_cast<time::milliseconds>(time::steady_clock::now() -
+                                                                       link->second.degradedSince);
+          tracepoint(strategyLog, link_switched, m_name.toUri().c_str(), pi->handoverFrom,
+                     inFace.getId(), inFace.getInterfaceName().c_str(), switchLatency.count());
+          NFD_LOG_DEBUG("Handover from face " << pi->handoverFrom << " to face " << inFace.getId() <<
+                        " switch-latency=" << switchLatency);
+        }
+      }
+
+      this->cancelPendingInterestTimers(*pi);
+      m_pendingInterests.erase(indexIt->second);
+      m_pendingInterestIndex.erase(indexIt);
+    }
 
-    m_pendingInterests.erase(std::find_if(m_pendingInterests.begin(), m_pendingInterests.end(),
-                                          [&](shared_ptr<PendingInterest>& pi) { // TODO unreadable, move out
-                                              if(pi->pitEntry == pitEntry) { // || !pi->pitEntry->hasValidLocalInRecord()
-                                                  for (auto& nextHop : pi->nextHops) {
-
-                                                    if(nextHop.outFace->getId() != face::INVALID_FACEID && nextHop.outFace->getId() == inFace.getId()) {
-                                                      if(pi->pitEntry == pitEntry && hasOutRecords && !nextHop.retriesTimes.empty()) {
-                                                         nRetries = nextHop.retriesTimes.size() - 1;
-                                                         if (nRetries < 0)
-                                                           nRetries = 0;
-                                                         retrieveTime = (time::duration_cast<time::milliseconds> (time::steady_clock::now() - nextHop.retriesTimes[0])).count();
-                                                         rtt = rttEstimators[nextHop.outFace->getInterfaceName()].addRttMeasurement(nextHop.retriesTimes);
-                                                      }
-                                                      break;
-                                                    }
-                                                  }
-
-                                                  for (auto nextHop : pi->nextHops) {
-                                                    if (nextHop.retryEvent != nullptr) {
-                                                      m_scheduler.cancelEvent(*(nextHop.retryEvent));
-                                                      nextHop.retryEvent = nullptr;
-                                                    }
-                                                  }
-                                                  if (pi->deleteEvent != nullptr) {
-                                                    m_scheduler.cancelEvent(*(pi->deleteEvent));
-                                                    pi->deleteEvent = nullptr;
-                                                  }
-                                                  return true;
-                                              }
-                                              else {
-                                                return false;
-                                              }
-                                          }));
-
-
-    if (hasOutRecords)
+
+    if (hasOutRecords) {
+      this->resetNackBackoff(*pitEntry, inFace.getId());
       tracepoint(strategyLog, data_received, m_name.toUri().c_str(), pitEntry->getInterest().toUri().c_str(), inFace.getId(),
                  inFace.getInterfaceName().c_str(), rtt, rttEstimators[inFace.getInterfaceName()].getRttMean(),
                  nRetries, retrieveTime, rttEstimators[inFace.getInterfaceName()].getLastRtt());
+    }
     else {
       tracepoint(strategyLog, data_rejected, m_name.toUri().c_str(), pitEntry->getInterest().toUri().c_str(), inFace.getId(),
                  inFace.getInterfaceName().c_str(), rtt, rttEstimators[inFace.getInterfaceName()].getRttMean(),
@@ -168,7 +188,15 @@ RetriesStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
       NFD_LOG_INFO("Data rejected " << pitEntry->getName());
     }
     //NFD_LOG_WARN("Retries " << nRetries << " RTT " << rtt << " bounded " << m_lastRtt << " Mean " << m_rttMean << " Min " << m_rttMinCalc);
+
+    // after the satisfied Interest is removed, so that it is not duplicated
+    if (isLinkDegraded)
+      this->handleLinkDegraded(inFace, m_links[inFace.getId()]);
+
+    this->drainCongestionQueues();
   }
+
+  this->beforeSatisfyPendingInterest(*pitEntry, inFace, data, *inFaceRetries);
 }
 
 bool
@@ -177,13 +205,26 @@ RetriesStrategy::isMainInterface(std::string interfaceName)
   return true;
 }
 
+void
+RetriesStrategy::beforeSatisfyPendingInterest(const pit::Entry& pitEntry, const Face& inFace,
+                                              const Data& data,
+                                              const std::vector<time::steady_clock::TimePoint>& retriesTimes)
+{
+}
+
+void
+RetriesStrategy::beforeNackFailover(const pit::Entry& pitEntry, const Face& nackFace,
+                                    const Face* newFace)
+{
+}
+
 void
 RetriesStrategy::handleInterfaceStateChanged(shared_ptr<ndn::util::NetworkInterface>& ni,
                                                     ndn::util::NetworkInterfaceState oldState,
                                                     ndn::util::NetworkInterfaceState newState)
 {
   if (isMainInterface(ni->getName())) {
-    rttEstimators[ni->getName()].reset(); // TODO We need it also here?
+    this->resetRttEstimators(ni->getName()); // TODO We need it also here?
 
     if (newState == ndn::util::NetworkInterfaceState::RUNNING) {
       NFD_LOG_DEBUG("Interface UP, resend all to " << ni->getName());
@@ -194,10 +235,9 @@ RetriesStrategy::handleInterfaceStateChanged(shared_ptr<ndn::util::NetworkInterf
           auto it = std::find_if(pi->nextHops.begin(), pi->nextHops.end(),
                                   [ni] (const NextHopRetries& nextHop) { return ni->getName() != nextHop.outFace->getInterfaceName(); });
           if (it != pi->nextHops.end()) {
-            if (it->retryEvent != nullptr)
-              m_scheduler.cancelEvent(*(it->retryEvent));
-            it->retryEvent = nullptr;
+            it->retryTimer.cancel();
             it->retriesTimes.clear();
+            this->releaseWindowSlot(*it);
           }
         }
         resendAllPendingInterest(ni->getName());
@@ -211,10 +251,9 @@ RetriesStrategy::handleInterfaceStateChanged(shared_ptr<ndn::util::NetworkInterf
                                [ni] (const NextHopRetries& nextHop) { return ni->getName() == nextHop.outFace->getInterfaceName();});
 
         if (it != pi->nextHops.end()) {
-          if (it->retryEvent != nullptr)
-            m_scheduler.cancelEvent(*(it->retryEvent));
-          it->retryEvent = nullptr;
+          it->retryTimer.cancel();
           it->retriesTimes.clear();
+          this->releaseWindowSlot(*it);
         }
 
         // TODO not working properly with more than 2 interfaces
@@ -227,11 +266,13 @@ RetriesStrategy::handleInterfaceStateChanged(shared_ptr<ndn::util::NetworkInterf
           }
         }
       }
-      rttEstimators[ni->getName()].reset();
+      this->resetRttEstimators(ni->getName());
 
       if (faceToSend != nullptr && faceToSend->getState() == face::TransportState::UP)
         resendAllPendingInterest(faceToSend->getInterfaceName());
     }
+
+    this->drainCongestionQueues();
   }
 }
 
@@ -239,16 +280,22 @@ void
 RetriesStrategy::resendAllPendingInterest(std::string interfaceName)
 {
   NFD_LOG_DEBUG("Resend size " << m_pendingInterests.size() << " to " << interfaceName);
-  for (shared_ptr<PendingInterest>& pi : m_pendingInterests) {
+
+  // sendPendingInterest may remove or duplicate any pending Interest, so they are collected first
+  std::vector<shared_ptr<PendingInterest>> pendingInterests(m_pendingInterests.begin(),
+                                                            m_pendingInterests.end());
+  for (const shared_ptr<PendingInterest>& pi : pendingInterests) {
+    auto indexIt = m_pendingInterestIndex.find(pi->pitEntry->getName());
+    if (indexIt == m_pendingInterestIndex.end() || *indexIt->second != pi)
+      continue; // removed while resending an earlier one
+
     for (auto& nextHop : pi->nextHops) {
       auto& outFace = nextHop.outFace;
       if (outFace->getId() != face::INVALID_FACEID && outFace->getInterfaceName() == interfaceName)
         sendPendingInterest(pi->pitEntry, nextHop.outFace, pi);
       else {
-        if (nextHop.retryEvent != nullptr) {
-          m_scheduler.cancelEvent(*(nextHop.retryEvent));
-          nextHop.retryEvent = nullptr;
-        }
+        nextHop.retryTimer.cancel();
+        this->releaseWindowSlot(nextHop);
       }
     }
   }
@@ -290,18 +337,27 @@ RetriesStrategy::sendPendingInterest(shared_ptr<pit::Entry> pitEntry, shared_ptr
                              [outFace] (const NextHopRetries& nextHop) { return outFace == nextHop.outFace;});
 
       if (it != newPi->nextHops.end()) {
+        if (!this->acquireWindowSlot(*newPi, *it))
+          return;
+
+        bool isRetransmission = !it->retriesTimes.empty();
         this->sendInterest(pitEntry, outFace, true);
         it->retriesTimes.push_back(time::steady_clock::now());
 
-        if (it->retryEvent != nullptr)
-           m_scheduler.cancelEvent(*(it->retryEvent));
-        it->retryEvent = make_shared<ndn::util::scheduler::EventId>(
-                           m_scheduler.scheduleEvent(rttEstimators[outFace->getInterfaceName()].computeRto(),
-                           bind(&RetriesStrategy::sendPendingInterest, this, pitEntry, outFace, newPi)));
+        time::milliseconds rto = this->computeRto(*newPi->pitEntry, outFace->getInterfaceName());
+        it->retryTimer.schedule(rto);
 
         tracepoint(strategyLog, interest_sent, pitEntry->getName().toUri().c_str(),
-                   outFace->getId(), outFace->getInterfaceName().c_str(), rttEstimators[outFace->getInterfaceName()].computeRto().count());
+                   outFace->getId(), outFace->getInterfaceName().c_str(), rto.count());
         NFD_LOG_DEBUG("Interest to interface "<< outFace->getInterfaceName());
+
+        if (m_isProactiveHandoverEnabled) {
+          LinkState& link = m_links[outFace->getId()];
+          if (link.detector.afterSendInterest(isRetransmission))
+            this->handleLinkDegraded(*outFace, link);
+          else if (link.detector.isDegraded())
+            this->duplicatePendingInterest(*newPi, *outFace);
+        }
       }
       else
         NFD_LOG_WARN("Pending interest has no face to the selected interface");
@@ -317,25 +373,542 @@ RetriesStrategy::removePendingInterest(weak_ptr<PendingInterest> pi)
   shared_ptr<PendingInterest> newPi = pi.lock();
 
   if (newPi && !pi.expired()) {
-    for (auto nextHop : newPi->nextHops) {
-      if (nextHop.retryEvent != nullptr) {
-        m_scheduler.cancelEvent(*(nextHop.retryEvent));
-        nextHop.retryEvent = nullptr;
-      }
+    this->cancelPendingInterestTimers(*newPi);
+
+    auto indexIt = m_pendingInterestIndex.find(newPi->pitEntry->getName());
+    if (indexIt != m_pendingInterestIndex.end() && *indexIt->second == newPi) {
+      NFD_LOG_TRACE("Removed interest, actual size " << m_pendingInterests.size());
+
+      m_pendingInterests.erase(indexIt->second);
+      m_pendingInterestIndex.erase(indexIt);
     }
+  }
+}
+
+void
+RetriesStrategy::cancelPendingInterestTimers(PendingInterest& pi)
+{
+  for (auto& nextHop : pi.nextHops) {
+    nextHop.retryTimer.cancel();
+    this->releaseWindowSlot(nextHop);
+  }
+  pi.deleteTimer.cancel();
+}
+
+void
+RetriesStrategy::handleRetryTimeout(PendingInterest& pi, NextHopRetries& nextHop)
+{
+  shared_ptr<PendingInterest> self = pi.shared_from_this(); // sendPendingInterest may remove pi
+
+  this->handleCongestionSignal(nextHop);
+  this->sendPendingInterest(pi.pitEntry, nextHop.outFace, self);
+  this->drainCongestionQueues();
+}
 
-    if (newPi->deleteEvent != nullptr) {
-      m_scheduler.cancelEvent(*(newPi->deleteEvent));
-      newPi->deleteEvent = nullptr;
+void
+RetriesStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                  shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry)
+{
+  auto indexIt = m_pendingInterestIndex.find(pitEntry->getName());
+  if (indexIt == m_pendingInterestIndex.end() || (*indexIt->second)->pitEntry != pitEntry) {
+    Strategy::afterReceiveNack(inFace, nack, fibEntry, pitEntry);
+    return;
+  }
+
+  shared_ptr<PendingInterest> pi = *indexIt->second;
+  auto nextHop = std::find_if(pi->nextHops.begin(), pi->nextHops.end(),
+                              [&inFace] (const NextHopRetries& nextHop) {
+                                return nextHop.outFace->getId() == inFace.getId() &&
+                                       nextHop.nackReason == lp::NackReason::NONE &&
+                                       !nextHop.retriesTimes.empty();
+                              });
+  if (nextHop == pi->nextHops.end()) {
+    return;
+  }
+
+  lp::NackReason reason = nack.getReason();
+  nextHop->retryTimer.cancel();
+  if (reason == lp::NackReason::CONGESTION)
+    this->handleCongestionSignal(*nextHop);
+  else
+    this->releaseWindowSlot(*nextHop);
+  this->backOffNexthop(*fibEntry, inFace.getId(), nextHop->retriesTimes.back());
+
+  bool isOutstanding = std::any_of(pi->nextHops.begin(), pi->nextHops.end(),
+                                   [&inFace] (const NextHopRetries& other) {
+                                     return other.outFace->getId() != inFace.getId() &&
+                                            other.nackReason == lp::NackReason::NONE &&
+                                            (!other.retriesTimes.empty() || other.isQueued);
+                                   });
+  NextHopRetries* alternative = nullptr;
+  if (!isOutstanding)
+    alternative = this->selectFailoverNexthop(*pi, *fibEntry, inFace);
+
+  if (isOutstanding) {
+    NFD_LOG_DEBUG(pitEntry->getName() << " nack-from=" << inFace.getId() << " nack=" << reason <<
+                  " waiting");
+    nextHop->nackReason = reason;
+  }
+  else if (alternative != nullptr) {
+    NFD_LOG_DEBUG(pitEntry->getName() << " nack-from=" << inFace.getId() << " nack=" << reason <<
+                  " failover-to=" << alternative->outFace->getId());
+    nextHop->nackReason = reason;
+    std::string reasonStr = boost::lexical_cast<std::string>(reason);
+    tracepoint(strategyLog, nack_failover, m_name.toUri().c_str(), pitEntry->getName().toUri().c_str(),
+               inFace.getId(), alternative->outFace->getId(), reasonStr.c_str());
+    this->beforeNackFailover(*pitEntry, inFace, alternative->outFace.get());
+    this->sendPendingInterest(pitEntry, alternative->outFace, pi);
+  }
+  else if (reason == lp::NackReason::CONGESTION) {
+    // the upstream is congested but not broken, and there is nowhere else to go
+    NFD_LOG_DEBUG(pitEntry->getName() << " nack-from=" << inFace.getId() << " nack=" << reason <<
+                  " retransmit");
+    this->sendPendingInterest(pitEntry, nextHop->outFace, pi);
+  }
+  else {
+    nextHop->nackReason = reason;
+    lp::NackReason leastSevereReason = lp::NackReason::NONE;
+    for (const NextHopRetries& other : pi->nextHops) {
+      leastSevereReason = compareLessSevere(leastSevereReason, other.nackReason);
     }
+    lp::NackHeader outNack;
+    outNack.setReason(leastSevereReason);
+
+    NFD_LOG_DEBUG(pitEntry->getName() << " nack-from=" << inFace.getId() << " nack=" << reason <<
+                  " nack-to=all out-nack=" << leastSevereReason);
+    this->beforeNackFailover(*pitEntry, inFace, nullptr);
+    this->sendNacks(pitEntry, outNack);
+    this->removePendingInterest(pi);
+  }
 
-    if (m_pendingInterests.size() > 0) {
-      NFD_LOG_TRACE("Removed interest, actual size " << m_pendingInterests.size());
+  this->drainCongestionQueues();
+}
+
+std::vector<Strategy::CongestionStatus>
+RetriesStrategy::getCongestionStatus() const
+{
+  std::vector<CongestionStatus> statuses;
+  for (const auto& faceIdAndUpstream : m_upstreams) {
+    const Upstream& upstream = faceIdAndUpstream.second;
+    CongestionStatus status;
+    status.faceId = faceIdAndUpstream.first;
+    status.window = upstream.window.getSize();
+    status.nInFlight = upstream.nInFlight;
+    status.nQueued = upstream.nQueued;
+    statuses.push_back(status);
+  }
+
+  std::sort(statuses.begin(), statuses.end(),
+            [] (const CongestionStatus& a, const CongestionStatus& b) { return a.faceId < b.faceId; });
+  return statuses;
+}
+
+const CongestionWindow*
+RetriesStrategy::getCongestionWindow(FaceId faceId) const
+{
+  auto it = m_upstreams.find(faceId);
+  return it == m_upstreams.end() ? nullptr : &it->second.window;
+}
+
+RetriesStrategy::Upstream::Upstream()
+  : nInFlight(0)
+  , nQueued(0)
+{
+}
+
+bool
+RetriesStrategy::acquireWindowSlot(PendingInterest& pi, NextHopRetries& nextHop)
+{
+  FaceId faceId = nextHop.outFace->getId();
+  if (!m_isCongestionControlEnabled || nextHop.isInFlight || faceId == face::INVALID_FACEID)
+    return true;
+
+  Upstream& upstream = m_upstreams[faceId];
+  // an Interest does not overtake queued Interests
+  if (upstream.nQueued == 0 && upstream.window.canSend(upstream.nInFlight)) {
+    nextHop.isInFlight = true;
+    ++upstream.nInFlight;
+    return true;
+  }
+
+  if (!nextHop.isQueued) {
+    nextHop.isQueued = true;
+    ++upstream.nQueued;
+    upstream.queue.push_back(pi.shared_from_this());
+    this->traceCongestion(faceId, upstream);
+  }
+  return false;
+}
+
+void
+RetriesStrategy::releaseWindowSlot(NextHopRetries& nextHop)
+{
+  if (!nextHop.isInFlight && !nextHop.isQueued)
+    return;
+
+  // upstream is gone if the face has been removed
+  auto it = m_upstreams.find(nextHop.outFace->getId());
+  if (it != m_upstreams.end()) {
+    Upstream& upstream = it->second;
+    if (nextHop.isInFlight)
+      --upstream.nInFlight;
+    if (nextHop.isQueued)
+      --upstream.nQueued;
+  }
+  nextHop.isInFlight = false;
+  nextHop.isQueued = false;
+}
+
+void
+RetriesStrategy::handleCongestionSignal(NextHopRetries& nextHop)
+{
+  if (!nextHop.isInFlight)
+    return;
+
+  FaceId faceId = nextHop.outFace->getId();
+  auto it = m_upstreams.find(faceId);
+  if (it != m_upstreams.end() && !nextHop.retriesTimes.empty() &&
+      it->second.window.decrease(nextHop.retriesTimes.back())) {
+    NFD_LOG_DEBUG("Congestion on face " << faceId << " window=" << it->second.window.getSize());
+    this->traceCongestion(faceId, it->second);
+  }
+  this->releaseWindowSlot(nextHop);
+}
+
+void
+RetriesStrategy::drainCongestionQueues()
+{
+  // sendPendingInterest may remove pending Interests and re-enter;
+  // windows that open meanwhile are drained by the next iteration of the outermost call
+  if (m_isDrainingQueues)
+    return;
+  m_isDrainingQueues = true;
+
+  bool hasDequeued = true;
+  while (hasDequeued) {
+    hasDequeued = false;
+    std::vector<FaceId> backlogged;
+    for (const auto& faceIdAndUpstream : m_upstreams) {
+      const Upstream& upstream = faceIdAndUpstream.second;
+      if (upstream.nQueued > 0 && upstream.window.canSend(upstream.nInFlight))
+        backlogged.push_back(faceIdAndUpstream.first);
+    }
 
-      m_pendingInterests.erase(std::find_if(m_pendingInterests.begin(), m_pendingInterests.end(),
-                                            [&](shared_ptr<PendingInterest>& piTmp) { return piTmp->pitEntry == newPi->pitEntry ? true : false;}));
+    for (FaceId faceId : backlogged) {
+      auto it = m_upstreams.find(faceId);
+      if (it != m_upstreams.end() && this->drainCongestionQueue(faceId, it->second))
+        hasDequeued = true;
     }
   }
+
+  m_isDrainingQueues = false;
+}
+
+bool
+RetriesStrategy::drainCongestionQueue(FaceId faceId, Upstream& upstream)
+{
+  bool hasDequeued = false;
+  while (upstream.nQueued > 0 && !upstream.queue.empty() &&
+         upstream.window.canSend(upstream.nInFlight)) {
+    shared_ptr<PendingInterest> pi = upstream.queue.front().lock();
+    upstream.queue.pop_front();
+    if (pi == nullptr)
+      continue;
+
+    auto nextHop = std::find_if(pi->nextHops.begin(), pi->nextHops.end(),
+                                [faceId] (const NextHopRetries& nextHop) {
+                                  return nextHop.outFace->getId() == faceId && nextHop.isQueued;
+                                });
+    if (nextHop == pi->nextHops.end())
+      continue;
+
+    // moved into the window here, because acquireWindowSlot would queue it behind the others
+    nextHop->isQueued = false;
+    --upstream.nQueued;
+    nextHop->isInFlight = true;
+    ++upstream.nInFlight;
+    hasDequeued = true;
+    this->sendPendingInterest(pi->pitEntry, nextHop->outFace, pi);
+  }
+
+  this->traceCongestion(faceId, upstream);
+  return hasDequeued;
+}
+
+void
+RetriesStrategy::traceCongestion(FaceId faceId, const Upstream& upstream)
+{
+  tracepoint(strategyLog, congestion_window, m_name.toUri().c_str(), faceId,
+             upstream.window.getSize(), upstream.nInFlight, upstream.nQueued);
+}
+
+const LinkDegradationDetector*
+RetriesStrategy::getLinkDegradationDetector(FaceId faceId) const
+{
+  auto it = m_links.find(faceId);
+  return it == m_links.end() ? nullptr : &it->second.detector;
+}
+
+RetriesStrategy::LinkState::LinkState()
+  : isSwitchTraced(true)
+{
+}
+
+/** \brief determines whether two faces use the same network interface
+ *
+ *  Faces without an interface name are only on the same interface as themselves.
+ */
+static bool
+isOnSameInterface(const Face& a, const Face& b)
+{
+  if (a.getId() == b.getId())
+    return true;
+
+  std::string interfaceName = a.getInterfaceName();
+  return !interfaceName.empty() && interfaceName == b.getInterfaceName();
+}
+
+void
+RetriesStrategy::handleLinkDegraded(const Face& face, LinkState& link)
+{
+  link.degradedSince = time::steady_clock::now();
+  link.isSwitchTraced = false;
+
+  // sendPendingInterest may remove pending Interests, so candidates are collected first;
+  // Interests outstanding on other faces of the same interface are affected as well
+  std::vector<shared_ptr<PendingInterest>> outstanding;
+  for (const shared_ptr<PendingInterest>& pi : m_pendingInterests) {
+    auto nextHop = std::find_if(pi->nextHops.begin(), pi->nextHops.end(),
+                                [&face] (const NextHopRetries& nextHop) {
+                                  return isOnSameInterface(*nextHop.outFace, face) &&
+                                         !nextHop.retriesTimes.empty();
+                                });
+    if (nextHop != pi->nextHops.end())
+      outstanding.push_back(pi);
+  }
+
+  size_t nDuplicated = 0;
+  for (const shared_ptr<PendingInterest>& pi : outstanding) {
+    auto indexIt = m_pendingInterestIndex.find(pi->pitEntry->getName());
+    if (indexIt == m_pendingInterestIndex.end() || *indexIt->second != pi)
+      continue; // removed while duplicating an earlier one
+
+    if (this->duplicatePendingInterest(*pi, face))
+      ++nDuplicated;
+  }
+
+  auto detectionLatency = time::duration_cast<time::milliseconds>(link.degradedSince -
+                                                                  link.detector.getLastDataTime());
+  std::string reason = boost::lexical_cast<std::string>(link.detector.getReason());
+  tracepoint(strategyLog, link_degraded, m_name.toUri().c_str(), face.getId(),
+             face.getInterfaceName().c_str(), reason.c_str(), detectionLatency.count(), nDuplicated);
+  NFD_LOG_INFO("Face " << face.getId() << " degraded (" << reason << ") detection-latency=" <<
+               detectionLatency << " duplicated=" << nDuplicated << "/" << outstanding.size());
+}
+
+bool
+RetriesStrategy::duplicatePendingInterest(PendingInterest& pi, const Face& degradedFace)
+{
+  NextHopRetries* secondary = nullptr;
+  for (NextHopRetries& nextHop : pi.nextHops) {
+    const Face& upstream = *nextHop.outFace;
+    if (isOnSameInterface(upstream, degradedFace) || upstream.getId() == face::INVALID_FACEID ||
+        upstream.getState() != face::TransportState::UP || !pi.pitEntry->canForwardTo(upstream))
+      continue;
+
+    auto link = m_links.find(upstream.getId());
+    if (link != m_links.end() && link->second.detector.isDegraded())
+      continue;
+
+    if (nextHop.nackReason != lp::NackReason::NONE)
+      continue;
+    if (!nextHop.retriesTimes.empty() || nextHop.isQueued) // already sent or waiting to be sent
+      return false;
+    if (secondary == nullptr)
+      secondary = &nextHop;
+  }
+
+  if (secondary == nullptr)
+    return false;
+
+  pi.handoverFrom = degradedFace.getId();
+  this->sendPendingInterest(pi.pitEntry, secondary->outFace, pi.shared_from_this());
+  return true;
+}
+
+void
+RetriesStrategy::removeFaceState(shared_ptr<Face> face)
+{
+  m_links.erase(face->getId());
+  m_upstreams.erase(face->getId());
+
+  InterfaceWeights* weights = this->getInterfaceWeights();
+  if (weights != nullptr) {
+    weights->removeFace(face->getId());
+  }
+}
+
+RetriesStrategy::NackBackoff::NackBackoff()
+  : duration(0)
+{
+}
+
+RetriesStrategy::NextHopRetries*
+RetriesStrategy::selectFailoverNexthop(PendingInterest& pi, const fib::Entry& fibEntry,
+                                       const Face& failedFace)
+{
+  InterfaceWeights* weights = this->getInterfaceWeights();
+
+  // nextHops are in FIB order, so the first of equally good nexthops has the lowest cost
+  NextHopRetries* best = nullptr;
+  bool isBestBackedOff = false;
+  int bestWeight = 0;
+  for (NextHopRetries& nextHop : pi.nextHops) {
+    const Face& upstream = *nextHop.outFace;
+    if (upstream.getId() == failedFace.getId() || upstream.getId() == face::INVALID_FACEID ||
+        upstream.getState() != face::TransportState::UP || !pi.pitEntry->canForwardTo(upstream) ||
+        nextHop.nackReason != lp::NackReason::NONE || !nextHop.retriesTimes.empty() ||
+        nextHop.isQueued)
+      continue;
+
+    bool isBackedOff = this->isNackBackedOff(fibEntry, upstream);
+    int weight = weights == nullptr ? 0 : weights->getFaceWeight(upstream);
+    if (best == nullptr || (isBestBackedOff && !isBackedOff) ||
+        (isBestBackedOff == isBackedOff && weight > bestWeight)) {
+      best = &nextHop;
+      isBestBackedOff = isBackedOff;
+      bestWeight = weight;
+    }
+  }
+  return best;
+}
+
+bool
+RetriesStrategy::isNackBackedOff(const fib::Entry& fibEntry, const Face& face)
+{
+  shared_ptr<measurements::Entry> me = this->getMeasurements().findExactMatch(fibEntry.getPrefix());
+  if (me == nullptr) {
+    return false;
+  }
+
+  MtInfo* mi = me->getStrategyInfo<MtInfo>();
+  if (mi == nullptr) {
+    return false;
+  }
+
+  auto it = mi->nackBackoffs.find(face.getId());
+  return it != mi->nackBackoffs.end() && it->second.until > time::steady_clock::now();
+}
+
+void
+RetriesStrategy::backOffNexthop(const fib::Entry& fibEntry, FaceId faceId,
+                                const time::steady_clock::TimePoint& sendTime)
+{
+  shared_ptr<measurements::Entry> me = this->getMeasurements().get(fibEntry);
+  if (me == nullptr) { // FIB prefix is outside the namespace of this strategy
+    return;
+  }
+
+  NackBackoff& backoff = me->getOrCreateStrategyInfo<MtInfo>()->nackBackoffs[faceId];
+  if (backoff.duration > time::milliseconds::zero() && sendTime < backoff.since) {
+    // Interest was sent before the current backoff started: same failure
+    return;
+  }
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (backoff.duration == time::milliseconds::zero())
+    backoff.duration = NACK_BACKOFF_INITIAL;
+  else
+    backoff.duration = std::min(backoff.duration * 2, NACK_BACKOFF_MAX);
+  backoff.since = now;
+  backoff.until = now + backoff.duration;
+
+  // keep the backoff for a while after it ends, so that another Nack soon after doubles it
+  this->getMeasurements().extendLifetime(*me, backoff.duration * 2);
+  NFD_LOG_DEBUG("Nexthop " << faceId << " backed off for " << fibEntry.getPrefix() <<
+                " duration=" << backoff.duration);
+}
+
+void
+RetriesStrategy::resetNackBackoff(const pit::Entry& pitEntry, FaceId faceId)
+{
+  auto hasNackBackoff = [faceId] (const measurements::Entry& me) {
+    MtInfo* mi = me.getStrategyInfo<MtInfo>();
+    return mi != nullptr && mi->nackBackoffs.count(faceId) > 0;
+  };
+
+  shared_ptr<measurements::Entry> me = this->getMeasurements().findLongestPrefixMatch(pitEntry,
+                                                                                      hasNackBackoff);
+  if (me != nullptr) {
+    me->getStrategyInfo<MtInfo>()->nackBackoffs.erase(faceId);
+  }
+}
+
+RetriesStrategy::PrefixRtt::PrefixRtt()
+  : generation(0)
+{
+}
+
+time::milliseconds
+RetriesStrategy::computeRto(const pit::Entry& pitEntry, const std::string& interfaceName)
+{
+  uint64_t generation = this->getRttGeneration(interfaceName);
+  auto hasPrefixRtt = [&interfaceName, generation] (const measurements::Entry& me) {
+    MtInfo* mi = me.getStrategyInfo<MtInfo>();
+    if (mi == nullptr) {
+      return false;
+    }
+    auto it = mi->rtt.find(interfaceName);
+    return it != mi->rtt.end() && it->second.generation == generation &&
+           it->second.estimator.hasSamples();
+  };
+
+  shared_ptr<measurements::Entry> me = this->getMeasurements().findLongestPrefixMatch(pitEntry, hasPrefixRtt);
+  if (me != nullptr) {
+    return me->getStrategyInfo<MtInfo>()->rtt[interfaceName].estimator.computeRto();
+  }
+  return rttEstimators[interfaceName].computeRto();
+}
+
+void
+RetriesStrategy::addPrefixRttMeasurement(const Data& data, const std::string& interfaceName,
+                                         const std::vector<time::steady_clock::TimePoint>& retriesTimes)
+{
+  shared_ptr<measurements::Entry> me;
+  if (data.getName().size() >= 1) {
+    me = this->getMeasurements().get(data.getName().getPrefix(-1));
+  }
+  if (me == nullptr) { // parent of Data Name is not in this strategy, or Data Name is empty
+    me = this->getMeasurements().get(data.getName());
+    if (me == nullptr) {
+      return;
+    }
+  }
+
+  static const time::nanoseconds ME_LIFETIME = time::seconds(8);
+  this->getMeasurements().extendLifetime(*me, ME_LIFETIME);
+
+  PrefixRtt& prefixRtt = me->getOrCreateStrategyInfo<MtInfo>()->rtt[interfaceName];
+  uint64_t generation = this->getRttGeneration(interfaceName);
+  if (prefixRtt.generation != generation) {
+    prefixRtt.estimator.reset();
+    prefixRtt.generation = generation;
+  }
+  prefixRtt.estimator.addRttMeasurement(retriesTimes);
+}
+
+void
+RetriesStrategy::resetRttEstimators(const std::string& interfaceName)
+{
+  rttEstimators[interfaceName].reset();
+  ++m_rttGenerations[interfaceName];
+}
+
+uint64_t
+RetriesStrategy::getRttGeneration(const std::string& interfaceName) const
+{
+  auto it = m_rttGenerations.find(interfaceName);
+  return it == m_rttGenerations.end() ? 0 : it->second;
 }
 
 void
@@ -28,11 +28,14 @@
 
 #include "strategy.hpp"
 
-#include <ndn-cxx/util/scheduler.hpp>
+#include <deque>
+
 #include <ndn-cxx/util/network-interface.hpp>
 
 #include <daemon/face/transport.hpp>
 #include "rtt-estimator-retries.hpp"
+#include "link-degradation-detector.hpp"
+#include "congestion-window.hpp"
 
 
 namespace nfd {
@@ -42,32 +45,57 @@ class RetriesStrategy : public Strategy
 {
 public:
 
-  class NextHopRetries
+  class PendingInterest;
+
+  class NextHopRetries : noncopyable
   {
   public:
-    NextHopRetries(shared_ptr<Face> outFace)
+    NextHopRetries(RetriesStrategy& strategy, PendingInterest& pi, shared_ptr<Face> outFace)
       : outFace(outFace)
-      , retryEvent(nullptr) {}
+      , retryTimer(strategy.getRetxTimerWheel(),
+                   [&strategy, &pi, this] { strategy.handleRetryTimeout(pi, *this); })
+      , isInFlight(false)
+      , isQueued(false)
+      , nackReason(lp::NackReason::NONE)
+    {
+    }
 
   public:
-
     shared_ptr<Face> outFace;
-    shared_ptr<ndn::util::scheduler::EventId> retryEvent;
+    RetxTimer retryTimer;
     std::vector<time::steady_clock::TimePoint> retriesTimes;
+
+    /// whether the Interest is counted in the congestion window of outFace
+    bool isInFlight;
+
+    /// whether the Interest waits in the congestion queue of outFace
+    bool isQueued;
+
+    /// reason of the Nack that outFace returned, NONE if the nexthop has not failed
+    lp::NackReason nackReason;
   };
 
-  class PendingInterest
+  class PendingInterest : public enable_shared_from_this<PendingInterest>, noncopyable
   {
   public:
-    PendingInterest(shared_ptr<fib::Entry> fibEntry,
-                    shared_ptr<pit::Entry> pitEntry)
+    PendingInterest(RetriesStrategy& strategy, shared_ptr<pit::Entry> pitEntry)
       : pitEntry(pitEntry)
-      {
-      }
+      , deleteTimer(strategy.getRetxTimerWheel(),
+                    [&strategy, this] {
+                      shared_ptr<PendingInterest> self = this->shared_from_this();
+                      strategy.removePendingInterest(self);
+                      strategy.drainCongestionQueues();
+                    })
+      , handoverFrom(face::INVALID_FACEID)
+    {
+    }
 
     shared_ptr<pit::Entry> pitEntry;
-    shared_ptr<ndn::util::scheduler::EventId> deleteEvent;
-    std::vector<NextHopRetries> nextHops;
+    RetxTimer deleteTimer;
+    std::list<NextHopRetries> nextHops; ///< elements are not movable
+
+    /// degraded face that the Interest was duplicated away from, INVALID_FACEID if none
+    FaceId handoverFrom;
   };
 
 public:
@@ -80,6 +108,43 @@ public:
   beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                         const Face& inFace, const Data& data) DECL_OVERRIDE DECL_FINAL;
 
+  /** \brief fail over to another nexthop on a Nack
+   *
+   *  The nexthop that returned the Nack is backed off for the FIB prefix, see isNackBackedOff.
+   *  The Interest is retransmitted immediately to the eligible nexthop that has not been
+   *  tried, preferring nexthops that are not backed off, then higher interface weight,
+   *  then lower cost. If the Interest is still outstanding on another nexthop, it waits for
+   *  that nexthop instead. If every nexthop has failed, a Nack with the least severe reason
+   *  is returned downstream and the pending Interest is removed.
+   *  A Congestion Nack also shrinks the congestion window of the upstream. If there is
+   *  nowhere else to go, the Interest is retransmitted through the shrunk window.
+   */
+  virtual void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
+
+  virtual std::vector<CongestionStatus>
+  getCongestionStatus() const DECL_OVERRIDE;
+
+  /** \return degradation detector of an upstream face,
+   *          or nullptr if no Interest has been sent on the face
+   */
+  const LinkDegradationDetector*
+  getLinkDegradationDetector(FaceId faceId) const;
+
+  /** \return congestion window of an upstream face,
+   *          or nullptr if no Interest has been sent on the face
+   */
+  const CongestionWindow*
+  getCongestionWindow(FaceId faceId) const;
+
+public:
+  /// backoff of a nexthop after its first Nack for a FIB prefix
+  static const time::milliseconds NACK_BACKOFF_INITIAL;
+
+  /// upper bound of the Nack backoff
+  static const time::milliseconds NACK_BACKOFF_MAX;
+
 protected:
 
   void
@@ -93,6 +158,64 @@ protected:
   virtual bool
   isMainInterface(std::string interfaceName); // TODO better name
 
+  /** \brief enable or disable proactive handover, which is enabled by default
+   *
+   *  When enabled, a LinkDegradationDetector watches every upstream face. Once a face becomes
+   *  degraded, pending Interests outstanding on it and new Interests sent to it are duplicated
+   *  onto another nexthop that is up and not degraded.
+   */
+  void
+  setProactiveHandover(bool isEnabled)
+  {
+    m_isProactiveHandoverEnabled = isEnabled;
+  }
+
+  /** \brief enable or disable congestion control, which is enabled by default
+   *
+   *  When enabled, every upstream face has an AIMD CongestionWindow that grows on Data,
+   *  and shrinks on timeouts and Congestion Nacks. An Interest that does not fit in the window
+   *  of its upstream is queued in the strategy until an Interest leaves the window.
+   *  A strategy that paces Interests with its own per-face window should disable it.
+   *  This should be called in the constructor, before any Interest is sent.
+   */
+  void
+  setCongestionControl(bool isEnabled)
+  {
+    m_isCongestionControlEnabled = isEnabled;
+  }
+
+  /** \return whether \p face is backed off for the prefix of \p fibEntry
+   *
+   *  A nexthop that returns a Nack is backed off for NACK_BACKOFF_INITIAL. Each further Nack
+   *  for an Interest sent after the backoff started doubles the backoff, up to NACK_BACKOFF_MAX.
+   *  A Data from the nexthop under the prefix clears the backoff.
+   *  Subclasses should avoid a backed off nexthop when choosing where to send a new Interest.
+   */
+  bool
+  isNackBackedOff(const fib::Entry& fibEntry, const Face& face);
+
+  /** \brief invoked by beforeSatisfyInterest for every Data that satisfies a PIT entry,
+   *         after the pending Interest, if any, is removed
+   *  \param retriesTimes send times of the Interest on \p inFace, used as an RTT sample;
+   *                      empty if there is no valid sample
+   *
+   *  In this base class this method does nothing.
+   */
+  virtual void
+  beforeSatisfyPendingInterest(const pit::Entry& pitEntry, const Face& inFace, const Data& data,
+                               const std::vector<time::steady_clock::TimePoint>& retriesTimes);
+
+  /** \brief invoked by afterReceiveNack when a pending Interest stops waiting on \p nackFace
+   *  \param newFace the nexthop the Interest fails over to, or nullptr if the Nack is
+   *                 returned downstream
+   *
+   *  This is not invoked when the Interest is retransmitted on \p nackFace after a Congestion Nack.
+   *
+   *  In this base class this method does nothing.
+   */
+  virtual void
+  beforeNackFailover(const pit::Entry& pitEntry, const Face& nackFace, const Face* newFace);
+
 private:
 
   void
@@ -100,9 +223,215 @@ private:
                 shared_ptr<Face> outFace,
                 weak_ptr<PendingInterest> pi);
 
+  /** \brief remove a pending Interest
+   *
+   *  Congestion queues are not drained here, because this may be invoked while iterating over
+   *  pending Interests; the caller should invoke drainCongestionQueues when it is safe.
+   */
   void
   removePendingInterest(weak_ptr<PendingInterest> pi);
 
+  /** \brief cancel timers of a pending Interest that is about to be removed,
+   *         and take it out of congestion windows and queues
+   *
+   *  The caller should invoke drainCongestionQueues after the pending Interest is removed.
+   */
+  void
+  cancelPendingInterestTimers(PendingInterest& pi);
+
+  void
+  handleRetryTimeout(PendingInterest& pi, NextHopRetries& nextHop);
+
+private: // congestion control
+  /** \brief upstream face state for congestion control
+   */
+  class Upstream
+  {
+  public:
+    Upstream();
+
+  public:
+    CongestionWindow window;
+
+    /// number of NextHopRetries with isInFlight on the face
+    size_t nInFlight;
+
+    /** \brief pending Interests waiting for the window to open
+     *
+     *  An element is stale if the pending Interest is gone, or its nexthop on the face is no
+     *  longer isQueued; stale elements are skipped when dequeued, and are not in nQueued.
+     */
+    std::deque<weak_ptr<PendingInterest>> queue;
+
+    /// number of NextHopRetries with isQueued on the face
+    size_t nQueued;
+  };
+
+  /** \brief count an Interest about to be sent in the window of its upstream
+   *  \return whether the Interest can be sent now; if false, the Interest is queued
+   */
+  bool
+  acquireWindowSlot(PendingInterest& pi, NextHopRetries& nextHop);
+
+  /** \brief take an Interest out of the window and the queue of its upstream
+   */
+  void
+  releaseWindowSlot(NextHopRetries& nextHop);
+
+  /** \brief shrink the window on a timeout or a Congestion Nack of an in-flight Interest,
+   *         and take the Interest out of the window
+   */
+  void
+  handleCongestionSignal(NextHopRetries& nextHop);
+
+  /** \brief send queued Interests while windows have room
+   */
+  void
+  drainCongestionQueues();
+
+  /** \return whether any Interest is dequeued
+   */
+  bool
+  drainCongestionQueue(FaceId faceId, Upstream& upstream);
+
+  void
+  traceCongestion(FaceId faceId, const Upstream& upstream);
+
+private: // proactive handover
+  /** \brief upstream face state for proactive handover
+   */
+  class LinkState
+  {
+  public:
+    LinkState();
+
+  public:
+    LinkDegradationDetector detector;
+
+    /// when the latest degradation was detected
+    time::steady_clock::TimePoint degradedSince;
+
+    /// whether the first Data retrieved elsewhere since degradedSince has been traced
+    bool isSwitchTraced;
+  };
+
+  /** \brief duplicate pending Interests outstanding on the interface of a face that has
+   *         just become degraded
+   *
+   *  This happens before the network monitor declares the interface down, if it ever does.
+   *  Retransmissions on the degraded face continue, so that it can recover.
+   */
+  void
+  handleLinkDegraded(const Face& face, LinkState& link);
+
+  /** \brief send a pending Interest to the first nexthop on another interface that is up
+   *         and not degraded
+   *  \return whether the Interest is sent; false if there is no such nexthop,
+   *          or if the Interest has already been sent to one
+   */
+  bool
+  duplicatePendingInterest(PendingInterest& pi, const Face& degradedFace);
+
+  /** \brief remove proactive handover and congestion control state of a face
+   */
+  void
+  removeFaceState(shared_ptr<Face> face);
+
+private: // Nack failover
+  /** \brief choose the nexthop to retransmit a pending Interest to after \p failedFace
+   *         returned a Nack
+   *  \return nexthop that is up and has not been tried, or nullptr if there is none
+   */
+  NextHopRetries*
+  selectFailoverNexthop(PendingInterest& pi, const fib::Entry& fibEntry, const Face& failedFace);
+
+  /** \brief start or double the Nack backoff of a nexthop
+   *  \param sendTime when the Nacked Interest was last sent
+   */
+  void
+  backOffNexthop(const fib::Entry& fibEntry, FaceId faceId,
+                 const time::steady_clock::TimePoint& sendTime);
+
+  /** \brief clear the Nack backoff of a nexthop that has returned Data
+   */
+  void
+  resetNackBackoff(const pit::Entry& pitEntry, FaceId faceId);
+
+private: // RTT estimation
+  /** \brief RTT estimator of a name prefix on an interface
+   */
+  class PrefixRtt
+  {
+  public:
+    PrefixRtt();
+
+  public:
+    RttEstimatorRetries estimator;
+
+    /// estimator is stale if this differs from the interface's generation in m_rttGenerations
+    uint64_t generation;
+  };
+
+  /** \brief Nack backoff of a nexthop for a FIB prefix
+   */
+  class NackBackoff
+  {
+  public:
+    NackBackoff();
+
+  public:
+    /// when the current backoff started
+    time::steady_clock::TimePoint since;
+
+    /// when the current backoff ends
+    time::steady_clock::TimePoint until;
+
+    /// duration of the current backoff
+    time::milliseconds duration;
+  };
+
+  /** \brief StrategyInfo in measurements table
+   */
+  class MtInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1030;
+    }
+
+  public:
+    std::unordered_map<std::string /*interfaceName*/, PrefixRtt> rtt;
+
+    /// on the entry of a FIB prefix
+    std::unordered_map<FaceId, NackBackoff> nackBackoffs;
+  };
+
+  /** \brief compute RTO for pitEntry on an interface
+   *
+   *  The estimator of the longest prefix of the Interest Name that has measurements on the
+   *  interface is used. If there is none, the per-interface estimator is used.
+   */
+  time::milliseconds
+  computeRto(const pit::Entry& pitEntry, const std::string& interfaceName);
+
+  /** \brief add an RTT measurement for Data to per-prefix estimator
+   */
+  void
+  addPrefixRttMeasurement(const Data& data, const std::string& interfaceName,
+                          const std::vector<time::steady_clock::TimePoint>& retriesTimes);
+
+  /** \brief reset per-interface and per-prefix estimators of an interface
+   *
+   *  Per-prefix estimators are reset lazily, when they are next accessed.
+   */
+  void
+  resetRttEstimators(const std::string& interfaceName);
+
+  uint64_t
+  getRttGeneration(const std::string& interfaceName) const;
+
   /**
    * @brief updatePendingInterest
    * @param pitEntry
@@ -130,16 +459,36 @@ private:
   void
   handleInterfaceRemoved(const shared_ptr<ndn::util::NetworkInterface>& ni);
 
-protected:
-  ndn::util::Scheduler m_scheduler;
-
 private:
   const Name& m_name;
-  std::vector<shared_ptr<PendingInterest>> m_pendingInterests; // TODO use PIT measurements (what about zombie?)
+
+  typedef std::list<shared_ptr<PendingInterest>> PendingInterestList;
+
+  /** \brief pending Interests in insertion order, which is also the order of resending
+   *
+   *  A pending Interest outlives its PIT entry by m_interestZombieTime, so that a retransmission
+   *  that creates a new PIT entry is matched to it by Name.
+   */
+  PendingInterestList m_pendingInterests;
+
+  /// index of m_pendingInterests by Interest Name
+  std::unordered_map<Name, PendingInterestList::iterator, name_tree::NameHash> m_pendingInterestIndex;
 
   std::map<std::string /*IntefaceName*/, RttEstimatorRetries> rttEstimators;
 
+  /// incremented when estimators of the interface are reset
+  std::unordered_map<std::string /*interfaceName*/, uint64_t> m_rttGenerations;
+
   time::milliseconds m_interestZombieTime; // TODO better name
+
+  bool m_isProactiveHandoverEnabled;
+  std::unordered_map<FaceId, LinkState> m_links;
+
+  bool m_isCongestionControlEnabled;
+  std::unordered_map<FaceId, Upstream> m_upstreams;
+  bool m_isDrainingQueues;
+
+  signal::ScopedConnection m_removeFaceStateConn;
 };
 
 } // namespace fw
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "retx-timer-wheel.hpp"
+
+namespace nfd {
+namespace fw {
+
+RetxTimerWheel::RetxTimerWheel(time::nanoseconds tick, size_t nSlots)
+  : m_tick(tick)
+  , m_epoch(time::steady_clock::now())
+  , m_slots(nSlots)
+  , m_nTimers(0)
+  , m_lastTick(0)
+  , m_wakeupTick(0)
+{
+  BOOST_ASSERT(tick > time::nanoseconds::zero());
+  BOOST_ASSERT(nSlots > 0);
+}
+
+RetxTimerWheel::~RetxTimerWheel()
+{
+  // unlink remaining timers, so that they don't refer to this wheel upon destruction
+  for (TimerList& slot : m_slots) {
+    slot.clear();
+  }
+  m_dueTimers.clear();
+}
+
+uint64_t
+RetxTimerWheel::getTickAt(const time::steady_clock::TimePoint& t) const
+{
+  if (t <= m_epoch) {
+    return 0;
+  }
+  return static_cast<uint64_t>((t - m_epoch).count() / m_tick.count());
+}
+
+time::steady_clock::TimePoint
+RetxTimerWheel::getTickTime(uint64_t tick) const
+{
+  return m_epoch + m_tick * static_cast<time::nanoseconds::rep>(tick);
+}
+
+void
+RetxTimerWheel::schedule(RetxTimer& timer, time::nanoseconds delay)
+{
+  timer.cancel();
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  if (m_nTimers == 0) {
+    // wheel was idle; skip the ticks that passed meanwhile
+    m_lastTick = this->getTickAt(now);
+  }
+
+  // first tick at or after expiry
+  time::steady_clock::TimePoint expiry = now + delay;
+  uint64_t tick = this->getTickAt(expiry);
+  if (this->getTickTime(tick) < expiry) {
+    ++tick;
+  }
+  tick = std::max(tick, m_lastTick + 1);
+
+  timer.m_expiryTick = tick;
+  m_slots[tick % m_slots.size()].push_back(timer);
+  ++m_nTimers;
+
+  if (m_nTimers == 1 || tick < m_wakeupTick) {
+    m_wakeupTick = tick;
+    m_wakeupEvent = scheduler::schedule(this->getTickTime(tick) - now,
+                                        bind(&RetxTimerWheel::processTimers, this));
+  }
+}
+
+void
+RetxTimerWheel::cancel(RetxTimer& timer)
+{
+  BOOST_ASSERT(timer.m_hook.is_linked());
+  timer.m_hook.unlink();
+  --m_nTimers;
+}
+
+void
+RetxTimerWheel::processTimers()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  uint64_t currentTick = this->getTickAt(now);
+
+  // every slot is visited at most once, even if the wakeup is late by more than a revolution
+  uint64_t firstTick = std::max(m_lastTick + 1, currentTick >= m_slots.size() ?
+                                                currentTick - m_slots.size() + 1 : 0);
+  for (uint64_t tick = firstTick; tick <= currentTick; ++tick) {
+    TimerList& slot = m_slots[tick % m_slots.size()];
+    for (auto it = slot.begin(); it != slot.end();) {
+      if (it->m_expiryTick <= currentTick) {
+        RetxTimer& timer = *it;
+        it = slot.erase(it);
+        m_dueTimers.push_back(timer);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+  m_lastTick = std::max(m_lastTick, currentTick);
+
+  while (!m_dueTimers.empty()) {
+    RetxTimer& timer = m_dueTimers.front();
+    m_dueTimers.pop_front();
+    --m_nTimers;
+
+    // The callback may destruct the timer, so it is moved out while it runs, and moved back
+    // unless the timer is gone. Unlike a copy, this never allocates.
+    bool isDestructed = false;
+    RetxTimer::Callback callback = std::move(timer.m_callback);
+    timer.m_isDestructed = &isDestructed;
+    callback();
+    if (!isDestructed) {
+      timer.m_isDestructed = nullptr;
+      timer.m_callback = std::move(callback);
+    }
+  }
+
+  this->scheduleNextWakeup(now);
+}
+
+void
+RetxTimerWheel::scheduleNextWakeup(const time::steady_clock::TimePoint& now)
+{
+  if (m_nTimers == 0) {
+    m_wakeupEvent.cancel();
+    return;
+  }
+
+  // find the next tick whose slot is not empty; its timers may still be a few revolutions away
+  uint64_t tick = m_lastTick + 1;
+  for (size_t i = 0; i < m_slots.size() && m_slots[tick % m_slots.size()].empty(); ++i) {
+    ++tick;
+  }
+
+  m_wakeupTick = tick;
+  time::nanoseconds delay = std::max(time::nanoseconds::zero(), this->getTickTime(tick) - now);
+  m_wakeupEvent = scheduler::schedule(delay, bind(&RetxTimerWheel::processTimers, this));
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,208 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_FW_RETX_TIMER_WHEEL_HPP
+#define NFD_DAEMON_FW_RETX_TIMER_WHEEL_HPP
+
+#include "core/scheduler.hpp"
+
+#include <boost/intrusive/list.hpp>
+
+namespace nfd {
+namespace fw {
+
+class RetxTimerWheel;
+
+/** \brief a retransmission timer
+ *
+ *  RetxTimer is meant to be embedded in per-Interest strategy state. Its callback is set once
+ *  at construction, so that scheduling, rescheduling and cancelling a timer involve no memory
+ *  allocation. A timer is cancelled when it is destructed.
+ */
+class RetxTimer : noncopyable
+{
+public:
+  typedef function<void()> Callback;
+
+  /** \param wheel the timer wheel that runs this timer, must outlive this timer
+   *  \param callback invoked when the timer expires; it may reschedule or destruct this timer
+   */
+  RetxTimer(RetxTimerWheel& wheel, const Callback& callback);
+
+  ~RetxTimer();
+
+  /** \brief schedules the timer to expire after \p delay
+   *
+   *  If the timer is pending, it is rescheduled.
+   */
+  void
+  schedule(time::nanoseconds delay);
+
+  /** \brief cancels the timer if it is pending
+   */
+  void
+  cancel();
+
+  /** \return whether the timer is scheduled and has not expired
+   */
+  bool
+  isPending() const;
+
+private:
+  typedef boost::intrusive::list_member_hook<
+            boost::intrusive::link_mode<boost::intrusive::auto_unlink>> Hook;
+
+  RetxTimerWheel& m_wheel;
+  Callback m_callback;
+  uint64_t m_expiryTick;
+  Hook m_hook;
+
+  /// while the callback runs, set to true if this timer is destructed
+  bool* m_isDestructed;
+
+  friend class RetxTimerWheel;
+};
+
+/** \brief runs retransmission timers of all strategies
+ *
+ *  Timers are kept in intrusive lists on a hashed timing wheel, so that inserting and removing
+ *  a timer takes constant time. A single scheduler event wakes the wheel at the next tick
+ *  that has timers, and all timers due by then are fired in one batch.
+ *  Timers fire at the first tick at or after their expiry.
+ */
+class RetxTimerWheel : noncopyable
+{
+public:
+  explicit
+  RetxTimerWheel(time::nanoseconds tick = time::milliseconds(1), size_t nSlots = 1024);
+
+  ~RetxTimerWheel();
+
+  /** \return number of pending timers
+   */
+  size_t
+  size() const;
+
+  time::nanoseconds
+  getTick() const;
+
+private:
+  typedef boost::intrusive::list<RetxTimer,
+            boost::intrusive::member_hook<RetxTimer, RetxTimer::Hook, &RetxTimer::m_hook>,
+            boost::intrusive::constant_time_size<false>> TimerList;
+
+  void
+  schedule(RetxTimer& timer, time::nanoseconds delay);
+
+  void
+  cancel(RetxTimer& timer);
+
+  /** \brief fires timers that are due, and schedules the next wakeup
+   */
+  void
+  processTimers();
+
+  /** \brief schedules a wakeup at the next tick that has timers
+   */
+  void
+  scheduleNextWakeup(const time::steady_clock::TimePoint& now);
+
+  uint64_t
+  getTickAt(const time::steady_clock::TimePoint& t) const;
+
+  time::steady_clock::TimePoint
+  getTickTime(uint64_t tick) const;
+
+private:
+  const time::nanoseconds m_tick;
+  const time::steady_clock::TimePoint m_epoch;
+  std::vector<TimerList> m_slots;
+  TimerList m_dueTimers;
+  size_t m_nTimers;
+
+  /// timers expiring at or before this tick have been moved to m_dueTimers
+  uint64_t m_lastTick;
+
+  uint64_t m_wakeupTick;
+  scheduler::ScopedEventId m_wakeupEvent;
+
+  friend class RetxTimer;
+};
+
+inline
+RetxTimer::RetxTimer(RetxTimerWheel& wheel, const Callback& callback)
+  : m_wheel(wheel)
+  , m_callback(callback)
+  , m_expiryTick(0)
+  , m_isDestructed(nullptr)
+{
+}
+
+inline
+RetxTimer::~RetxTimer()
+{
+  this->cancel();
+  if (m_isDestructed != nullptr) {
+    *m_isDestructed = true;
+  }
+}
+
+inline void
+RetxTimer::schedule(time::nanoseconds delay)
+{
+  m_wheel.schedule(*this, delay);
+}
+
+inline void
+RetxTimer::cancel()
+{
+  if (this->isPending()) {
+    m_wheel.cancel(*this);
+  }
+}
+
+inline bool
+RetxTimer::isPending() const
+{
+  return m_hook.is_linked();
+}
+
+inline size_t
+RetxTimerWheel::size() const
+{
+  return m_nTimers;
+}
+
+inline time::nanoseconds
+RetxTimerWheel::getTick() const
+{
+  return m_tick;
+}
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_RETX_TIMER_WHEEL_HPP
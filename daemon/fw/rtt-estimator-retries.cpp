@@ -36,49 +36,40 @@ RttEstimatorRetries::RttEstimatorRetries()
   rttVarWeight.first = 0.125;  // Old value
   rttVarWeight.second = 0.875; // New value
 
-  m_rttMean = -1;
   m_lastRtt = -1; // currently unused
   m_rttMulti = 2;
   m_rttMin = 10;
   m_rttMax = 1000;
   m_rtt0 = 250;
-  m_rttMinCalc = -1;
 
-  m_nSamples = 5;
+  this->reset();
 }
 
 float
-RttEstimatorRetries::addRttMeasurement(std::vector<time::steady_clock::TimePoint> retries)
+RttEstimatorRetries::addRttMeasurement(const std::vector<time::steady_clock::TimePoint>& retries)
 {
+  if (retries.empty()) {
+    return -1; // This should not happen (data received without a sent interest)
+  }
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
   float rtt = -1;
   if (retries.size() == 1) { // No retry
-    rtt = (time::duration_cast<time::milliseconds> (time::steady_clock::now() - retries[0])).count();
+    rtt = (time::duration_cast<time::milliseconds> (now - retries[0])).count();
 
-    if (m_rttMinCalc == -1) {
-      m_rttMinCalc = rtt;
-      tracepoint(strategyLog, rtt_min_calc, m_rttMinCalc);
-    }
-    else if (rtt < m_rttMinCalc) {
+    if (m_rttMinCalc == -1 || rtt < m_rttMinCalc) {
       m_rttMinCalc = rtt;
       tracepoint(strategyLog, rtt_min_calc, m_rttMinCalc);
     }
-    /*else {
-      m_rttMinCalc = (m_rttMinCalc * rttMeanWeight.first) + (rtt * rttMeanWeight.second);
-      tracepoint(strategyLog, rtt_min_calc, m_rttMinCalc);
-    }*/
-
-
-    //NFD_LOG_DEBUG("Rtt min calc: " << m_rttMinCalc);
   }
-  else if (retries.size() > 1) { // At least 1 retry
-    for (int i = retries.size(); i > 0; i--) {
-      rtt = (time::duration_cast<time::milliseconds> (time::steady_clock::now() - retries[i - 1])).count();
+  else { // At least 1 retry
+    // take the latest retry that was sent at least m_rttMinCalc ago
+    for (size_t i = retries.size(); i > 0; i--) {
+      rtt = (time::duration_cast<time::milliseconds> (now - retries[i - 1])).count();
       if (m_rttMinCalc != -1 && rtt >= m_rttMinCalc)
         break;
     }
   }
-  else
-    return -1; // This should not happen (data received without a sent interest)
 
   float rttOriginal = rtt;
 
@@ -96,31 +87,39 @@ RttEstimatorRetries::addRttMeasurement(std::vector<time::steady_clock::TimePoint
     rtt = m_rttMax;
   }
 
-  while (m_oldRtt.size() > m_nSamples) {
-    m_oldRtt.erase(m_oldRtt.begin());
+  if (m_nStoredSamples < N_SAMPLES) {
+    m_samples[(m_firstSample + m_nStoredSamples) % N_SAMPLES] = rtt;
+    ++m_nStoredSamples;
   }
-  m_oldRtt.push_back(rtt);
-
-  float newMean = m_oldRtt[0];
-  float newVar = m_oldRtt[0] / 2;
-  for(uint32_t i = 1; i < m_oldRtt.size(); i++) {
-    newVar = (newVar * rttVarWeight.first) + (std::abs(m_oldRtt[i] - newMean) * rttVarWeight.second);
-    newMean = (newMean * rttMeanWeight.first) + (m_oldRtt[i] * rttMeanWeight.second);
+  else { // overwrite the oldest sample
+    m_samples[m_firstSample] = rtt;
+    m_firstSample = (m_firstSample + 1) % N_SAMPLES;
   }
-
   m_lastRtt = rtt;
-  m_rttMean = newMean;
-  m_rttVar = newVar;
 
+  this->updateRto();
+  return rttOriginal;
+}
 
-  /*if (m_rttMean == -1)
-    m_rttMean = rtt;
-  else
-    m_rttMean = (m_rttMean * rttMeanWeight.first) + (rtt * rttMeanWeight.second);
-  m_lastRtt = rtt;*/
-
+void
+RttEstimatorRetries::updateRto()
+{
+  // The window is re-folded from its oldest sample, because the oldest sample seeds both
+  // the mean and the variance. This is bounded by N_SAMPLES.
+  float newMean = m_samples[m_firstSample];
+  float newVar = newMean / 2;
+  for (size_t i = 1; i < m_nStoredSamples; i++) {
+    float sample = m_samples[(m_firstSample + i) % N_SAMPLES];
+    newVar = (newVar * rttVarWeight.first) + (std::abs(sample - newMean) * rttVarWeight.second);
+    newMean = (newMean * rttMeanWeight.first) + (sample * rttMeanWeight.second);
+  }
+  m_rttMean = newMean;
+  m_rttVar = newVar;
 
-  return rttOriginal;
+  int rto = std::ceil(m_rttMulti * (m_rttMean + (m_rttVar * 4)));
+  if (rto < 5) // just to limit NFD packet flood, we need a better way to do it TODO delete when NFD can process more packets
+    rto = 5;
+  m_rto = time::milliseconds(rto);
 }
 
 void
@@ -129,33 +128,22 @@ RttEstimatorRetries::reset()
   m_rttMean = -1;
   m_rttVar = -1;
   m_rttMinCalc = -1;
-  m_oldRtt.clear();
+  m_firstSample = 0;
+  m_nStoredSamples = 0;
+
+  // initial RTO uses m_rtt0 as the mean
+  int rto = std::ceil(m_rttMulti * (m_rtt0 + (m_rttVar * 4)));
+  m_rto = time::milliseconds(rto);
 }
 
 time::milliseconds
 RttEstimatorRetries::computeRto()
 {
-  // DEBUG only
-  //if (time::duration_cast<time::milliseconds>(time::steady_clock::now() - lastRttTime) > time::seconds(10))
-    //m_rttMean = -1;
-
   if (m_rttMean == -1) {
-    if (m_lastRtt == -1)
-      m_rttMean = m_rtt0;
-    else
-      m_rttMean = m_rtt0; // last rtt
+    m_rttMean = m_rtt0;
   }
-
-  //int rtt = std::ceil(m_rttMean * m_rttMulti);
-  int rtt = std::ceil(m_rttMulti * (m_rttMean + (m_rttVar * 4)));
-
-  if (rtt < 5) // just to limit NFD packet flood, we need a better way to do it TODO delete when NFD can process more packets
-    rtt = 5;
-
-  return time::milliseconds(rtt);
+  return m_rto;
 }
 
-
-
 } // namespace nfd
 
@@ -28,18 +28,24 @@
 
 #include "common.hpp"
 
+#include <array>
+
 namespace nfd {
 
 class RttEstimatorRetries
 {
 public:
-
-
   RttEstimatorRetries();
 
+  /** \brief add a measurement
+   *  \param retries send times of the Interest, in order; the last one is the latest retry
+   *  \return RTT sample before clamping, or -1 if \p retries is empty
+   */
   float
-  addRttMeasurement(std::vector<time::steady_clock::TimePoint> retries);
+  addRttMeasurement(const std::vector<time::steady_clock::TimePoint>& retries);
 
+  /** \return RTO, which is recalculated only when a measurement is added or on reset
+   */
   time::milliseconds
   computeRto();
 
@@ -56,7 +62,32 @@ public:
     return m_lastRtt;
   }
 
+  /** \return minimum RTT in milliseconds among Interests that were not retransmitted,
+   *          or -1 if there is none
+   */
+  float
+  getMinRtt() const {
+    return m_rttMinCalc;
+  }
+
+  /** \return whether a measurement has been added since construction or the last reset
+   */
+  bool
+  hasSamples() const {
+    return m_nStoredSamples > 0;
+  }
+
+private:
+  /** \brief recalculate mean and variance from the sample window, and cache the RTO
+   */
+  void
+  updateRto();
+
 private:
+  /** \brief maximum number of samples in the window
+   */
+  static const size_t N_SAMPLES = 6;
+
   // Rtt
   float m_rttMean;
   float m_rttVar;
@@ -67,8 +98,12 @@ private:
   float m_lastRtt;
   float m_rttMinCalc;
 
-  uint32_t m_nSamples;
-  std::vector<float> m_oldRtt;
+  time::milliseconds m_rto;
+
+  /// ring buffer of RTT samples, oldest at m_firstSample
+  std::array<float, N_SAMPLES> m_samples;
+  size_t m_firstSample;
+  size_t m_nStoredSamples;
   std::pair<float /*old*/, float /*new*/> rttMeanWeight;
   std::pair<float /*old*/, float /*new*/> rttVarWeight;
   time::steady_clock::TimePoint lastRttTime;
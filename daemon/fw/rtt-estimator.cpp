@@ -76,4 +76,13 @@ RttEstimator::computeRto() const
   return Duration(static_cast<Duration::rep>(rto));
 }
 
+RttEstimator::Duration
+RttEstimator::getSmoothedRtt() const
+{
+  if (m_nSamples == 0) {
+    return Duration::zero();
+  }
+  return Duration(static_cast<Duration::rep>(m_rtt));
+}
+
 } // namespace nfd
@@ -67,6 +67,11 @@ public:
   Duration
   computeRto() const;
 
+  /** \return smoothed RTT, or zero if there is no measurement
+   */
+  Duration
+  getSmoothedRtt() const;
+
 private:
   uint16_t m_maxMultiplier;
   double m_minRto;
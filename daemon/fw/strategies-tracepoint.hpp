@@ -100,6 +100,84 @@ TRACEPOINT_EVENT(
   )
 )
 
+TRACEPOINT_EVENT(
+  strategyLog,
+  link_degraded,
+  TP_ARGS(
+    const char*, strategyName,
+    int, faceId,
+    const char*, interfaceName,
+    const char*, reason,
+    int, detectionLatency,
+    int, nDuplicated
+  ),
+  TP_FIELDS(
+    ctf_string(strategy_name, strategyName)
+    ctf_integer(int, face_id, faceId)
+    ctf_string(interface_name, interfaceName)
+    ctf_string(reason, reason)
+    ctf_integer(int, detection_latency, detectionLatency)
+    ctf_integer(int, num_duplicated, nDuplicated)
+  )
+)
+
+TRACEPOINT_EVENT(
+  strategyLog,
+  link_switched,
+  TP_ARGS(
+    const char*, strategyName,
+    int, fromFaceId,
+    int, toFaceId,
+    const char*, toInterfaceName,
+    int, switchLatency
+  ),
+  TP_FIELDS(
+    ctf_string(strategy_name, strategyName)
+    ctf_integer(int, from_face_id, fromFaceId)
+    ctf_integer(int, to_face_id, toFaceId)
+    ctf_string(to_interface_name, toInterfaceName)
+    ctf_integer(int, switch_latency, switchLatency)
+  )
+)
+
+TRACEPOINT_EVENT(
+  strategyLog,
+  nack_failover,
+  TP_ARGS(
+    const char*, strategyName,
+    const char*, interest,
+    int, fromFaceId,
+    int, toFaceId,
+    const char*, reason
+  ),
+  TP_FIELDS(
+    ctf_string(strategy_name, strategyName)
+    ctf_string(interest_name, interest)
+    ctf_integer(int, from_face_id, fromFaceId)
+    ctf_integer(int, to_face_id, toFaceId)
+    ctf_string(reason, reason)
+  )
+)
+
+TRACEPOINT_EVENT(
+  strategyLog,
+  congestion_window,
+  TP_ARGS(
+    const char*, strategyName,
+    int, faceId,
+    double, window,
+    int, nInFlight,
+    int, nQueued
+  ),
+  TP_FIELDS(
+    ctf_string(strategy_name, strategyName)
+    ctf_integer(int, face_id, faceId)
+    ctf_float(double, window, window)
+    ctf_integer(int, num_in_flight, nInFlight)
+    ctf_integer(int, num_queued, nQueued)
+  )
+)
+
 TRACEPOINT_EVENT(
   strategyLog,
   rtt_min,
@@ -57,6 +57,31 @@ StrategyInfo::~StrategyInfo()
 {
 }
 
+/** \brief number of fixed slots in StrategyInfoHost
+ */
+constexpr size_t STRATEGY_INFO_N_SLOTS = 7;
+
+/** \brief registry of StrategyInfo types that have a fixed slot in StrategyInfoHost
+ *  \return slot index of StrategyInfo type \p typeId,
+ *          or STRATEGY_INFO_N_SLOTS if the type has no fixed slot
+ *
+ *  A type with a fixed slot is found without a search and without allocating storage
+ *  for the item container. Types not listed here still work, but are kept in a map.
+ *  Types that share a TypeId share a slot.
+ */
+constexpr size_t
+getStrategyInfoSlot(int typeId)
+{
+  return typeId == 1000 ? 0 : // NccStrategy::MeasurementsEntryInfo
+         typeId == 1001 ? 1 : // NccStrategy::PitEntryInfo
+         typeId == 1010 ? 2 : // AccessStrategy::PitInfo, VehicularPriorityStrategy::PitInfo
+         typeId == 1011 ? 3 : // AccessStrategy::MtInfo, VehicularPriorityStrategy::MtInfo
+         typeId == 1020 ? 4 : // RetxSuppressionExponential::PitInfo
+         typeId == 1030 ? 5 : // RetriesStrategy::MtInfo
+         typeId == 1040 ? 6 : // MultipathStripingStrategy::PitInfo
+         STRATEGY_INFO_N_SLOTS;
+}
+
 } // namespace fw
 } // namespace nfd
 
@@ -68,6 +68,24 @@ Strategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
                 " pitEntry=" << pitEntry->getName());
 }
 
+InterfaceWeights*
+Strategy::getInterfaceWeights()
+{
+  return nullptr;
+}
+
+InterestScheduler*
+Strategy::getInterestScheduler()
+{
+  return nullptr;
+}
+
+std::vector<Strategy::CongestionStatus>
+Strategy::getCongestionStatus() const
+{
+  return {};
+}
+
 void
 Strategy::sendNacks(shared_ptr<pit::Entry> pitEntry, const lp::NackHeader& header,
                     std::initializer_list<const Face*> exceptFaces)
@@ -33,6 +33,9 @@
 namespace nfd {
 namespace fw {
 
+class InterfaceWeights;
+class InterestScheduler;
+
 /** \brief represents a forwarding strategy
  */
 class Strategy : public enable_shared_from_this<Strategy>, noncopyable
@@ -130,6 +133,51 @@ public: // triggers
   afterReceiveNack(const Face& inFace, const lp::Nack& nack,
                    shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry);
 
+public: // parameters
+  /** \brief get interface weights of this strategy
+   *  \return interface weights that can be updated through configuration and management,
+   *          or nullptr if the strategy does not use interface weights
+   *
+   *  In this base class this method returns nullptr.
+   */
+  virtual InterfaceWeights*
+  getInterfaceWeights();
+
+  /** \brief get outgoing Interest scheduler of this strategy
+   *  \return Interest scheduler that can be configured through configuration,
+   *          or nullptr if the strategy sends Interests immediately
+   *
+   *  In this base class this method returns nullptr.
+   */
+  virtual InterestScheduler*
+  getInterestScheduler();
+
+public: // status
+  /** \brief congestion control state of an upstream face
+   */
+  class CongestionStatus
+  {
+  public:
+    FaceId faceId;
+
+    /// congestion window, in Interests
+    double window;
+
+    /// number of Interests sent on the face and counted in the window
+    size_t nInFlight;
+
+    /// number of Interests waiting for the window to open
+    size_t nQueued;
+  };
+
+  /** \brief get congestion control state of upstream faces
+   *  \return state of every upstream face that the strategy controls, ordered by FaceId
+   *
+   *  In this base class this method returns an empty collection.
+   */
+  virtual std::vector<CongestionStatus>
+  getCongestionStatus() const;
+
 protected: // actions
   /** \brief send Interest to outFace
    *  \param pitEntry PIT entry
@@ -182,6 +230,11 @@ protected: // accessors
   const FaceTable&
   getFaceTable();
 
+  /** \brief timer wheel for retransmission timers, shared by all strategies
+   */
+  RetxTimerWheel&
+  getRetxTimerWheel();
+
 protected: // accessors
   signal::Signal<FaceTable, shared_ptr<Face>>& afterAddFace;
   signal::Signal<FaceTable, shared_ptr<Face>>& beforeRemoveFace;
@@ -243,6 +296,28 @@ Strategy::getFaceTable()
   return m_forwarder.getFaceTable();
 }
 
+inline RetxTimerWheel&
+Strategy::getRetxTimerWheel()
+{
+  return m_forwarder.getRetxTimerWheel();
+}
+
+/** \return less severe NackReason between x and y
+ *
+ *  lp::NackReason::NONE is treated as most severe
+ */
+inline lp::NackReason
+compareLessSevere(lp::NackReason x, lp::NackReason y)
+{
+  if (x == lp::NackReason::NONE) {
+    return y;
+  }
+  if (y == lp::NackReason::NONE) {
+    return x;
+  }
+  return static_cast<lp::NackReason>(std::min(static_cast<int>(x), static_cast<int>(y)));
+}
+
 } // namespace fw
 } // namespace nfd
 
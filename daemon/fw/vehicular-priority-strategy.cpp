@@ -36,6 +36,7 @@ NFD_REGISTER_STRATEGY(VehicularPriorityStrategy);
 
 VehicularPriorityStrategy::VehicularPriorityStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder, name)
+  , m_interestScheduler(bind(&VehicularPriorityStrategy::sendScheduledInterest, this, _1, _2))
   , m_removeFaceInfoConn(this->beforeRemoveFace.connect(
                          bind(&VehicularPriorityStrategy::removeFaceInfo, this, _1)))
 {
@@ -45,6 +46,12 @@ VehicularPriorityStrategy::~VehicularPriorityStrategy()
 {
 }
 
+InterestScheduler*
+VehicularPriorityStrategy::getInterestScheduler()
+{
+  return &m_interestScheduler;
+}
+
 void
 VehicularPriorityStrategy::afterReceiveInterest(const Face& inFace,
                                      const Interest& interest,
@@ -75,7 +82,7 @@ VehicularPriorityStrategy::afterReceiveNewInterest(const Face& inFace,
                                                    shared_ptr<pit::Entry> pitEntry)
 {
   Name miName;
-  shared_ptr<MtInfo> mi;
+  MtInfo* mi;
   std::tie(miName, mi) = this->findPrefixMeasurements(*pitEntry);
 
   // has measurements for Interest Name?
@@ -108,9 +115,9 @@ VehicularPriorityStrategy::afterReceiveNewInterest(const Face& inFace,
   // TODO roba mia, invia a tutti
   NFD_LOG_DEBUG("Eligible next faces number: " <<nexthops.size());
   for (fib::NextHopList::const_iterator it = nexthops.begin(); it != nexthops.end(); ++it) {
-    shared_ptr<Face> outFace = it->getFace();
-    if (pitEntry->canForwardTo(*outFace) &&
-        outFace->getState() == nfd::face::TransportState::UP) {
+    if (pitEntry->canForwardTo(it->getFace()) &&
+        it->getFace().getState() == nfd::face::TransportState::UP) {
+      shared_ptr<Face> outFace = it->getFace().shared_from_this();
       NFD_LOG_DEBUG("Sending to " << outFace->getId());
 
 
@@ -120,7 +127,7 @@ VehicularPriorityStrategy::afterReceiveNewInterest(const Face& inFace,
                                                         fibEntry, pitEntry, outFace))));
 
 
-      this->sendInterest(pitEntry, outFace);
+      this->scheduleInterest(pitEntry, outFace);
       NFD_LOG_DEBUG(interest << " from=" << inFace.getId()
                              << " newPitEntry-to=" << outFace->getId());
       return;
@@ -168,13 +175,16 @@ VehicularPriorityStrategy::sendToLastNexthop(const Face& inFace, shared_ptr<pit:
   NFD_LOG_DEBUG(pitEntry->getInterest() << " interestTo " << mi.lastNexthop <<
                 " last-nexthop rto=" << time::duration_cast<time::microseconds>(rto).count());
 
-  this->sendInterest(pitEntry, face);
+  // the RTO timer starts when the Interest leaves the scheduler queue, see sendScheduledInterest;
+  // if the scheduler drops it, its deadline would be missed anyway
+  PitInfo* pi = pitEntry->getOrCreateStrategyInfo<PitInfo>();
+  pi->rtoTimer.cancel();
+  pi->rtoFace = mi.lastNexthop;
+  pi->rto = rto;
+  pi->rtoFibEntry = fibEntry;
+  pi->rtoInFace = inFace.getId();
 
-  // schedule RTO timeout
-  shared_ptr<PitInfo> pi = pitEntry->getOrCreateStrategyInfo<PitInfo>();
-  pi->rtoTimer = scheduler::schedule(rto,
-      bind(&VehicularPriorityStrategy::afterRtoTimeout, this, weak_ptr<pit::Entry>(pitEntry),
-           weak_ptr<fib::Entry>(fibEntry), inFace.getId(), mi.lastNexthop));
+  this->scheduleInterest(pitEntry, face);
 
   return true;
 }
@@ -212,13 +222,13 @@ VehicularPriorityStrategy::multicast(shared_ptr<pit::Entry> pitEntry, shared_ptr
                                      std::unordered_set<FaceId> exceptFaces)
 {
   for (const fib::NextHop& nexthop : fibEntry->getNextHops()) {
-    shared_ptr<Face> face = nexthop.getFace();
-    if (exceptFaces.count(face->getId()) > 0) {
+    Face& face = nexthop.getFace();
+    if (exceptFaces.count(face.getId()) > 0) {
       continue;
     }
-    NFD_LOG_DEBUG(pitEntry->getInterest() << " interestTo " << face->getId() <<
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " interestTo " << face.getId() <<
                   " multicast");
-    this->sendInterest(pitEntry, face);
+    this->scheduleInterest(pitEntry, face.shared_from_this());
   }
 }
 
@@ -226,7 +236,7 @@ void
 VehicularPriorityStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                                       const Face& inFace, const Data& data)
 {
-  shared_ptr<PitInfo> pi = pitEntry->getStrategyInfo<PitInfo>();
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
   if (pi != nullptr) {
     pi->rtoTimer.cancel();
   }
@@ -286,7 +296,7 @@ VehicularPriorityStrategy::updateMeasurements(const Face& inFace, const Data& da
   FaceInfo& fi = m_fit[inFace.getId()];
   fi.rtt.addMeasurement(rtt);
 
-  shared_ptr<MtInfo> mi = this->addPrefixMeasurements(data);
+  MtInfo* mi = this->addPrefixMeasurements(data);
   if (mi->lastNexthop != inFace.getId()) {
     mi->lastNexthop = inFace.getId();
     mi->rtt = fi.rtt;
@@ -296,6 +306,35 @@ VehicularPriorityStrategy::updateMeasurements(const Face& inFace, const Data& da
   }
 }
 
+void
+VehicularPriorityStrategy::scheduleInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                            const shared_ptr<Face>& outFace)
+{
+  time::nanoseconds expectedRtt = time::nanoseconds::zero();
+  auto fi = m_fit.find(outFace->getId());
+  if (fi != m_fit.end()) {
+    expectedRtt = fi->second.rtt.getSmoothedRtt();
+  }
+  m_interestScheduler.schedule(pitEntry, outFace, expectedRtt);
+}
+
+void
+VehicularPriorityStrategy::sendScheduledInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                                 const shared_ptr<Face>& outFace)
+{
+  this->sendInterest(pitEntry, outFace);
+
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi == nullptr || pi->rtoFace != outFace->getId()) {
+    return;
+  }
+
+  pi->rtoFace = face::INVALID_FACEID;
+  pi->rtoTimer = scheduler::schedule(pi->rto,
+      bind(&VehicularPriorityStrategy::afterRtoTimeout, this, weak_ptr<pit::Entry>(pitEntry),
+           pi->rtoFibEntry, pi->rtoInFace, outFace->getId()));
+}
+
 // TODO mio solo per test per ora
 void VehicularPriorityStrategy::handleFaceDown(const nfd::face::Face& inFace,
                                                const ndn::Interest& interest,
@@ -318,13 +357,19 @@ void VehicularPriorityStrategy::handleFaceDown(const nfd::face::Face& inFace,
 
 }
 
+VehicularPriorityStrategy::PitInfo::PitInfo()
+  : rtoFace(face::INVALID_FACEID)
+  , rtoInFace(face::INVALID_FACEID)
+{
+}
+
 VehicularPriorityStrategy::MtInfo::MtInfo()
   : lastNexthop(face::INVALID_FACEID)
   , rtt(1, time::milliseconds(1), 0.1)
 {
 }
 
-std::tuple<Name, shared_ptr<VehicularPriorityStrategy::MtInfo>>
+std::tuple<Name, VehicularPriorityStrategy::MtInfo*>
 VehicularPriorityStrategy::findPrefixMeasurements(const pit::Entry& pitEntry)
 {
   shared_ptr<measurements::Entry> me = this->getMeasurements().findLongestPrefixMatch(pitEntry);
@@ -332,14 +377,14 @@ VehicularPriorityStrategy::findPrefixMeasurements(const pit::Entry& pitEntry)
     return std::forward_as_tuple(Name(), nullptr);
   }
 
-  shared_ptr<MtInfo> mi = me->getStrategyInfo<MtInfo>();
+  MtInfo* mi = me->getStrategyInfo<MtInfo>();
   BOOST_ASSERT(mi != nullptr);
   // XXX after runtime strategy change, it's possible that me exists but mi doesn't exist;
   // this case needs another longest prefix match until mi is found
   return std::forward_as_tuple(me->getName(), mi);
 }
 
-shared_ptr<VehicularPriorityStrategy::MtInfo>
+VehicularPriorityStrategy::MtInfo*
 VehicularPriorityStrategy::addPrefixMeasurements(const Data& data)
 {
   shared_ptr<measurements::Entry> me;
@@ -367,6 +412,7 @@ void
 VehicularPriorityStrategy::removeFaceInfo(shared_ptr<Face> face)
 {
   m_fit.erase(face->getId());
+  m_interestScheduler.removeFace(face->getId());
 }
 
 } // namespace fw
@@ -29,6 +29,7 @@
 #include "strategy.hpp"
 #include "rtt-estimator.hpp"
 #include "retx-suppression-fixed.hpp"
+#include "interest-scheduler.hpp"
 #include <unordered_set>
 #include <unordered_map>
 
@@ -72,6 +73,10 @@ public: // triggers
   afterReceiveNack(const Face& inFace, const lp::Nack& nack,
                    shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
 
+public: // parameters
+  virtual InterestScheduler*
+  getInterestScheduler() DECL_OVERRIDE;
+
 private: // StrategyInfo
   /** \brief StrategyInfo on PIT entry
    */
@@ -84,8 +89,18 @@ private: // StrategyInfo
       return 1010;
     }
 
+    PitInfo();
+
   public:
     scheduler::ScopedEventId rtoTimer;
+
+    /** \brief the last working nexthop whose RTO timer starts when the Interest leaves
+     *         the scheduler queue, or INVALID_FACEID
+     */
+    FaceId rtoFace;
+    RttEstimator::Duration rto;
+    weak_ptr<fib::Entry> rtoFibEntry;
+    FaceId rtoInFace;
   };
 
   /** \brief StrategyInfo in measurements table
@@ -108,13 +123,13 @@ private: // StrategyInfo
 
   /** \brief find per-prefix measurements for Interest
    */
-  std::tuple<Name, shared_ptr<MtInfo>>
+  std::tuple<Name, MtInfo*>
   findPrefixMeasurements(const pit::Entry& pitEntry);
 
   /** \brief get or create pre-prefix measurements for incoming Data
    *  \note This function creates MtInfo but doesn't update it.
    */
-  shared_ptr<MtInfo>
+  MtInfo*
   addPrefixMeasurements(const Data& data);
 
   /** \brief global per-face StrategyInfo
@@ -169,6 +184,20 @@ private: // forwarding procedures
   updateMeasurements(const Face& inFace, const Data& data,
                      const RttEstimator::Duration& rtt);
 
+  /** \brief send Interest through the Interest scheduler of outFace
+   *
+   *  The smoothed RTT of outFace is the expected RTT, which decides whether the Interest
+   *  can still be satisfied before its deadline.
+   */
+  void
+  scheduleInterest(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace);
+
+  /** \brief send an Interest dequeued by the Interest scheduler,
+   *         and start the RTO timer if it goes to the last working nexthop
+   */
+  void
+  sendScheduledInterest(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace);
+
   // TODO mio Mie aggiunte
 
   void
@@ -184,6 +213,7 @@ public:
 private:
   FaceInfoTable m_fit;
   RetxSuppressionFixed m_retxSuppression;
+  InterestScheduler m_interestScheduler;
   signal::ScopedConnection m_removeFaceInfoConn;
   std::map<shared_ptr<pit::Entry>, signal::Connection> m_sentInterests;
 };
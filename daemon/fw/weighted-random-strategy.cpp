@@ -26,7 +26,6 @@
 #include "weighted-random-strategy.hpp"
 #include "core/logger.hpp"
 #include "strategies-tracepoint.hpp"
-#include "core/global-io.hpp"
 #include "core/global-network-monitor.hpp"
 #include <thread> //TODO test only
 
@@ -38,7 +37,6 @@ NFD_LOG_INIT("WeightedRandomStrategy");
 
 WeightedRandomStrategy::WeightedRandomStrategy(Forwarder& forwarder, const Name& name)
   : Strategy(forwarder, name)
-  , m_scheduler(getGlobalIoService())
   , m_name(name)
   , m_interfaceInterests()
   , m_errorState(false)
@@ -47,6 +45,10 @@ WeightedRandomStrategy::WeightedRandomStrategy(Forwarder& forwarder, const Name&
   std::random_device rd;
   m_randomGen.seed(rd());
 
+  m_removeFaceWeightConn = this->beforeRemoveFace.connect([this] (shared_ptr<Face> face) {
+    m_interfaceWeights.removeFace(face->getId());
+  });
+
   getGlobalNetworkMonitor().onInterfaceAdded.connect(bind(&WeightedRandomStrategy::handleInterfaceAdded, this, _1));
   getGlobalNetworkMonitor().onInterfaceRemoved.connect(bind(&WeightedRandomStrategy::handleInterfaceRemoved, this, _1));
 
@@ -71,6 +73,12 @@ WeightedRandomStrategy::~WeightedRandomStrategy()
 {
 }
 
+InterfaceWeights*
+WeightedRandomStrategy::getInterfaceWeights()
+{
+  return &m_interfaceWeights;
+}
+
 /** \brief determines whether a NextHop is eligible
  *  \param pitEntry PIT entry
  *  \param nexthop next hop
@@ -84,17 +92,17 @@ predicate_NextHop_eligible(const shared_ptr<pit::Entry>& pitEntry,
                            bool checkState = false,
                            time::steady_clock::TimePoint now = time::steady_clock::TimePoint::min())
 {
-  shared_ptr<Face> upstream = nexthop.getFace();
+  Face& upstream = nexthop.getFace();
 
   // upstream is current downstream
-  if (upstream->getId() == currentDownstream)
+  if (upstream.getId() == currentDownstream)
     return false;
 
   // forwarding would violate scope
-  if (pitEntry->violatesScope(*upstream))
+  if (pitEntry->violatesScope(upstream))
     return false;
 
-  if (checkState && upstream->getState() == nfd::face::TransportState::DOWN)
+  if (checkState && upstream.getState() == nfd::face::TransportState::DOWN)
     return false;
 
   return true;
@@ -108,14 +116,8 @@ WeightedRandomStrategy::deletePendingInterest(const shared_ptr<pit::Entry>& pitE
                       [&](shared_ptr<PendingInterest>& pi) {
                           if(pi->pitEntry == pitEntry) {
                               NFD_LOG_DEBUG("Delete retrasmission");
-                              if (pi->retryEvent != nullptr) {
-                                 m_scheduler.cancelEvent(*(pi->retryEvent));
-                                 pi->retryEvent = nullptr;
-                              }
-                              if (pi->deleteEvent != nullptr) {
-                                m_scheduler.cancelEvent(*(pi->deleteEvent));
-                                pi->deleteEvent =nullptr;
-                              }
+                              pi->retryTimer.cancel();
+                              pi->deleteTimer.cancel();
                               return true;
                           }
                           else
@@ -132,8 +134,7 @@ WeightedRandomStrategy::updatePendingInterest(const shared_ptr<pit::Entry>& pitE
     for (shared_ptr<PendingInterest>& pi : el.second) {
       if (pi->pitEntry->getName() == pitEntry->getName()) {
         pi->pitEntry = pitEntry;
-        pi->deleteEvent = make_shared<ndn::util::scheduler::EventId>(m_scheduler.scheduleEvent(time::milliseconds(pitEntry->getInterest().getInterestLifetime().count() + 200),
-                                                                                               bind(&WeightedRandomStrategy::removePendingInterest, this, pi, pitEntry)));
+        pi->deleteTimer.schedule(pitEntry->getInterest().getInterestLifetime() + time::milliseconds(200));
         return pi;
       }
     }
@@ -157,17 +158,13 @@ WeightedRandomStrategy::insertPendingInterest(const Interest& interest,
 
   if (pi == nullptr) {
     auto interestList = m_interfaceInterests.insert({outFace->getInterfaceName(), pendingInterests()}).first;
-    pi = make_shared<PendingInterest>(PendingInterest(outFace->getInterfaceName(), outFace, fibEntry, pitEntry, nullptr));
+    pi = make_shared<PendingInterest>(*this, outFace->getInterfaceName(), outFace, fibEntry, pitEntry);
     interestList->second.push_back(pi);
-    pi->deleteEvent = make_shared<ndn::util::scheduler::EventId>(
-                        m_scheduler.scheduleEvent(time::milliseconds(interest.getInterestLifetime().count() + 100),
-                                                  bind(&WeightedRandomStrategy::removePendingInterest, this, pi, pitEntry)));
+    pi->deleteTimer.schedule(interest.getInterestLifetime() + time::milliseconds(100));
     isNew = true;
   }
   if (retryNow) {
-    pi->retryEvent = make_shared<ndn::util::scheduler::EventId>(
-                       m_scheduler.scheduleEvent(time::milliseconds(int(getSendTimeout())),
-                                                 bind(&WeightedRandomStrategy::retryInterest, this, pitEntry, outFace, time::steady_clock::now(), pi, false)));
+    scheduleRetry(*pi, outFace);
     pi->retriesTimes.push_back(time::steady_clock::now());
   }
 
@@ -183,15 +180,15 @@ WeightedRandomStrategy::afterReceiveInterest(const Face& inFace,
 
   float totalWeight = 0;
   const fib::NextHopList& nexthops = fibEntry->getNextHops();
-  std::map<int, shared_ptr<Face>> eligibleFaces;
+  std::map<int, Face*> eligibleFaces;
   for (const fib::NextHop& nextHop : nexthops) {
     if (predicate_NextHop_eligible(pitEntry, nextHop, inFace.getId(), true, time::steady_clock::now())) {
-      shared_ptr<Face> outFace = nextHop.getFace();
+      Face& outFace = nextHop.getFace();
       int prob = getFaceWeight(outFace);
       if (prob > 0) {
 
         totalWeight += prob;
-        eligibleFaces[totalWeight] = outFace;
+        eligibleFaces[totalWeight] = &outFace;
         //NFD_LOG_DEBUG("Eligible face: " << outFace->getId());
       }
     }
@@ -202,12 +199,12 @@ WeightedRandomStrategy::afterReceiveInterest(const Face& inFace,
     int randomValue = dis(m_randomGen);
 
     auto it = std::find_if(eligibleFaces.begin(), eligibleFaces.end(),
-                            [randomValue] (const std::pair<const int,shared_ptr<Face>>& hop) {
+                            [randomValue] (const std::pair<const int, Face*>& hop) {
                                              return randomValue <= hop.first;
                                            });
 
     if (it != eligibleFaces.end()) {
-      shared_ptr<Face> outFace = it->second;
+      shared_ptr<Face> outFace = it->second->shared_from_this();
       NFD_LOG_TRACE("Interest to face: " << outFace->getId());
       this->sendInterest(pitEntry, outFace);
 
@@ -291,14 +288,8 @@ WeightedRandomStrategy::beforeSatisfyInterest(shared_ptr<pit::Entry> pitEntry,
                                     retrieveTime = (time::duration_cast<time::milliseconds> (time::steady_clock::now() - pi->retriesTimes[0])).count();
                                     rtt = addRttMeasurement(pi);
                                 }
-                                if (pi->retryEvent != nullptr) {
-                                   m_scheduler.cancelEvent(*(pi->retryEvent));
-                                   pi->retryEvent = nullptr;
-                                }
-                                if (pi->deleteEvent != nullptr) {
-                                  m_scheduler.cancelEvent(*(pi->deleteEvent));
-                                  pi->deleteEvent =nullptr;
-                                }
+                                pi->retryTimer.cancel();
+                                pi->deleteTimer.cancel();
                                 return true;
                             }
                             else {
@@ -350,9 +341,8 @@ WeightedRandomStrategy::handleInterfaceStateChanged(shared_ptr<ndn::util::Networ
       m_runningInterface = ni;
 
       for (shared_ptr<PendingInterest>& pi : list->second) {
-        if (pi->retryEvent != nullptr) {
-          m_scheduler.cancelEvent(*(pi->retryEvent));
-          pi->retryEvent = nullptr;
+        if (pi->retryTimer.isPending()) {
+          pi->retryTimer.cancel();
           pi->invalid = true;
         }
       }
@@ -389,12 +379,8 @@ WeightedRandomStrategy::sendInvalidPendingInterest()
             pi->invalid = false;
           }
           //NFD_LOG_DEBUG("Resend interest " << pi->pitEntry->getName());
-//          if (pi->retryEvent != nullptr) {
-//            m_scheduler.cancelEvent(*(pi->retryEvent));
-//          }
-          if (pi->retryEvent == nullptr) {
+          if (!pi->retryTimer.isPending()) {
             retryInterest(pi->pitEntry, pi->outFace, time::steady_clock::now(), pi, true);
-            //pi->retryEvent = make_shared<ndn::util::scheduler::EventId>(m_scheduler.scheduleEvent(time::milliseconds(int(getSendTimeout())), bind(&WeightedRandomStrategy::retryInterest, this, pi->pitEntry, pi->outFace, time::steady_clock::now(), pi, true)));
           }
           //this->sendInterest(el.pitEntry, el.outFace, true);
           //el.lastSent = time::steady_clock::now();
@@ -414,16 +400,15 @@ WeightedRandomStrategy::retryInterest(shared_ptr<pit::Entry> pitEntry, shared_pt
       if (pi->pitEntry->hasValidLocalInRecord()) {
         NFD_LOG_TRACE("Resend single interest NOW" << pitEntry->getName());
         this->sendInterest(pitEntry, outFace, true);
-        pi->retryEvent = make_shared<ndn::util::scheduler::EventId>(m_scheduler.scheduleEvent(time::milliseconds(int(getSendTimeout())), bind(&WeightedRandomStrategy::retryInterest, this, pitEntry, outFace, time::steady_clock::now(), pi, false)));
+        scheduleRetry(*pi, outFace);
         pi->retriesTimes.push_back(time::steady_clock::now());
         tracepoint(strategyLog, interest_sent, pitEntry->getName().toUri().c_str(),
                    outFace->getId(), outFace->getInterfaceName().c_str(), getSendTimeout());
 
       }
   }
-  else if (pi->retryEvent != nullptr) {
-    pi->retryEvent = nullptr;
-
+  else {
+    // retryTimer has expired
     if (pi->pitEntry->hasValidLocalInRecord()) {
 //      for(auto& in : pitEntry->getInRecords()) {
 //        NFD_LOG_TRACE("Face in: " << in.getFace()->getId());
@@ -432,7 +417,7 @@ WeightedRandomStrategy::retryInterest(shared_ptr<pit::Entry> pitEntry, shared_pt
 
       NFD_LOG_TRACE("Resend single interest defer " << pitEntry->getName() << " " << pitEntry->m_unsatisfyTimer);
       this->sendInterest(pitEntry, outFace, true);
-      pi->retryEvent = make_shared<ndn::util::scheduler::EventId>(m_scheduler.scheduleEvent(time::milliseconds(int(getSendTimeout())), bind(&WeightedRandomStrategy::retryInterest, this, pitEntry, outFace, time::steady_clock::now(), pi, false)));
+      scheduleRetry(*pi, outFace);
       pi->retriesTimes.push_back(time::steady_clock::now());
       tracepoint(strategyLog, interest_sent, pitEntry->getName().toUri().c_str(),
                  outFace->getId(), outFace->getInterfaceName().c_str(), getSendTimeout());
@@ -440,6 +425,13 @@ WeightedRandomStrategy::retryInterest(shared_ptr<pit::Entry> pitEntry, shared_pt
   }
 }
 
+void
+WeightedRandomStrategy::scheduleRetry(PendingInterest& pi, shared_ptr<Face> outFace)
+{
+  pi.retryOutFace = outFace;
+  pi.retryTimer.schedule(time::milliseconds(int(getSendTimeout())));
+}
+
 void
 WeightedRandomStrategy::removePendingInterest(shared_ptr<PendingInterest>& pi, shared_ptr<pit::Entry> pitEntry)
 {
@@ -451,14 +443,8 @@ WeightedRandomStrategy::removePendingInterest(shared_ptr<PendingInterest>& pi, s
                       [&](shared_ptr<PendingInterest>& piTmp) {
                           if(piTmp == pi) {
                               NFD_LOG_DEBUG("Done:  " << pi->pitEntry->getName() );
-                              if (pi->retryEvent != nullptr) {
-                                 m_scheduler.cancelEvent(*(pi->retryEvent));
-                                 pi->retryEvent = nullptr;
-                              }
-                              if (pi->deleteEvent != nullptr) {
-                                m_scheduler.cancelEvent(*(pi->deleteEvent));
-                                pi->deleteEvent = nullptr;
-                              }
+                              pi->retryTimer.cancel();
+                              pi->deleteTimer.cancel();
                               return true;
                           }
                           else {
@@ -581,14 +567,9 @@ WeightedRandomStrategy::getSendTimeout()
 }
 
 int
-WeightedRandomStrategy::getFaceWeight(const shared_ptr<Face>& face) const
+WeightedRandomStrategy::getFaceWeight(const Face& face) const
 {
-  std::string nicName = face->getInterfaceName();
-  auto it = m_interfacesInfo.find(nicName);
-  if (it != m_interfacesInfo.end())
-    return it->second.weight;
-  else
-    return 0;
+  return m_interfaceWeights.getFaceWeight(face);
 }
 
 } // namespace fw
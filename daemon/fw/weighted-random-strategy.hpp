@@ -27,8 +27,8 @@
 #define NFD_DAEMON_FW_WEIGHTED_RANDOM_STRATEGY_HPP
 
 #include "strategy.hpp"
+#include "interface-weights.hpp"
 
-#include <ndn-cxx/util/scheduler.hpp>
 #include <ndn-cxx/util/network-interface.hpp>
 
 #include <daemon/face/transport.hpp>
@@ -57,19 +57,31 @@ public:
   //virtual void
   //beforeExpirePendingInterest(shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE;
 
+  virtual InterfaceWeights*
+  getInterfaceWeights() DECL_OVERRIDE;
+
 public:
 
-  class PendingInterest
+  class PendingInterest : public enable_shared_from_this<PendingInterest>, noncopyable
   {
   public:
-    PendingInterest(const std::string& interfaceName, shared_ptr<Face> outFace,
-                    shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry,
-                    shared_ptr<ndn::util::scheduler::EventId> retryEvent)
+    PendingInterest(WeightedRandomStrategy& strategy,
+                    const std::string& interfaceName, shared_ptr<Face> outFace,
+                    shared_ptr<fib::Entry> fibEntry, shared_ptr<pit::Entry> pitEntry)
       : interfaceName(interfaceName)
       , outFace(outFace)
       , fibEntry(fibEntry)
       , pitEntry(pitEntry)
-      , retryEvent(retryEvent)
+      , retryTimer(strategy.getRetxTimerWheel(),
+                   [&strategy, this] {
+                     strategy.retryInterest(this->pitEntry, retryOutFace, time::steady_clock::now(),
+                                            this->shared_from_this(), false);
+                   })
+      , deleteTimer(strategy.getRetxTimerWheel(),
+                    [&strategy, this] {
+                      shared_ptr<PendingInterest> self = this->shared_from_this();
+                      strategy.removePendingInterest(self, self->pitEntry);
+                    })
       , invalid(false)
       {
       }
@@ -80,28 +92,17 @@ public:
     shared_ptr<fib::Entry> fibEntry;
     shared_ptr<pit::Entry> pitEntry;
     std::vector<time::steady_clock::TimePoint> retriesTimes;
-    shared_ptr<ndn::util::scheduler::EventId> retryEvent;
-    shared_ptr<ndn::util::scheduler::EventId> deleteEvent;
+    shared_ptr<Face> retryOutFace; ///< face to retry on when retryTimer expires
+    RetxTimer retryTimer;
+    RetxTimer deleteTimer;
     bool invalid;
   };
 
 protected:
-  class InterfaceInfo
-  {
-  public:
-    InterfaceInfo(std::string name, int weight) :
-      name(name), weight(weight) {}
-
-  public:
-    std::string name;
-    int weight; // TODO uint
-  };
-
-  typedef std::unordered_map<std::string, InterfaceInfo> interfacesInfos;
   typedef std::vector<shared_ptr<PendingInterest>> pendingInterests;
 
   int
-  getFaceWeight(const shared_ptr<nfd::face::Face>& face) const;
+  getFaceWeight(const nfd::face::Face& face) const;
 
   void
   handleInterfaceStateChanged(shared_ptr<ndn::util::NetworkInterface>& ni,
@@ -123,6 +124,11 @@ protected:
   retryInterest(shared_ptr<pit::Entry> pitEntry, shared_ptr<Face> outFace,
                 time::steady_clock::TimePoint sentTime, shared_ptr<PendingInterest> pi, bool now = false);
 
+  /** \brief schedules a retransmission of \p pi on \p outFace after the send timeout
+   */
+  void
+  scheduleRetry(PendingInterest& pi, shared_ptr<Face> outFace);
+
   void
   removePendingInterest(shared_ptr<PendingInterest>& pi, shared_ptr<pit::Entry> pitEntry);
 
@@ -150,10 +156,9 @@ protected:
   getSendTimeout();
 
 protected:
-  ndn::util::Scheduler m_scheduler;
-
   const Name& m_name;
-  interfacesInfos m_interfacesInfo;
+  InterfaceWeights m_interfaceWeights;
+  signal::ScopedConnection m_removeFaceWeightConn;
 
   std::unordered_map<std::string/*interfaceName*/,pendingInterests> m_interfaceInterests;
   std::mt19937 m_randomGen;
@@ -161,7 +166,6 @@ protected:
   bool m_errorState;
   shared_ptr<ndn::util::NetworkInterface> m_runningInterface;
   shared_ptr<Face> lastFace;
-  shared_ptr<ndn::util::scheduler::EventId> retryEvent;
 
   // Rtt
   float m_rttMean;
@@ -24,22 +24,30 @@
  */
 
 #include "face-manager.hpp"
+#include "core/nfd-tlv.hpp"
 
+#include "face/datagram-transport.hpp"
 #include "face/generic-link-service.hpp"
 #include "face/tcp-factory.hpp"
+#include "face/tcp-transport.hpp"
 #include "face/udp-factory.hpp"
 #include "fw/face-table.hpp"
+#include "table/pit-quota.hpp"
 #include "core/global-network-monitor.hpp"
 #include "mgmt-tracepoint.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
 #include <ndn-cxx/management/nfd-channel-status.hpp>
 #include <ndn-cxx/management/nfd-face-status.hpp>
 #include <ndn-cxx/management/nfd-face-event-notification.hpp>
 #include <ndn-cxx/util/network-monitor.hpp>
 #include <ndn-cxx/util/network-interface.hpp>
 
+#include <limits>
+
 #ifdef HAVE_UNIX_SOCKETS
 #include "face/unix-stream-factory.hpp"
+#include "face/unix-stream-transport.hpp"
 #endif // HAVE_UNIX_SOCKETS
 
 #ifdef HAVE_LIBPCAP
@@ -60,6 +68,7 @@ FaceManager::FaceManager(FaceTable& faceTable,
                          CommandValidator& validator)
   : ManagerBase(dispatcher, validator, "faces")
   , m_faceTable(faceTable)
+  , m_pitQuota(nullptr)
 {
   registerCommandHandler<ndn::nfd::FaceCreateCommand>("create",
     bind(&FaceManager::createFace, this, _2, _3, _4, _5));
@@ -93,6 +102,12 @@ FaceManager::setConfigFile(ConfigFile& configFile)
   configFile.addSectionHandler("face_system", bind(&FaceManager::processConfig, this, _1, _2, _3));
 }
 
+void
+FaceManager::setPitQuota(const PitQuota& pitQuota)
+{
+  m_pitQuota = &pitQuota;
+}
+
 void
 FaceManager::createFace(const Name& topPrefix, const Interest& interest,
                         const ControlParameters& parameters,
@@ -290,8 +305,7 @@ FaceManager::listFaces(const Name& topPrefix, const Interest& interest,
 {
   auto now = time::steady_clock::now();
   for (const auto& face : m_faceTable) {
-    ndn::nfd::FaceStatus status = collectFaceStatus(*face, now);
-    context.append(status.wireEncode());
+    context.append(encodeFaceStatus(*face, now));
   }
   context.end();
 }
@@ -338,8 +352,7 @@ FaceManager::queryFaces(const Name& topPrefix, const Interest& interest,
     if (!doesMatchFilter(faceFilter, face)) {
       continue;
     }
-    ndn::nfd::FaceStatus status = collectFaceStatus(*face, now);
-    context.append(status.wireEncode());
+    context.append(encodeFaceStatus(*face, now));
   }
 
   context.end();
@@ -413,6 +426,72 @@ FaceManager::collectFaceStatus(const Face& face, const time::steady_clock::TimeP
   return status;
 }
 
+/** \return send queue counters of a stream face, or nullptr if \p face is not a stream face
+ *  \note Transport::Counters is not polymorphic, so the transport itself is downcast
+ */
+static const face::StreamTransportCounters*
+getStreamTransportCounters(const Face& face)
+{
+  const face::Transport* transport = face.getTransport();
+
+  auto tcpTransport = dynamic_cast<const face::TcpTransport*>(transport);
+  if (tcpTransport != nullptr) {
+    return &tcpTransport->getCounters();
+  }
+
+#ifdef HAVE_UNIX_SOCKETS
+  auto unixStreamTransport = dynamic_cast<const face::UnixStreamTransport*>(transport);
+  if (unixStreamTransport != nullptr) {
+    return &unixStreamTransport->getCounters();
+  }
+#endif // HAVE_UNIX_SOCKETS
+
+  return nullptr;
+}
+
+Block
+FaceManager::encodeFaceStatus(const Face& face, const time::steady_clock::TimePoint& now)
+{
+  Block wire = collectFaceStatus(face, now).wireEncode();
+  wire.parse();
+
+  if (m_pitQuota != nullptr) {
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NPitEntries,
+                                                    m_pitQuota->getNFaceEntries(face.getId())));
+    const PitQuota::Counters* pitQuotaCounters = m_pitQuota->getFaceCounters(face.getId());
+    if (pitQuotaCounters != nullptr) {
+      wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NPitCapacityRejects,
+                                                      pitQuotaCounters->nCapacityRejects));
+      wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NPitFaceRejects,
+                                                      pitQuotaCounters->nFaceRejects));
+      wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NPitPrefixRejects,
+                                                      pitQuotaCounters->nPrefixRejects));
+    }
+  }
+
+  auto makeRateBlock = [] (uint32_t type, double rate) {
+    const double maxRate = static_cast<double>(std::numeric_limits<uint64_t>::max());
+    return ndn::makeNonNegativeIntegerBlock(type, rate >= maxRate ?
+                                                  std::numeric_limits<uint64_t>::max() :
+                                                  static_cast<uint64_t>(rate));
+  };
+  const face::FaceStats::Rates& rates = m_faceStats.getRates(face);
+  wire.push_back(makeRateBlock(tlv::InPacketRate, rates.nInPackets));
+  wire.push_back(makeRateBlock(tlv::OutPacketRate, rates.nOutPackets));
+  wire.push_back(makeRateBlock(tlv::InByteRate, rates.nInBytes));
+  wire.push_back(makeRateBlock(tlv::OutByteRate, rates.nOutBytes));
+
+  const face::StreamTransportCounters* streamCounters = getStreamTransportCounters(face);
+  if (streamCounters != nullptr) {
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::SendQueueBytes,
+                                                    streamCounters->nSendQueueBytes));
+    wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NSendQueueDrops,
+                                                    streamCounters->nSendQueueDrops));
+  }
+  wire.encode();
+  return wire;
+}
+
 template<typename FaceTraits>
 void
 FaceManager::collectFaceProperties(const Face& face, FaceTraits& traits)
@@ -432,6 +511,7 @@ FaceManager::afterFaceAdded(shared_ptr<Face> face,
   ndn::nfd::FaceEventNotification notification;
   notification.setKind(ndn::nfd::FACE_EVENT_CREATED);
   collectFaceProperties(*face, notification);
+  m_faceStats.addFace(*face);
 
   post(notification.wireEncode());
 }
@@ -443,6 +523,7 @@ FaceManager::afterFaceRemoved(shared_ptr<Face> face,
   ndn::nfd::FaceEventNotification notification;
   notification.setKind(ndn::nfd::FACE_EVENT_DESTROYED);
   collectFaceProperties(*face, notification);
+  m_faceStats.removeFace(face->getId());
 
   post(notification.wireEncode());
 }
@@ -517,6 +598,7 @@ FaceManager::processSectionUnix(const ConfigSection& configSection, bool isDryRu
   // unix
   // {
   //   path /var/run/nfd.sock ; Unix stream listener path
+  //   send_queue_limit 0 ; maximum octets queued for sending on each face, 0 means unlimited
   // }
 
 #if defined(HAVE_UNIX_SOCKETS)
@@ -524,6 +606,9 @@ FaceManager::processSectionUnix(const ConfigSection& configSection, bool isDryRu
     if (i.first == "path") {
       m_unixConfig.path = i.second.get_value<std::string>();
     }
+    else if (i.first == "send_queue_limit") {
+      m_unixConfig.sendQueueLimit = ConfigFile::parseNumber<size_t>(i, "unix");
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option \"" +
                                               i.first + "\" in \"unix\" section"));
@@ -536,6 +621,7 @@ FaceManager::processSectionUnix(const ConfigSection& configSection, bool isDryRu
     }
 
     auto factory = make_shared<UnixStreamFactory>();
+    factory->setSendQueueLimit(m_unixConfig.sendQueueLimit);
     m_factories.insert(std::make_pair("unix", factory));
 
     auto channel = factory->createChannel(m_unixConfig.path);
@@ -564,6 +650,9 @@ FaceManager::processSectionTcp(const ConfigSection& configSection, bool isDryRun
     else if (i.first == "enable_v6") {
       m_tcpConfig.enableV6 = ConfigFile::parseYesNo(i, "tcp");
     }
+    else if (i.first == "send_queue_limit") {
+      m_tcpConfig.sendQueueLimit = ConfigFile::parseNumber<size_t>(i, "tcp");
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option \"" +
                                               i.first + "\" in \"tcp\" section"));
@@ -582,6 +671,7 @@ FaceManager::processSectionTcp(const ConfigSection& configSection, bool isDryRun
     }
 
     auto factory = make_shared<TcpFactory>();
+    factory->setSendQueueLimit(m_tcpConfig.sendQueueLimit);
     m_factories.insert(std::make_pair("tcp", factory));
 
     if (m_tcpConfig.enableV4) {
@@ -641,6 +731,19 @@ FaceManager::processSectionUdp(const ConfigSection& configSection, bool isDryRun
                                                 i.first + "\" in \"udp\" section"));
       }
     }
+    else if (i.first == "batch_size") {
+      m_udpConfig.batchSize = ConfigFile::parseNumber<size_t>(i, "udp");
+      if (m_udpConfig.batchSize < 1 || m_udpConfig.batchSize > face::MAX_DATAGRAM_BATCH_SIZE) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"" +
+                                                i.first + "\" in \"udp\" section"));
+      }
+#ifndef __linux__
+      if (m_udpConfig.batchSize > 1) {
+        NFD_LOG_WARN("Batched UDP receive and send is only supported on Linux, "
+                     "ignoring option \"batch_size\" in \"udp\" section");
+      }
+#endif
+    }
     else if (i.first == "mcast") {
       m_udpConfig.useMcast = ConfigFile::parseYesNo(i, "udp");
     }
@@ -964,6 +1067,7 @@ FaceManager::handleInterfaceAdded(const shared_ptr<ndn::util::NetworkInterface>&
     factoryUdp = make_shared<UdpFactory>();
     m_factories.insert(std::make_pair("udp", factoryUdp));
   }
+  factoryUdp->setBatchSize(m_udpConfig.batchSize);
 
   // create the interface face
   if (m_udpConfig.ifaceInterfaces.size() > 0) {
@@ -1057,6 +1161,7 @@ void FaceManager::handleInterfaceAddressAdded(const shared_ptr<ndn::util::Networ
     factoryUdp = make_shared<UdpFactory>();
     m_factories.insert(std::make_pair("udp", factoryUdp));
   }
+  factoryUdp->setBatchSize(m_udpConfig.batchSize);
 
 
   if (address.is_v4() && m_udpConfig.enableV4) {
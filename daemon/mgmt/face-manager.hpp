@@ -30,6 +30,7 @@
 #include <ndn-cxx/management/nfd-face-status.hpp>
 #include <ndn-cxx/management/nfd-face-query-filter.hpp>
 #include "face/face.hpp"
+#include "face/face-stats.hpp"
 
 #include <ndn-cxx/util/network-monitor.hpp> //TODO mio forward decl?
 #include <ndn-cxx/util/network-interface.hpp> //TODO mio forward decl?
@@ -42,6 +43,7 @@
 namespace nfd {
 
 class FaceTable;
+class PitQuota;
 class NetworkInterfaceInfo;
 class ProtocolFactory;
 
@@ -49,9 +51,11 @@ class ProtocolFactory;
 // unix
 // {
 //   path /var/run/nfd.sock ; Unix stream listener path
+//   send_queue_limit 0 ; maximum octets queued for sending on each face, 0 means unlimited
 // }
 struct UnixConfig {
   std::string path = "/var/run/nfd.sock";
+  size_t sendQueueLimit = 0;
 };
 
 // ; the tcp section contains settings of TCP faces and channels
@@ -59,12 +63,14 @@ struct UnixConfig {
 // {
 //   listen yes ; set to 'no' to disable TCP listener, default 'yes'
 //   port 6363 ; TCP listener port number
+//   send_queue_limit 0 ; maximum octets queued for sending on each face, 0 means unlimited
 // }
 struct TcpConfig {
   uint16_t port = 6363;
   bool needToListen = true;
   bool enableV4 = true;
   bool enableV6 = true;
+  size_t sendQueueLimit = 0;
 };
 
 // ; the udp section contains settings of UDP faces and channels
@@ -73,6 +79,7 @@ struct TcpConfig {
 //   port 6363 ; UDP unicast port number
 //   idle_timeout 600 ; idle time (seconds) before closing a UDP unicast face
 //   keep_alive_interval 25 ; interval (seconds) between keep-alive refreshes
+//   batch_size 1 ; maximum number of datagrams received or sent in one system call
 
 //   ; NFD creates one UDP multicast face per NIC
 //   mcast yes ; set to 'no' to disable UDP multicast, default 'yes'
@@ -85,6 +92,7 @@ struct UdpConfig {
   bool enableV6 = true;
   size_t timeout = 600;
   size_t keepAliveInterval = 25;
+  size_t batchSize = 1;
   bool useMcast = true;
   boost::asio::ip::address_v4 mcastGroup = boost::asio::ip::address_v4::from_string("224.0.23.170");
   uint16_t mcastPort = 56363;
@@ -142,6 +150,11 @@ public:
   void
   setConfigFile(ConfigFile& configFile);
 
+  /** \brief enables PIT quota counters in face dataset
+   */
+  void
+  setPitQuota(const PitQuota& pitQuota);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // ControlCommand
   void
   createFace(const Name& topPrefix, const Interest& interest,
@@ -200,6 +213,11 @@ private: // helpers for StatusDataset handler
   static ndn::nfd::FaceStatus
   collectFaceStatus(const Face& face, const time::steady_clock::TimePoint& now);
 
+  /** \brief encode status of face, followed by NFD-specific fields (see core/nfd-tlv.hpp)
+   */
+  Block
+  encodeFaceStatus(const Face& face, const time::steady_clock::TimePoint& now);
+
   /** \brief copy face properties into traits
    *  \tparam FaceTraits either FaceStatus or FaceEventNotification
    */
@@ -261,6 +279,8 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   FaceTable& m_faceTable;
+  const PitQuota* m_pitQuota;
+  face::FaceStats m_faceStats;
   signal::ScopedConnection m_faceAddConn;
   signal::ScopedConnection m_faceRemoveConn;
 
@@ -42,6 +42,8 @@ FibManager::FibManager(Fib& fib,
     bind(&FibManager::addNextHop, this, _2, _3, _4, _5));
   registerCommandHandler<ndn::nfd::FibRemoveNextHopCommand>("remove-nexthop",
     bind(&FibManager::removeNextHop, this, _2, _3, _4, _5));
+  registerRawCommandHandler<FibBatchUpdate>("batch-update",
+    bind(&FibManager::batchUpdate, this, _1, _2, _3, _4));
 
   registerStatusDatasetHandler("list", bind(&FibManager::listEntries, this, _1, _2, _3));
 }
@@ -113,6 +115,59 @@ FibManager::removeNextHop(const Name& topPrefix, const Interest& interest,
   done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
 }
 
+void
+FibManager::batchUpdate(const Name& topPrefix, const Interest& interest,
+                        const ndn::mgmt::ControlParameters& parameters,
+                        const ndn::mgmt::CommandContinuation& done)
+{
+  BOOST_ASSERT(dynamic_cast<const FibBatchUpdate*>(&parameters) != nullptr);
+  const FibBatchUpdate& batch = static_cast<const FibBatchUpdate&>(parameters);
+
+  NFD_LOG_TRACE("batch-update nEntries: " << batch.size());
+
+  // resolve all faces first, so that a rejected batch leaves the FIB untouched
+  std::vector<shared_ptr<Face>> faces;
+  faces.reserve(batch.size());
+  for (const FibBatchUpdate::Entry& entry : batch.getEntries()) {
+    FaceId faceId = entry.faceId;
+    if (faceId == 0) { // self-registration, see setFaceForSelfRegistration
+      shared_ptr<lp::IncomingFaceIdTag> incomingFaceIdTag = interest.getTag<lp::IncomingFaceIdTag>();
+      BOOST_ASSERT(incomingFaceIdTag != nullptr);
+      faceId = *incomingFaceIdTag;
+    }
+
+    auto face = m_getFace(faceId);
+    if (face == nullptr && entry.action == FibBatchUpdate::ADD_NEXTHOP) {
+      NFD_LOG_INFO("batch-update result: FAIL reason: unknown-faceid: " << faceId);
+      return done(ControlResponse(410, "Face not found")
+                  .setBody(ControlParameters().setFaceId(faceId).wireEncode()));
+    }
+    faces.push_back(face);
+  }
+
+  auto face = faces.begin();
+  for (const FibBatchUpdate::Entry& entry : batch.getEntries()) {
+    NFD_LOG_TRACE("batch-update " << entry);
+
+    if (entry.action == FibBatchUpdate::ADD_NEXTHOP) {
+      m_fib.insert(entry.name).first->addNextHop(*face, entry.cost);
+    }
+    else if (*face != nullptr) {
+      auto fibEntry = m_fib.findExactMatch(entry.name);
+      if (fibEntry != nullptr) {
+        fibEntry->removeNextHop(*face);
+        if (!fibEntry->hasNextHops()) {
+          m_fib.erase(*fibEntry);
+        }
+      }
+    }
+    ++face;
+  }
+
+  NFD_LOG_DEBUG("batch-update result: OK nEntries: " << batch.size());
+  done(ControlResponse(200, "Success").setBody(batch.wireEncode()));
+}
+
 void
 FibManager::listEntries(const Name& topPrefix, const Interest& interest,
                         ndn::mgmt::StatusDatasetContext& context)
@@ -124,7 +179,7 @@ FibManager::listEntries(const Name& topPrefix, const Interest& interest,
 
     for (auto&& next : nextHops) {
       ndn::nfd::NextHopRecord nextHopRecord;
-      nextHopRecord.setFaceId(next.getFace()->getId());
+      nextHopRecord.setFaceId(next.getFace().getId());
       nextHopRecord.setCost(next.getCost());
 
       record.addNextHopRecord(nextHopRecord);
@@ -28,6 +28,7 @@
 
 #include "manager-base.hpp"
 #include "core/logger.hpp"
+#include "core/fib-batch-update.hpp"
 #include "table/fib.hpp"
 #include "fw/forwarder.hpp"
 
@@ -64,6 +65,19 @@ private:
                 ControlParameters parameters,
                 const ndn::mgmt::CommandContinuation& done);
 
+  /**
+   * @brief apply a FibBatchUpdate atomically
+   *
+   * Every FaceId is resolved before the FIB is touched. If an add-nexthop refers to
+   * a nonexistent face, the whole batch is rejected with 410 and the response body carries
+   * ControlParameters with the offending FaceId; otherwise all changes are applied.
+   * As in remove-nexthop, removing a nexthop of a nonexistent face is not an error.
+   */
+  void
+  batchUpdate(const Name& topPrefix, const Interest& interest,
+              const ndn::mgmt::ControlParameters& parameters,
+              const ndn::mgmt::CommandContinuation& done);
+
   void
   listEntries(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
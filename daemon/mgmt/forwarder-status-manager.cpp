@@ -24,9 +24,14 @@
  */
 
 #include "forwarder-status-manager.hpp"
+#include "core/nfd-tlv.hpp"
 #include "fw/forwarder.hpp"
+#include "fw/interest-scheduler.hpp"
+#include "fw/strategy.hpp"
 #include "version.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
 namespace nfd {
 
 const time::milliseconds STATUS_SERVER_DEFAULT_FRESHNESS = time::milliseconds(5000);
@@ -90,6 +95,29 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   for (const auto& subblock : status.wireEncode().elements()) {
     context.append(subblock);
   }
+
+  const PitQuota::Counters& pitQuotaCounters = m_forwarder.getPit().getQuota().getCounters();
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NPitCapacityRejects,
+                                                  pitQuotaCounters.nCapacityRejects));
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NPitFaceRejects,
+                                                  pitQuotaCounters.nFaceRejects));
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NPitPrefixRejects,
+                                                  pitQuotaCounters.nPrefixRejects));
+
+  uint64_t nSchedulerSent = 0;
+  uint64_t nDeadlineMisses = 0;
+  uint64_t nSchedulerQueued = 0;
+  for (fw::Strategy* strategy : m_forwarder.getStrategyChoice().getInstalledStrategies()) {
+    const fw::InterestScheduler* scheduler = strategy->getInterestScheduler();
+    if (scheduler != nullptr) {
+      nSchedulerSent += scheduler->getCounters().nSent;
+      nDeadlineMisses += scheduler->getCounters().nDeadlineMissed;
+      nSchedulerQueued += scheduler->getQueueLength();
+    }
+  }
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NSchedulerSent, nSchedulerSent));
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NDeadlineMisses, nDeadlineMisses));
+  context.append(ndn::makeNonNegativeIntegerBlock(tlv::NSchedulerQueued, nSchedulerQueued));
   context.end();
 }
 
@@ -62,7 +62,6 @@ ManagerBase::authorize(const Name& prefix, const Interest& interest,
                        ndn::mgmt::RejectContinuation reject)
 {
   BOOST_ASSERT(params != nullptr);
-  BOOST_ASSERT(typeid(*params) == typeid(ndn::nfd::ControlParameters));
 
   m_validator.validate(interest,
                        bind(&ManagerBase::extractRequester, this, interest, accept),
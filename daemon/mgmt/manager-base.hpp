@@ -77,6 +77,17 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED: // registrations to the dispatcher
   registerCommandHandler(const std::string& verb,
                          const ControlCommandHandler& handler);
 
+  /**
+   * @brief register a command whose parameters are not nfd::ControlParameters
+   *
+   * @tparam Parameters a subclass of ndn::mgmt::ControlParameters constructible from Block;
+   *                    a request is dropped if its parameters cannot be decoded
+   */
+  template<typename Parameters>
+  void
+  registerRawCommandHandler(const std::string& verb,
+                            const ndn::mgmt::ControlCommandHandler& handler);
+
   void
   registerStatusDatasetHandler(const std::string& verb,
                                const ndn::mgmt::StatusDatasetHandler& handler);
@@ -91,7 +102,6 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // command validation
    * This is called by the dispatcher.
    *
    * @pre params != null
-   * @pre typeid(*params) == typeid(ndn::nfd::ControlParameters)
    *
    * @param prefix the top prefix
    * @param interest a request for ControlCommand
@@ -175,6 +185,20 @@ ManagerBase::registerCommandHandler(const std::string& verb,
     bind(&ManagerBase::handleCommand, command, handler, _1, _2, _3, _4));
 }
 
+template<typename Parameters>
+inline void
+ManagerBase::registerRawCommandHandler(const std::string& verb,
+                                       const ndn::mgmt::ControlCommandHandler& handler)
+{
+  m_dispatcher.addControlCommand<Parameters>(
+    makeRelPrefix(verb),
+    bind(&ManagerBase::authorize, this, _1, _2, _3, _4, _5),
+    [] (const ndn::mgmt::ControlParameters& parameters) {
+      return dynamic_cast<const Parameters*>(&parameters) != nullptr;
+    },
+    handler);
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_MGMT_MANAGER_BASE_HPP
@@ -24,13 +24,27 @@
  */
 
 #include "strategy-choice-manager.hpp"
+#include "core/nfd-tlv.hpp"
 #include "table/strategy-choice.hpp"
+#include "fw/strategy.hpp"
+#include "fw/interface-weights.hpp"
 #include <ndn-cxx/management/nfd-strategy-choice.hpp>
 
 namespace nfd {
 
 NFD_LOG_INIT("StrategyChoiceManager");
 
+StrategyChoiceSetWeightsCommand::StrategyChoiceSetWeightsCommand()
+  : ControlCommand("strategy-choice", "set-weights")
+{
+  m_requestValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME)
+    .required(ndn::nfd::CONTROL_PARAMETER_URI);
+  m_responseValidator
+    .required(ndn::nfd::CONTROL_PARAMETER_NAME)
+    .required(ndn::nfd::CONTROL_PARAMETER_URI);
+}
+
 StrategyChoiceManager::StrategyChoiceManager(StrategyChoice& strategyChoice,
                                              Dispatcher& dispatcher,
                                              CommandValidator& validator)
@@ -41,9 +55,13 @@ StrategyChoiceManager::StrategyChoiceManager(StrategyChoice& strategyChoice,
     bind(&StrategyChoiceManager::setStrategy, this, _2, _3, _4, _5));
   registerCommandHandler<ndn::nfd::StrategyChoiceUnsetCommand>("unset",
     bind(&StrategyChoiceManager::unsetStrategy, this, _2, _3, _4, _5));
+  registerCommandHandler<StrategyChoiceSetWeightsCommand>("set-weights",
+    bind(&StrategyChoiceManager::setInterfaceWeights, this, _2, _3, _4, _5));
 
   registerStatusDatasetHandler("list",
     bind(&StrategyChoiceManager::listChoices, this, _1, _2, _3));
+  registerStatusDatasetHandler("congestion",
+    bind(&StrategyChoiceManager::listCongestionStatus, this, _1, _2, _3));
 }
 
 void
@@ -84,6 +102,41 @@ StrategyChoiceManager::unsetStrategy(const Name& topPrefix, const Interest& inte
   done(ControlResponse(200, "OK").setBody(parameters.wireEncode()));
 }
 
+void
+StrategyChoiceManager::setInterfaceWeights(const Name& topPrefix, const Interest& interest,
+                                           ControlParameters parameters,
+                                           const ndn::mgmt::CommandContinuation& done)
+{
+  fw::Strategy* strategy = m_strategyChoice.getStrategy(parameters.getName());
+  if (strategy == nullptr) {
+    NFD_LOG_DEBUG("set-weights result: FAIL reason: unknown-strategy: " << parameters.getName());
+    return done(ControlResponse(504, "Unsupported strategy"));
+  }
+
+  fw::InterfaceWeights* interfaceWeights = strategy->getInterfaceWeights();
+  if (interfaceWeights == nullptr) {
+    NFD_LOG_DEBUG("set-weights result: FAIL reason: no-interface-weights: " << strategy->getName());
+    return done(ControlResponse(405, "Strategy does not use interface weights"));
+  }
+
+  fw::InterfaceWeights::WeightMap weights;
+  try {
+    weights = fw::InterfaceWeights::parse(parameters.getUri());
+  }
+  catch (const fw::InterfaceWeights::Error& e) {
+    NFD_LOG_DEBUG("set-weights result: FAIL reason: " << e.what());
+    return done(ControlResponse(400, "Malformed interface weights"));
+  }
+
+  for (const auto& interfaceAndWeight : weights) {
+    interfaceWeights->set(interfaceAndWeight.first, interfaceAndWeight.second);
+  }
+
+  NFD_LOG_DEBUG("set-weights result: SUCCESS");
+  parameters.setName(strategy->getName());
+  return done(ControlResponse(200, "OK").setBody(parameters.wireEncode()));
+}
+
 void
 StrategyChoiceManager::listChoices(const Name& topPrefix, const Interest& interest,
                                    ndn::mgmt::StatusDatasetContext& context)
@@ -96,4 +149,31 @@ StrategyChoiceManager::listChoices(const Name& topPrefix, const Interest& intere
   context.end();
 }
 
+void
+StrategyChoiceManager::listCongestionStatus(const Name& topPrefix, const Interest& interest,
+                                            ndn::mgmt::StatusDatasetContext& context)
+{
+  // a strategy chosen for several namespaces is listed once
+  std::set<const fw::Strategy*> strategies;
+  for (auto&& i : m_strategyChoice) {
+    const fw::Strategy& strategy = i.getStrategy();
+    if (!strategies.insert(&strategy).second) {
+      continue;
+    }
+
+    for (const fw::Strategy::CongestionStatus& status : strategy.getCongestionStatus()) {
+      Block entry(tlv::CongestionStatus);
+      entry.push_back(strategy.getName().wireEncode());
+      entry.push_back(ndn::makeNonNegativeIntegerBlock(ndn::tlv::nfd::FaceId, status.faceId));
+      entry.push_back(ndn::makeNonNegativeIntegerBlock(tlv::CongestionWindow,
+                                                       static_cast<uint64_t>(status.window)));
+      entry.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NInFlightInterests, status.nInFlight));
+      entry.push_back(ndn::makeNonNegativeIntegerBlock(tlv::NQueuedInterests, status.nQueued));
+      entry.encode();
+      context.append(entry);
+    }
+  }
+  context.end();
+}
+
 } // namespace
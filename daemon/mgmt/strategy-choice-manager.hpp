@@ -32,9 +32,25 @@ namespace nfd {
 
 class StrategyChoice;
 
+/**
+ * @brief strategy-choice/set-weights command
+ *
+ * Name is the strategy name. Uri contains the interface weights to update,
+ * in the format "eth0=2,wlan0=1". Weights of other interfaces are unchanged.
+ */
+class StrategyChoiceSetWeightsCommand : public ControlCommand
+{
+public:
+  StrategyChoiceSetWeightsCommand();
+};
+
 /**
  * @brief implement the Strategy Choice Management of NFD Management Protocol.
  * @sa http://redmine.named-data.net/projects/nfd/wiki/StrategyChoice
+ *
+ * In addition, strategy-choice/congestion dataset lists the congestion control state of
+ * upstream faces in every strategy that is chosen for a namespace, as CongestionStatus
+ * blocks defined in core/nfd-tlv.hpp.
  */
 class StrategyChoiceManager : public ManagerBase
 {
@@ -54,10 +70,19 @@ private:
                 ControlParameters parameters,
                 const ndn::mgmt::CommandContinuation& done);
 
+  void
+  setInterfaceWeights(const Name& topPrefix, const Interest& interest,
+                      ControlParameters parameters,
+                      const ndn::mgmt::CommandContinuation& done);
+
   void
   listChoices(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
 
+  void
+  listCongestionStatus(const Name& topPrefix, const Interest& interest,
+                       ndn::mgmt::StatusDatasetContext& context);
+
 private:
   StrategyChoice& m_strategyChoice;
 };
@@ -28,6 +28,9 @@
 #include "common.hpp"
 #include "core/logger.hpp"
 #include "core/config-file.hpp"
+#include "fw/strategy.hpp"
+#include "fw/interface-weights.hpp"
+#include "fw/interest-scheduler.hpp"
 
 namespace nfd {
 
@@ -42,7 +45,7 @@ TablesConfigSection::TablesConfigSection(Cs& cs,
                                          Measurements& measurements,
                                          NetworkRegionTable& networkRegionTable)
   : m_cs(cs)
-  // , m_pit(pit)
+  , m_pit(pit)
   // , m_fib(fib)
   , m_strategyChoice(strategyChoice)
   // , m_measurements(measurements)
@@ -82,6 +85,14 @@ TablesConfigSection::processConfig(const ConfigSection& configSection,
   // {
   //    cs_max_packets 65536
   //
+  //    pit_max_entries 1000000
+  //    pit_max_entries_per_face 100000
+  //
+  //    pit_prefix_quota
+  //    {
+  //        /example/app  10000
+  //    }
+  //
   //    strategy_choice
   //    {
   //        /               /localhost/nfd/strategy/best-route
@@ -95,6 +106,29 @@ TablesConfigSection::processConfig(const ConfigSection& configSection,
   //       /example/region1
   //       /example/region2
   //    }
+  //
+  //    interface_weights
+  //    {
+  //       /localhost/nfd/strategy/preferred-wlan
+  //       {
+  //          eth0   2
+  //          wlan0  1
+  //       }
+  //    }
+  //
+  //    interest_scheduling
+  //    {
+  //       /localhost/nfd/strategy/vehicular-priority
+  //       {
+  //          rate   500
+  //          burst  10
+  //          priority
+  //          {
+  //             /vehicle/control  0
+  //             /vehicle/video    2
+  //          }
+  //       }
+  //    }
   // }
 
   size_t nCsMaxPackets = DEFAULT_CS_MAX_PACKETS;
@@ -114,6 +148,36 @@ TablesConfigSection::processConfig(const ConfigSection& configSection,
     nCsMaxPackets = *valCsMaxPackets;
   }
 
+  size_t nPitMaxEntries = PitQuota::UNLIMITED;
+  if (configSection.get_child_optional("pit_max_entries")) {
+    boost::optional<size_t> value = configSection.get_optional<size_t>("pit_max_entries");
+    if (!value) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"pit_max_entries\""
+                                              " in \"tables\" section"));
+    }
+    nPitMaxEntries = *value;
+  }
+
+  size_t nPitMaxEntriesPerFace = PitQuota::UNLIMITED;
+  if (configSection.get_child_optional("pit_max_entries_per_face")) {
+    boost::optional<size_t> value = configSection.get_optional<size_t>("pit_max_entries_per_face");
+    if (!value) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"pit_max_entries_per_face\""
+                                              " in \"tables\" section"));
+    }
+    nPitMaxEntriesPerFace = *value;
+  }
+
+  boost::optional<const ConfigSection&> pitPrefixQuotaSection =
+    configSection.get_child_optional("pit_prefix_quota");
+
+  if (pitPrefixQuotaSection) {
+    processPitQuotaSection(*pitPrefixQuotaSection, isDryRun);
+  }
+  else if (!isDryRun) {
+    m_pit.getQuota().clearPrefixQuotas();
+  }
+
   boost::optional<const ConfigSection&> strategyChoiceSection =
     configSection.get_child_optional("strategy_choice");
 
@@ -128,10 +192,36 @@ TablesConfigSection::processConfig(const ConfigSection& configSection,
     processNetworkRegionSection(*networkRegionSection, isDryRun);
   }
 
+  boost::optional<const ConfigSection&> interfaceWeightsSection =
+    configSection.get_child_optional("interface_weights");
+
+  if (interfaceWeightsSection) {
+    processInterfaceWeightsSection(*interfaceWeightsSection, isDryRun);
+  }
+  else if (!isDryRun) {
+    resetInterfaceWeights();
+  }
+
+  boost::optional<const ConfigSection&> interestSchedulingSection =
+    configSection.get_child_optional("interest_scheduling");
+
+  if (interestSchedulingSection) {
+    processInterestSchedulingSection(*interestSchedulingSection, isDryRun);
+  }
+  else if (!isDryRun) {
+    resetInterestSchedulers();
+  }
+
   if (!isDryRun) {
     NFD_LOG_INFO("Setting CS max packets to " << nCsMaxPackets);
 
     m_cs.setLimit(nCsMaxPackets);
+
+    NFD_LOG_INFO("Setting PIT max entries to " << nPitMaxEntries <<
+                 ", per face " << nPitMaxEntriesPerFace);
+    m_pit.getQuota().setCapacity(nPitMaxEntries);
+    m_pit.getQuota().setFaceQuota(nPitMaxEntriesPerFace);
+
     m_areTablesConfigured = true;
   }
 }
@@ -210,5 +300,212 @@ TablesConfigSection::processNetworkRegionSection(const ConfigSection& configSect
   }
 }
 
+void
+TablesConfigSection::processInterfaceWeightsSection(const ConfigSection& configSection,
+                                                    bool isDryRun)
+{
+  // interface_weights
+  // {
+  //    /localhost/nfd/strategy/preferred-wlan
+  //    {
+  //       eth0   2
+  //       wlan0  1
+  //    }
+  // }
+
+  std::map<fw::InterfaceWeights*, fw::InterfaceWeights::WeightMap> allWeights;
+
+  for (const auto& strategyAndWeights : configSection) {
+    const Name strategyName(strategyAndWeights.first);
+    fw::Strategy* strategy = m_strategyChoice.getStrategy(strategyName);
+    if (strategy == nullptr) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Unknown strategy \"" + strategyName.toUri() +
+                                              "\" in \"interface_weights\" section"));
+    }
+
+    fw::InterfaceWeights* interfaceWeights = strategy->getInterfaceWeights();
+    if (interfaceWeights == nullptr) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Strategy \"" + strategyName.toUri() + "\" "
+                                              "does not use interface weights"));
+    }
+    if (allWeights.find(interfaceWeights) != allWeights.end()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Duplicate strategy \"" + strategyName.toUri() +
+                                              "\" in \"interface_weights\" section"));
+    }
+
+    fw::InterfaceWeights::WeightMap& weights = allWeights[interfaceWeights];
+    for (const auto& interfaceAndWeight : strategyAndWeights.second) {
+      boost::optional<int> weight = interfaceAndWeight.second.get_value_optional<int>();
+      if (!weight) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid weight for interface \"" +
+                                                interfaceAndWeight.first + "\" of strategy \"" +
+                                                strategyName.toUri() + "\""));
+      }
+      weights[interfaceAndWeight.first] = *weight;
+    }
+  }
+
+  if (!isDryRun) {
+    // strategies no longer listed, and weights changed by management, return to built-in weights
+    resetInterfaceWeights();
+    for (const auto& interfaceWeights : allWeights) {
+      interfaceWeights.first->assign(interfaceWeights.second);
+    }
+  }
+}
+
+void
+TablesConfigSection::resetInterfaceWeights()
+{
+  for (fw::Strategy* strategy : m_strategyChoice.getInstalledStrategies()) {
+    fw::InterfaceWeights* interfaceWeights = strategy->getInterfaceWeights();
+    if (interfaceWeights != nullptr) {
+      interfaceWeights->reset();
+    }
+  }
+}
+
+void
+TablesConfigSection::processInterestSchedulingSection(const ConfigSection& configSection,
+                                                      bool isDryRun)
+{
+  // interest_scheduling
+  // {
+  //    /localhost/nfd/strategy/vehicular-priority
+  //    {
+  //       rate   500
+  //       burst  10
+  //       priority
+  //       {
+  //          /vehicle/control  0
+  //       }
+  //    }
+  // }
+
+  struct SchedulerConfig
+  {
+    double rate = 0;
+    size_t burst = 1;
+    std::map<Name, int> priorityClasses;
+  };
+  std::map<fw::InterestScheduler*, SchedulerConfig> allConfigs;
+
+  for (const auto& strategyAndConfig : configSection) {
+    const Name strategyName(strategyAndConfig.first);
+    fw::Strategy* strategy = m_strategyChoice.getStrategy(strategyName);
+    if (strategy == nullptr) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Unknown strategy \"" + strategyName.toUri() +
+                                              "\" in \"interest_scheduling\" section"));
+    }
+
+    fw::InterestScheduler* scheduler = strategy->getInterestScheduler();
+    if (scheduler == nullptr) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Strategy \"" + strategyName.toUri() + "\" "
+                                              "does not use an Interest scheduler"));
+    }
+    if (allConfigs.find(scheduler) != allConfigs.end()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Duplicate strategy \"" + strategyName.toUri() +
+                                              "\" in \"interest_scheduling\" section"));
+    }
+
+    SchedulerConfig& config = allConfigs[scheduler];
+    for (const auto& option : strategyAndConfig.second) {
+      if (option.first == "rate") {
+        boost::optional<double> rate = option.second.get_value_optional<double>();
+        if (!rate || *rate < 0) {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"rate\" of strategy \"" +
+                                                  strategyName.toUri() + "\""));
+        }
+        config.rate = *rate;
+      }
+      else if (option.first == "burst") {
+        boost::optional<size_t> burst = option.second.get_value_optional<size_t>();
+        if (!burst || *burst == 0) {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"burst\" of strategy \"" +
+                                                  strategyName.toUri() + "\""));
+        }
+        config.burst = *burst;
+      }
+      else if (option.first == "priority") {
+        for (const auto& prefixAndClass : option.second) {
+          boost::optional<int> priorityClass = prefixAndClass.second.get_value_optional<int>();
+          if (!priorityClass) {
+            BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid priority class for prefix \"" +
+                                                    prefixAndClass.first + "\" of strategy \"" +
+                                                    strategyName.toUri() + "\""));
+          }
+          config.priorityClasses[Name(prefixAndClass.first)] = *priorityClass;
+        }
+      }
+      else {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option \"" + option.first +
+                                                "\" of strategy \"" + strategyName.toUri() +
+                                                "\" in \"interest_scheduling\" section"));
+      }
+    }
+  }
+
+  if (!isDryRun) {
+    // schedulers of strategies no longer listed return to no rate limit and no priority classes
+    resetInterestSchedulers();
+    for (const auto& schedulerAndConfig : allConfigs) {
+      fw::InterestScheduler* scheduler = schedulerAndConfig.first;
+      const SchedulerConfig& config = schedulerAndConfig.second;
+      scheduler->setRate(config.rate, config.burst);
+      for (const auto& prefixAndClass : config.priorityClasses) {
+        scheduler->setPriorityClass(prefixAndClass.first, prefixAndClass.second);
+      }
+    }
+  }
+}
+
+void
+TablesConfigSection::resetInterestSchedulers()
+{
+  for (fw::Strategy* strategy : m_strategyChoice.getInstalledStrategies()) {
+    fw::InterestScheduler* scheduler = strategy->getInterestScheduler();
+    if (scheduler != nullptr) {
+      scheduler->setRate(0);
+      scheduler->clearPriorityClasses();
+    }
+  }
+}
+
+void
+TablesConfigSection::processPitQuotaSection(const ConfigSection& configSection,
+                                            bool isDryRun)
+{
+  // pit_prefix_quota
+  // {
+  //    /example/app  10000
+  // }
+
+  std::map<Name, size_t> quotas;
+
+  for (const auto& prefixAndQuota : configSection) {
+    const Name prefix(prefixAndQuota.first);
+    if (quotas.find(prefix) != quotas.end()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Duplicate PIT quota for prefix \"" +
+                                              prefix.toUri() + "\" in \"pit_prefix_quota\" "
+                                              "section"));
+    }
+
+    boost::optional<size_t> value = prefixAndQuota.second.get_value_optional<size_t>();
+    if (!value) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid PIT quota for prefix \"" +
+                                              prefix.toUri() + "\" in \"pit_prefix_quota\" "
+                                              "section"));
+    }
+
+    quotas[prefix] = *value;
+  }
+
+  if (!isDryRun) {
+    m_pit.getQuota().clearPrefixQuotas();
+    for (const auto& prefixAndQuota : quotas) {
+      m_pit.getQuota().setPrefixQuota(prefixAndQuota.first, prefixAndQuota.second);
+    }
+  }
+}
 
 } // namespace nfd
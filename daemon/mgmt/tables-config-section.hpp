@@ -41,7 +41,7 @@ namespace nfd {
  * \brief Provides parsing for `tables` configuration file section.
  *
  * This class enables configuration of CS, PIT, FIB, Strategy Choice, Measurements, and
- * Network Region tables.
+ * Network Region tables, and of interface weights and Interest schedulers used by strategies.
  */
 class TablesConfigSection
 {
@@ -74,9 +74,31 @@ private:
   processNetworkRegionSection(const ConfigSection& configSection,
                               bool isDryRun);
 
+  void
+  processInterfaceWeightsSection(const ConfigSection& configSection,
+                                 bool isDryRun);
+
+  /** \brief restore built-in interface weights of all strategies
+   */
+  void
+  resetInterfaceWeights();
+
+  void
+  processInterestSchedulingSection(const ConfigSection& configSection,
+                                   bool isDryRun);
+
+  /** \brief remove rate limits and priority classes from Interest schedulers of all strategies
+   */
+  void
+  resetInterestSchedulers();
+
+  void
+  processPitQuotaSection(const ConfigSection& configSection,
+                         bool isDryRun);
+
 private:
   Cs& m_cs;
-  // Pit& m_pit;
+  Pit& m_pit;
   // Fib& m_fib;
   StrategyChoice& m_strategyChoice;
   // Measurements& m_measurements;
@@ -152,6 +152,7 @@ Nfd::initializeManagement()
   m_faceManager.reset(new FaceManager(m_forwarder->getFaceTable(),
                                       *m_dispatcher,
                                       *m_validator));
+  m_faceManager->setPitQuota(m_forwarder->getPit().getQuota());
 
   m_strategyChoiceManager.reset(new StrategyChoiceManager(m_forwarder->getStrategyChoice(),
                                                           *m_dispatcher,
@@ -103,6 +103,13 @@ Cs::insert(const Data& data, bool isUnsolicited)
   std::tie(it, isNewEntry) = m_table.insert(EntryImpl(data.shared_from_this(), isUnsolicited));
   EntryImpl& entry = const_cast<EntryImpl&>(*it);
 
+  const Block& wire = data.wireEncode();
+  if (isNewEntry && wire.size() != wire.getBuffer()->size()) {
+    // Data is part of a larger packet buffer (e.g. an LpPacket or a receive slab),
+    // copy it out so that the cached Data does not keep the whole buffer alive
+    entry.setData(make_shared<Data>(Block(wire.wire(), wire.size())), isUnsolicited);
+  }
+
   entry.updateStaleTime();
 
   if (!isNewEntry) { // existing entry
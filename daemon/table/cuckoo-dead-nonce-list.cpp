@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cuckoo-dead-nonce-list.hpp"
+#include "core/city-hash.hpp"
+#include "core/logger.hpp"
+
+NFD_LOG_INIT("CuckooDeadNonceList");
+
+namespace nfd {
+
+const time::nanoseconds CuckooDeadNonceList::DEFAULT_LIFETIME = time::seconds(6);
+const time::nanoseconds CuckooDeadNonceList::MIN_LIFETIME = time::milliseconds(1);
+const size_t CuckooDeadNonceList::N_SLICES = 5;
+const size_t CuckooDeadNonceList::MIN_SLICE_CAPACITY = (1 << 5);
+const size_t CuckooDeadNonceList::MAX_SLICE_CAPACITY = (1 << 24) / N_SLICES;
+
+CuckooDeadNonceList::CuckooDeadNonceList(const time::nanoseconds& lifetime)
+  : m_lifetime(lifetime)
+  , m_rotateInterval(m_lifetime / N_SLICES)
+  , m_slices(N_SLICES + 1)
+  , m_current(0)
+{
+  if (m_lifetime < MIN_LIFETIME) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
+  }
+
+  for (size_t i = 0; i < m_slices.size(); ++i) {
+    this->resetSlice(i, 0);
+  }
+
+  m_rotateEvent = scheduler::schedule(m_rotateInterval, bind(&CuckooDeadNonceList::rotate, this));
+}
+
+CuckooDeadNonceList::~CuckooDeadNonceList()
+{
+  scheduler::cancel(m_rotateEvent);
+}
+
+size_t
+CuckooDeadNonceList::size() const
+{
+  size_t n = 0;
+  for (const Slice& slice : m_slices) {
+    for (const auto& filter : slice) {
+      n += filter->size();
+    }
+  }
+  return n;
+}
+
+bool
+CuckooDeadNonceList::has(const Name& name, uint32_t nonce) const
+{
+  Entry entry = CuckooDeadNonceList::makeEntry(name, nonce);
+  for (const Slice& slice : m_slices) {
+    for (const auto& filter : slice) {
+      if (filter->contains(entry)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void
+CuckooDeadNonceList::add(const Name& name, uint32_t nonce)
+{
+  Entry entry = CuckooDeadNonceList::makeEntry(name, nonce);
+
+  Slice& slice = m_slices[m_current];
+  if (slice.back()->insert(entry)) {
+    return;
+  }
+
+  size_t sliceCapacity = 0;
+  for (const auto& filter : slice) {
+    sliceCapacity += filter->getCapacity();
+  }
+
+  if (sliceCapacity >= MAX_SLICE_CAPACITY) {
+    NFD_LOG_DEBUG("add slice full, rotating early");
+    scheduler::cancel(m_rotateEvent);
+    this->rotate();
+    bool isInserted = m_slices[m_current].back()->insert(entry);
+    BOOST_ASSERT(isInserted);
+    static_cast<void>(isInserted);
+    return;
+  }
+
+  size_t newCapacity = std::min(slice.back()->getCapacity() * 2, MAX_SLICE_CAPACITY);
+  NFD_LOG_TRACE("add grow slice=" << m_current << " capacity=" << newCapacity);
+  slice.push_back(make_unique<CuckooFilter>(newCapacity));
+  bool isInserted = slice.back()->insert(entry);
+  BOOST_ASSERT(isInserted);
+  static_cast<void>(isInserted);
+}
+
+CuckooDeadNonceList::Entry
+CuckooDeadNonceList::makeEntry(const Name& name, uint32_t nonce)
+{
+  Block nameWire = name.wireEncode();
+  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+                            static_cast<uint64_t>(nonce));
+}
+
+void
+CuckooDeadNonceList::rotate()
+{
+  size_t lastSize = 0;
+  for (const auto& filter : m_slices[m_current]) {
+    lastSize += filter->size();
+  }
+
+  m_current = (m_current + 1) % m_slices.size();
+  this->resetSlice(m_current, lastSize);
+
+  NFD_LOG_TRACE("rotate current=" << m_current << " lastSize=" << lastSize);
+
+  m_rotateEvent = scheduler::schedule(m_rotateInterval, bind(&CuckooDeadNonceList::rotate, this));
+}
+
+void
+CuckooDeadNonceList::resetSlice(size_t sliceIndex, size_t expectedSize)
+{
+  // leave 25% headroom for rate increase before the slice has to grow
+  size_t capacity = std::max(MIN_SLICE_CAPACITY,
+                             std::min(MAX_SLICE_CAPACITY, expectedSize + expectedSize / 4));
+
+  Slice& slice = m_slices[sliceIndex];
+  if (slice.size() == 1 && slice.front()->getCapacity() >= capacity &&
+      slice.front()->getCapacity() <= capacity * 4) {
+    // reuse the existing table to avoid allocation in steady state
+    slice.front()->clear();
+    return;
+  }
+
+  slice.clear();
+  slice.push_back(make_unique<CuckooFilter>(capacity));
+}
+
+} // namespace nfd
@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
+#define NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
+
+#include "common.hpp"
+#include "cuckoo-filter.hpp"
+#include "core/scheduler.hpp"
+
+namespace nfd {
+
+/** \brief represents the Dead Nonce List, backed by a ring of time-bucketed cuckoo filters
+ *
+ *  This is an alternative to DeadNonceList with the same interface.
+ *  Name+Nonce is hashed to 64 bits in the same way, but instead of being kept in
+ *  a multi-index container, the hash is recorded in a CuckooFilter that costs 4 bytes
+ *  per slot, and neither has nor add allocates memory in steady state.
+ *
+ *  Lifetime is split into N_SLICES slices. The ring holds N_SLICES+1 slices;
+ *  add records into the current slice, and every lifetime/N_SLICES the oldest slice is
+ *  cleared and becomes current. Therefore, an entry is kept for at least lifetime and
+ *  at most lifetime*(1+1/N_SLICES).
+ *
+ *  Each slice normally consists of one filter, sized according to the number of Nonces
+ *  recorded in the previous slice. If the current filter fills up, another filter of
+ *  twice the capacity is appended to the slice. If the slice reaches MAX_SLICE_CAPACITY,
+ *  the ring is rotated early, evicting the oldest slice.
+ *
+ *  False positives: has probes every filter in the ring. A filter reports a false positive
+ *  with probability at most (2 * CuckooFilter::SLOTS_PER_BUCKET + 1) / 2^32 = 9/2^32,
+ *  so with k filters (normally k = N_SLICES+1 = 6) the bound is k*9/2^32, about 1.3e-8.
+ *  As with DeadNonceList, a false positive is recoverable when the consumer retransmits
+ *  with a different Nonce.
+ */
+class CuckooDeadNonceList : noncopyable
+{
+public:
+  /** \brief constructs the Dead Nonce List
+   *  \param lifetime duration of the expected lifetime of each nonce,
+   *         must be no less than MIN_LIFETIME.
+   *  \throw std::invalid_argument if lifetime is less than MIN_LIFETIME
+   */
+  explicit
+  CuckooDeadNonceList(const time::nanoseconds& lifetime = DEFAULT_LIFETIME);
+
+  ~CuckooDeadNonceList();
+
+  /** \brief determines if name+nonce exists
+   *  \return true if name+nonce exists
+   */
+  bool
+  has(const Name& name, uint32_t nonce) const;
+
+  /** \brief records name+nonce
+   */
+  void
+  add(const Name& name, uint32_t nonce);
+
+  /** \return number of stored Nonces
+   */
+  size_t
+  size() const;
+
+  /** \return expected lifetime
+   */
+  const time::nanoseconds&
+  getLifetime() const;
+
+private:
+  typedef CuckooFilter::Hash Entry;
+
+  static Entry
+  makeEntry(const Name& name, uint32_t nonce);
+
+  /** \brief clears the oldest slice and makes it current, then schedules next rotation
+   */
+  void
+  rotate();
+
+  /** \brief empties a slice, resizing its filter for the expected number of Nonces
+   *  \param expectedSize number of Nonces recorded in the previous slice
+   */
+  void
+  resetSlice(size_t sliceIndex, size_t expectedSize);
+
+public:
+  /// default entry lifetime
+  static const time::nanoseconds DEFAULT_LIFETIME;
+
+  /// minimum entry lifetime
+  static const time::nanoseconds MIN_LIFETIME;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief number of slices covering lifetime
+   */
+  static const size_t N_SLICES;
+
+  /** \brief initial and minimum capacity of a slice
+   */
+  static const size_t MIN_SLICE_CAPACITY;
+
+  /** \brief maximum capacity of a slice
+   *
+   *  This is to limit memory usage.
+   */
+  static const size_t MAX_SLICE_CAPACITY;
+
+  typedef std::vector<unique_ptr<CuckooFilter>> Slice;
+
+  time::nanoseconds m_lifetime;
+  time::nanoseconds m_rotateInterval;
+  std::vector<Slice> m_slices;
+  size_t m_current;
+  scheduler::EventId m_rotateEvent;
+};
+
+inline const time::nanoseconds&
+CuckooDeadNonceList::getLifetime() const
+{
+  return m_lifetime;
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CUCKOO_DEAD_NONCE_LIST_HPP
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cuckoo-filter.hpp"
+#include "core/random.hpp"
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+namespace nfd {
+
+const size_t CuckooFilter::SLOTS_PER_BUCKET = 4;
+const size_t CuckooFilter::MAX_KICKS = 500;
+
+CuckooFilter::CuckooFilter(size_t capacity)
+  : m_size(0)
+  , m_hasVictim(false)
+  , m_victimIndex(0)
+  , m_victimFp(0)
+{
+  size_t nBuckets = 1;
+  while (nBuckets * SLOTS_PER_BUCKET < capacity) {
+    nBuckets <<= 1;
+  }
+  m_bucketMask = nBuckets - 1;
+  m_slots.resize(nBuckets * SLOTS_PER_BUCKET, 0);
+}
+
+CuckooFilter::Fingerprint
+CuckooFilter::makeFingerprint(Hash hash)
+{
+  Fingerprint fp = static_cast<Fingerprint>(hash >> 32);
+  // 0 marks an empty slot
+  return fp == 0 ? 1 : fp;
+}
+
+size_t
+CuckooFilter::getAltIndex(size_t index, Fingerprint fp) const
+{
+  // MurmurHash2 multiplier; XOR keeps the mapping an involution
+  return (index ^ (static_cast<size_t>(fp) * 0x5bd1e995)) & m_bucketMask;
+}
+
+bool
+CuckooFilter::hasInBucket(size_t index, Fingerprint fp) const
+{
+  const Fingerprint* bucket = &m_slots[index * SLOTS_PER_BUCKET];
+  for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i) {
+    if (bucket[i] == fp) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool
+CuckooFilter::insertToBucket(size_t index, Fingerprint fp)
+{
+  Fingerprint* bucket = &m_slots[index * SLOTS_PER_BUCKET];
+  for (size_t i = 0; i < SLOTS_PER_BUCKET; ++i) {
+    if (bucket[i] == 0) {
+      bucket[i] = fp;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool
+CuckooFilter::insert(Hash hash)
+{
+  if (m_hasVictim) {
+    return false;
+  }
+
+  Fingerprint fp = makeFingerprint(hash);
+  size_t index = static_cast<size_t>(hash) & m_bucketMask;
+  if (this->insertToBucket(index, fp)) {
+    ++m_size;
+    return true;
+  }
+
+  index = this->getAltIndex(index, fp);
+  if (this->insertToBucket(index, fp)) {
+    ++m_size;
+    return true;
+  }
+
+  boost::random::uniform_int_distribution<size_t> dist(0, SLOTS_PER_BUCKET - 1);
+  for (size_t nKicks = 0; nKicks < MAX_KICKS; ++nKicks) {
+    std::swap(fp, m_slots[index * SLOTS_PER_BUCKET + dist(getGlobalRng())]);
+    index = this->getAltIndex(index, fp);
+    if (this->insertToBucket(index, fp)) {
+      ++m_size;
+      return true;
+    }
+  }
+
+  // the table is (nearly) full; keep the displaced fingerprint so that it is not lost
+  m_hasVictim = true;
+  m_victimIndex = index;
+  m_victimFp = fp;
+  ++m_size;
+  return true;
+}
+
+bool
+CuckooFilter::contains(Hash hash) const
+{
+  Fingerprint fp = makeFingerprint(hash);
+  size_t index1 = static_cast<size_t>(hash) & m_bucketMask;
+  size_t index2 = this->getAltIndex(index1, fp);
+
+  if (m_hasVictim && m_victimFp == fp &&
+      (m_victimIndex == index1 || m_victimIndex == index2)) {
+    return true;
+  }
+
+  return this->hasInBucket(index1, fp) || this->hasInBucket(index2, fp);
+}
+
+void
+CuckooFilter::clear()
+{
+  std::fill(m_slots.begin(), m_slots.end(), 0);
+  m_size = 0;
+  m_hasVictim = false;
+}
+
+} // namespace nfd
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CUCKOO_FILTER_HPP
+#define NFD_DAEMON_TABLE_CUCKOO_FILTER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief a fixed-capacity cuckoo filter over 64-bit hashes
+ *
+ *  The filter is a table of buckets with SLOTS_PER_BUCKET slots each.
+ *  Every slot stores a 32-bit fingerprint taken from the high half of the hash;
+ *  the low half selects the primary bucket, and the alternate bucket is derived from
+ *  the primary bucket and the fingerprint (partial-key cuckoo hashing).
+ *
+ *  A lookup probes two buckets, so its false positive rate is bounded by
+ *  (2 * SLOTS_PER_BUCKET + 1) / 2^32 (the extra term accounts for the victim slot).
+ *  There are no false negatives: an insertion that cannot find room after MAX_KICKS
+ *  relocations parks the last displaced fingerprint in a victim slot, after which
+ *  the filter reports itself as full and refuses further insertions.
+ *
+ *  All storage is allocated in the constructor; insert, contains and clear never allocate.
+ */
+class CuckooFilter : noncopyable
+{
+public:
+  typedef uint64_t Hash;
+
+  /** \brief constructs a filter able to hold at least \p capacity hashes
+   *
+   *  The number of buckets is rounded up to a power of two.
+   */
+  explicit
+  CuckooFilter(size_t capacity);
+
+  /** \brief inserts a hash
+   *  \retval true the hash has been recorded
+   *  \retval false the filter is full, the hash has not been recorded
+   */
+  bool
+  insert(Hash hash);
+
+  /** \brief determines whether a hash may have been inserted
+   *  \return false if the hash was definitely not inserted
+   */
+  bool
+  contains(Hash hash) const;
+
+  /** \brief erases all hashes, keeping the allocated table
+   */
+  void
+  clear();
+
+  /** \return number of inserted hashes
+   */
+  size_t
+  size() const;
+
+  /** \return number of slots in the table
+   */
+  size_t
+  getCapacity() const;
+
+public:
+  static const size_t SLOTS_PER_BUCKET;
+
+  /** \brief maximum number of relocations attempted by insert
+   */
+  static const size_t MAX_KICKS;
+
+private:
+  typedef uint32_t Fingerprint;
+
+  static Fingerprint
+  makeFingerprint(Hash hash);
+
+  size_t
+  getAltIndex(size_t index, Fingerprint fp) const;
+
+  bool
+  hasInBucket(size_t index, Fingerprint fp) const;
+
+  bool
+  insertToBucket(size_t index, Fingerprint fp);
+
+private:
+  /** \brief fingerprints, SLOTS_PER_BUCKET consecutive slots per bucket, 0 means empty
+   */
+  std::vector<Fingerprint> m_slots;
+  size_t m_bucketMask;
+  size_t m_size;
+
+  bool m_hasVictim;
+  size_t m_victimIndex;
+  Fingerprint m_victimFp;
+};
+
+inline size_t
+CuckooFilter::size() const
+{
+  return m_size;
+}
+
+inline size_t
+CuckooFilter::getCapacity() const
+{
+  return m_slots.size();
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CUCKOO_FILTER_HPP
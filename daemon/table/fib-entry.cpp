@@ -24,12 +24,57 @@
  */
 
 #include "fib-entry.hpp"
+#include "fib.hpp"
 
 namespace nfd {
 namespace fib {
 
+const size_t NextHopList::N_INLINE;
+
+void
+NextHopList::push_back(const NextHop& nexthop)
+{
+  if (m_size < N_INLINE) {
+    m_inline[m_size] = nexthop;
+  }
+  else {
+    if (m_size == N_INLINE) {
+      m_overflow.assign(m_inline.begin(), m_inline.end());
+    }
+    m_overflow.push_back(nexthop);
+  }
+  ++m_size;
+}
+
+void
+NextHopList::erase(iterator it)
+{
+  BOOST_ASSERT(it >= this->begin() && it < this->end());
+
+  if (m_size <= N_INLINE) {
+    std::copy(it + 1, this->end(), it);
+    --m_size;
+    return;
+  }
+
+  m_overflow.erase(m_overflow.begin() + (it - m_overflow.data()));
+  --m_size;
+  if (m_size == N_INLINE) {
+    std::copy(m_overflow.begin(), m_overflow.end(), m_inline.begin());
+    std::vector<NextHop>().swap(m_overflow);
+  }
+}
+
+void
+NextHopList::clear()
+{
+  std::vector<NextHop>().swap(m_overflow);
+  m_size = 0;
+}
+
 Entry::Entry(const Name& prefix)
   : m_prefix(prefix)
+  , m_fib(nullptr)
 {
 }
 
@@ -38,7 +83,7 @@ Entry::findNextHop(Face& face)
 {
   return std::find_if(m_nextHops.begin(), m_nextHops.end(),
                       [&face] (const NextHop& nexthop) {
-                        return nexthop.getFace().get() == &face;
+                        return nexthop.m_face == &face;
                       });
 }
 
@@ -56,6 +101,9 @@ Entry::addNextHop(shared_ptr<Face> face, uint64_t cost)
     m_nextHops.push_back(fib::NextHop(face));
     it = m_nextHops.end();
     --it;
+    if (m_fib != nullptr) {
+      m_fib->addToFaceIndex(*face, *this);
+    }
   }
   // now it refers to the NextHop for face
 
@@ -70,6 +118,9 @@ Entry::removeNextHop(shared_ptr<Face> face)
   auto it = this->findNextHop(*face);
   if (it != m_nextHops.end()) {
     m_nextHops.erase(it);
+    if (m_fib != nullptr) {
+      m_fib->removeFromFaceIndex(*face, *this);
+    }
   }
 }
 
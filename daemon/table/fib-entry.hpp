@@ -28,6 +28,8 @@
 
 #include "fib-nexthop.hpp"
 
+#include <array>
+
 namespace nfd {
 
 class NameTree;
@@ -40,12 +42,64 @@ namespace fib {
 /** \class NextHopList
  *  \brief represents a collection of nexthops
  *
+ *  Up to N_INLINE nexthops are stored inline; a longer list is moved into a vector.
+ *
  *  This type has these methods as public API:
  *    iterator<NextHop> begin()
  *    iterator<NextHop> end()
  *    size_t size()
  */
-typedef std::vector<fib::NextHop> NextHopList;
+class NextHopList
+{
+public:
+  typedef NextHop value_type;
+  typedef NextHop* iterator;
+  typedef const NextHop* const_iterator;
+
+  NextHopList();
+
+  iterator
+  begin();
+
+  iterator
+  end();
+
+  const_iterator
+  begin() const;
+
+  const_iterator
+  end() const;
+
+  size_t
+  size() const;
+
+  bool
+  empty() const;
+
+  void
+  push_back(const NextHop& nexthop);
+
+  void
+  erase(iterator it);
+
+  void
+  clear();
+
+private:
+  NextHop*
+  data();
+
+  const NextHop*
+  data() const;
+
+public:
+  static const size_t N_INLINE = 4;
+
+private:
+  std::array<NextHop, N_INLINE> m_inline; // used when m_size <= N_INLINE
+  std::vector<NextHop> m_overflow; // used when m_size > N_INLINE
+  size_t m_size;
+};
 
 /** \class Entry
  *  \brief represents a FIB entry
@@ -105,11 +159,69 @@ private:
   Name m_prefix;
   NextHopList m_nextHops;
 
+  /// the FIB that contains this entry, or nullptr if the entry is not in a FIB
+  Fib* m_fib;
+  friend class nfd::Fib;
+
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
 };
 
+inline
+NextHopList::NextHopList()
+  : m_size(0)
+{
+}
+
+inline NextHop*
+NextHopList::data()
+{
+  return m_size > N_INLINE ? m_overflow.data() : m_inline.data();
+}
+
+inline const NextHop*
+NextHopList::data() const
+{
+  return m_size > N_INLINE ? m_overflow.data() : m_inline.data();
+}
+
+inline NextHopList::iterator
+NextHopList::begin()
+{
+  return this->data();
+}
+
+inline NextHopList::iterator
+NextHopList::end()
+{
+  return this->data() + m_size;
+}
+
+inline NextHopList::const_iterator
+NextHopList::begin() const
+{
+  return this->data();
+}
+
+inline NextHopList::const_iterator
+NextHopList::end() const
+{
+  return this->data() + m_size;
+}
+
+inline size_t
+NextHopList::size() const
+{
+  return m_size;
+}
+
+inline bool
+NextHopList::empty() const
+{
+  return m_size == 0;
+}
+
 
 inline const Name&
 Entry::getPrefix() const
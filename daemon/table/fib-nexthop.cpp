@@ -28,28 +28,16 @@
 namespace nfd {
 namespace fib {
 
-NextHop::NextHop(shared_ptr<Face> face)
-  : m_face(face)
+NextHop::NextHop()
+  : m_face(nullptr)
   , m_cost(0)
 {
 }
 
-const shared_ptr<Face>&
-NextHop::getFace() const
-{
-  return m_face;
-}
-
-void
-NextHop::setCost(uint64_t cost)
-{
-  m_cost = cost;
-}
-
-uint64_t
-NextHop::getCost() const
+NextHop::NextHop(shared_ptr<Face> face)
+  : m_face(face.get())
+  , m_cost(0)
 {
-  return m_cost;
 }
 
 } // namespace fib
@@ -30,18 +30,32 @@
 #include "face/face.hpp"
 
 namespace nfd {
+
+class Fib;
+
 namespace fib {
 
+class Entry;
+
 /** \class NextHop
  *  \brief represents a nexthop record in FIB entry
+ *
+ *  NextHop does not own the face. A face's nexthops are removed by
+ *  Fib::removeNextHopFromAllEntries when the face is removed from FaceTable.
+ *  A caller that needs to keep the face should take ownership with Face::shared_from_this.
  */
 class NextHop
 {
 public:
+  /** \brief constructs an unused nexthop record
+   *  \note This is needed to store NextHop in an array.
+   */
+  NextHop();
+
   explicit
   NextHop(shared_ptr<Face> face);
 
-  const shared_ptr<Face>&
+  Face&
   getFace() const;
 
   void
@@ -51,10 +65,32 @@ public:
   getCost() const;
 
 private:
-  shared_ptr<Face> m_face;
+  Face* m_face;
   uint64_t m_cost;
+
+  friend class Entry;
+  friend class nfd::Fib;
 };
 
+inline Face&
+NextHop::getFace() const
+{
+  BOOST_ASSERT(m_face != nullptr);
+  return *m_face;
+}
+
+inline void
+NextHop::setCost(uint64_t cost)
+{
+  m_cost = cost;
+}
+
+inline uint64_t
+NextHop::getCost() const
+{
+  return m_cost;
+}
+
 } // namespace fib
 } // namespace nfd
 
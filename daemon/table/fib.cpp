@@ -49,10 +49,7 @@ BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Fib::const_iterator>));
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
-{
-}
-
-Fib::~Fib()
+  , m_version(0)
 {
 }
 
@@ -62,6 +59,17 @@ predicate_NameTreeEntry_hasFibEntry(const name_tree::Entry& entry)
   return static_cast<bool>(entry.getFibEntry());
 }
 
+Fib::~Fib()
+{
+  // entries may outlive FIB if they are referenced elsewhere
+  for (const name_tree::Entry& nte : m_nameTree.fullEnumerate(&predicate_NameTreeEntry_hasFibEntry)) {
+    shared_ptr<fib::Entry> entry = nte.getFibEntry();
+    if (entry->m_fib == this) {
+      entry->m_fib = nullptr;
+    }
+  }
+}
+
 shared_ptr<fib::Entry>
 Fib::findLongestPrefixMatch(const Name& prefix) const
 {
@@ -122,17 +130,30 @@ Fib::insert(const Name& prefix)
   if (static_cast<bool>(entry))
     return std::make_pair(entry, false);
   entry = make_shared<fib::Entry>(prefix);
+  entry->m_fib = this;
   nameTreeEntry->setFibEntry(entry);
   ++m_nItems;
+  ++m_version;
   return std::make_pair(entry, true);
 }
 
 void
 Fib::erase(shared_ptr<name_tree::Entry> nameTreeEntry)
 {
+  shared_ptr<fib::Entry> entry = nameTreeEntry->getFibEntry();
+  if (entry == nullptr) {
+    return;
+  }
+
+  for (const fib::NextHop& nexthop : entry->getNextHops()) {
+    this->removeFromFaceIndex(*nexthop.m_face, *entry);
+  }
+  entry->m_fib = nullptr;
+
   nameTreeEntry->setFibEntry(shared_ptr<fib::Entry>());
   m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
   --m_nItems;
+  ++m_version;
 }
 
 void
@@ -153,25 +174,47 @@ Fib::erase(const fib::Entry& entry)
   }
 }
 
+void
+Fib::addToFaceIndex(const Face& face, fib::Entry& entry)
+{
+  m_faceIndex[&face].insert(&entry);
+  ++m_version;
+}
+
+void
+Fib::removeFromFaceIndex(const Face& face, fib::Entry& entry)
+{
+  ++m_version;
+
+  auto it = m_faceIndex.find(&face);
+  if (it == m_faceIndex.end()) {
+    return;
+  }
+
+  it->second.erase(&entry);
+  if (it->second.empty()) {
+    m_faceIndex.erase(it);
+  }
+}
+
 void
 Fib::removeNextHopFromAllEntries(shared_ptr<Face> face)
 {
-  std::list<fib::Entry*> toErase;
+  auto it = m_faceIndex.find(face.get());
+  if (it == m_faceIndex.end()) {
+    return;
+  }
 
-  auto&& enumerable = m_nameTree.fullEnumerate(&predicate_NameTreeEntry_hasFibEntry);
-  for (const name_tree::Entry& nte : enumerable) {
-    shared_ptr<fib::Entry> entry = nte.getFibEntry();
+  // take the entries out of the index, so that removeNextHop doesn't modify the set being iterated
+  std::unordered_set<fib::Entry*> entries = std::move(it->second);
+  m_faceIndex.erase(it);
+
+  for (fib::Entry* entry : entries) {
     entry->removeNextHop(face);
     if (!entry->hasNextHops()) {
-      toErase.push_back(entry.get());
-      // entry needs to be erased, but we must wait until the enumeration ends,
-      // because otherwise NameTree iterator would be invalidated
+      this->erase(*entry);
     }
   }
-
-  for (fib::Entry* entry : toErase) {
-    this->erase(*entry);
-  }
 }
 
 Fib::const_iterator
@@ -52,6 +52,13 @@ public:
   size_t
   size() const;
 
+  /** \return a number that changes whenever a FIB entry is inserted or erased,
+   *          or a NextHop record is added or removed
+   *  \note NextHop cost changes do not change the version.
+   */
+  uint64_t
+  getVersion() const;
+
 public: // lookup
   /// performs a longest prefix match
   shared_ptr<fib::Entry>
@@ -86,6 +93,7 @@ public: // mutation
    *
    *  This is usually invoked when face goes away.
    *  Removing the last NextHop in a FIB entry will erase the FIB entry.
+   *  This takes time proportional to the number of FIB entries with a NextHop record for face.
    *
    *  \todo change parameter type to Face&
    */
@@ -149,9 +157,27 @@ private:
   void
   erase(shared_ptr<name_tree::Entry> nameTreeEntry);
 
+  /** \brief records that entry has a NextHop record for face
+   */
+  void
+  addToFaceIndex(const Face& face, fib::Entry& entry);
+
+  /** \brief records that entry no longer has a NextHop record for face
+   */
+  void
+  removeFromFaceIndex(const Face& face, fib::Entry& entry);
+
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  uint64_t m_version;
+
+  /** \brief reverse index from face to FIB entries that have a NextHop record for the face
+   *
+   *  This is keyed by Face rather than FaceId, because FaceTable::remove resets FaceId
+   *  before removing nexthops.
+   */
+  std::unordered_map<const Face*, std::unordered_set<fib::Entry*>> m_faceIndex;
 
   /** \brief The empty FIB entry.
    *
@@ -160,6 +186,8 @@ private:
    *  Returning empty entry instead of nullptr makes forwarding and strategy implementation easier.
    */
   static const shared_ptr<fib::Entry> s_emptyEntry;
+
+  friend class fib::Entry;
 };
 
 inline size_t
@@ -168,6 +196,12 @@ Fib::size() const
   return m_nItems;
 }
 
+inline uint64_t
+Fib::getVersion() const
+{
+  return m_version;
+}
+
 inline Fib::const_iterator
 Fib::end() const
 {
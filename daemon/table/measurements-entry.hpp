@@ -58,8 +58,12 @@ private:
   Name m_name;
 
 private: // lifetime
+  /** \brief the entry is kept until at least this time
+   *
+   *  Measurements files the entry into its timing wheel by this time, but does not re-file it
+   *  when the time is extended; the entry is re-filed when its old slot is reached.
+   */
   time::steady_clock::TimePoint m_expiry;
-  scheduler::EventId m_cleanup;
   shared_ptr<name_tree::Entry> m_nameTreeEntry;
 
   friend class nfd::NameTree;
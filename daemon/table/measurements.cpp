@@ -32,9 +32,15 @@ namespace nfd {
 
 using measurements::Entry;
 
+const size_t Measurements::N_TIMING_WHEEL_SLOTS = 64;
+
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_timingWheel(N_TIMING_WHEEL_SLOTS)
+  , m_timingWheelEpoch(time::steady_clock::now())
+  , m_lastTick(0)
+  , m_isTimingWheelRunning(false)
 {
 }
 
@@ -50,8 +56,7 @@ Measurements::get(name_tree::Entry& nte)
   ++m_nItems;
 
   entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(),
-                                         bind(&Measurements::cleanup, this, ref(*entry)));
+  this->fileEntry(entry);
 
   return entry;
 }
@@ -156,9 +161,8 @@ Measurements::extendLifetime(Entry& entry,
     return;
   }
 
-  scheduler::cancel(entry.m_cleanup);
+  // the timing wheel re-files the entry when its current slot is reached
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, bind(&Measurements::cleanup, this, ref(entry)));
 }
 
 void
@@ -172,4 +176,70 @@ Measurements::cleanup(Entry& entry)
   }
 }
 
+uint64_t
+Measurements::getTick(const time::steady_clock::TimePoint& t) const
+{
+  if (t <= m_timingWheelEpoch) {
+    return 0;
+  }
+  return static_cast<uint64_t>((t - m_timingWheelEpoch).count() / getTimingWheelTick().count());
+}
+
+void
+Measurements::fileEntry(const shared_ptr<Entry>& entry)
+{
+  if (!m_isTimingWheelRunning) {
+    time::steady_clock::TimePoint now = time::steady_clock::now();
+    m_lastTick = this->getTick(now);
+    m_isTimingWheelRunning = true;
+    this->scheduleNextTick(now);
+  }
+
+  // first tick at or after expiry
+  uint64_t tick = this->getTick(entry->m_expiry);
+  if (m_timingWheelEpoch + getTimingWheelTick() * static_cast<time::nanoseconds::rep>(tick) < entry->m_expiry) {
+    ++tick;
+  }
+  tick = std::max(tick, m_lastTick + 1);
+
+  m_timingWheel[tick % N_TIMING_WHEEL_SLOTS].push_back(entry);
+}
+
+void
+Measurements::processTimingWheel()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  uint64_t currentTick = this->getTick(now);
+
+  while (m_lastTick < currentTick) {
+    ++m_lastTick;
+    m_expiringSlot.swap(m_timingWheel[m_lastTick % N_TIMING_WHEEL_SLOTS]);
+
+    for (const shared_ptr<Entry>& entry : m_expiringSlot) {
+      if (entry->m_expiry <= now) {
+        this->cleanup(*entry);
+      }
+      else {
+        this->fileEntry(entry);
+      }
+    }
+    m_expiringSlot.clear();
+  }
+
+  if (m_nItems == 0) {
+    m_isTimingWheelRunning = false;
+    return;
+  }
+  this->scheduleNextTick(now);
+}
+
+void
+Measurements::scheduleNextTick(const time::steady_clock::TimePoint& now)
+{
+  time::steady_clock::TimePoint next = m_timingWheelEpoch + getTimingWheelTick() *
+                                      static_cast<time::nanoseconds::rep>(m_lastTick + 1);
+  m_timingWheelEvent = scheduler::schedule(next - now,
+                                           bind(&Measurements::processTimingWheel, this));
+}
+
 } // namespace nfd
@@ -71,6 +71,11 @@ public:
 } // namespace measurements
 
 /** \brief represents the Measurements table
+ *
+ *  Entries are expired by a coarse timing wheel: each entry sits in the slot of the tick
+ *  that covers its expiry time. extendLifetime only updates the expiry time in the entry;
+ *  when the wheel reaches the slot, an entry that has been extended is re-filed instead of
+ *  being erased. This keeps scheduler operations off the path of every Data.
  */
 class Measurements : noncopyable
 {
@@ -121,9 +126,17 @@ public:
   static time::nanoseconds
   getInitialLifetime();
 
+  /** \return granularity of the timing wheel
+   *
+   *  An entry is erased within one tick after its lifetime ends.
+   */
+  static time::nanoseconds
+  getTimingWheelTick();
+
   /** \brief extend lifetime of an entry
    *
    *  The entry will be kept until at least now()+lifetime.
+   *  This does not touch the scheduler or the timing wheel.
    */
   void
   extendLifetime(measurements::Entry& entry, const time::nanoseconds& lifetime);
@@ -135,6 +148,25 @@ private:
   void
   cleanup(measurements::Entry& entry);
 
+  /** \brief put an entry into the timing wheel slot covering its expiry time,
+   *         and start the wheel if it is not running
+   */
+  void
+  fileEntry(const shared_ptr<measurements::Entry>& entry);
+
+  /** \brief process timing wheel slots up to the current time
+   */
+  void
+  processTimingWheel();
+
+  /** \return number of whole ticks from wheel epoch to \p t
+   */
+  uint64_t
+  getTick(const time::steady_clock::TimePoint& t) const;
+
+  void
+  scheduleNextTick(const time::steady_clock::TimePoint& now);
+
   shared_ptr<measurements::Entry>
   get(name_tree::Entry& nte);
 
@@ -147,6 +179,23 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  typedef std::vector<shared_ptr<measurements::Entry>> TimingWheelSlot;
+
+  /** \brief timing wheel of N_TIMING_WHEEL_SLOTS slots;
+   *         tick k is stored in slot k % N_TIMING_WHEEL_SLOTS
+   *
+   *  An entry whose expiry is more than one revolution away is re-filed each time
+   *  its slot comes around.
+   */
+  std::vector<TimingWheelSlot> m_timingWheel;
+  TimingWheelSlot m_expiringSlot; ///< slot being processed, kept to reuse its capacity
+  time::steady_clock::TimePoint m_timingWheelEpoch;
+  uint64_t m_lastTick; ///< last processed tick
+  bool m_isTimingWheelRunning;
+  scheduler::ScopedEventId m_timingWheelEvent;
+
+  static const size_t N_TIMING_WHEEL_SLOTS;
 };
 
 inline time::nanoseconds
@@ -155,6 +204,12 @@ Measurements::getInitialLifetime()
   return time::seconds(4);
 }
 
+inline time::nanoseconds
+Measurements::getTimingWheelTick()
+{
+  return time::seconds(1);
+}
+
 inline size_t
 Measurements::size() const
 {
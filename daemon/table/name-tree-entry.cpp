@@ -47,6 +47,9 @@ Node::~Node()
 Entry::Entry(const Name& name)
   : m_hash(0)
   , m_prefix(name)
+  , m_nNonExactMatchPitEntries(0)
+  , m_effectiveStrategy(nullptr)
+  , m_effectiveStrategyGeneration(0)
 {
 }
 
@@ -88,6 +91,10 @@ Entry::insertPitEntry(shared_ptr<pit::Entry> pitEntry)
 
   m_pitEntries.push_back(pitEntry);
   pitEntry->m_nameTreeEntry = this->shared_from_this();
+
+  if (!pitEntry->isExactMatch()) {
+    ++m_nNonExactMatchPitEntries;
+  }
 }
 
 void
@@ -103,6 +110,23 @@ Entry::erasePitEntry(shared_ptr<pit::Entry> pitEntry)
   *it = m_pitEntries.back();
   m_pitEntries.pop_back();
   pitEntry->m_nameTreeEntry.reset();
+
+  if (!pitEntry->isExactMatch()) {
+    BOOST_ASSERT(m_nNonExactMatchPitEntries > 0);
+    --m_nNonExactMatchPitEntries;
+  }
+}
+
+bool
+Entry::hasPitEntriesInAncestors() const
+{
+  for (const Entry* ancestor = m_parent.get(); ancestor != nullptr;
+       ancestor = ancestor->m_parent.get()) {
+    if (ancestor->hasPitEntries()) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void
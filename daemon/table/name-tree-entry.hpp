@@ -36,6 +36,10 @@ namespace nfd {
 
 class NameTree;
 
+namespace fw {
+class Strategy;
+} // namespace fw
+
 namespace name_tree {
 
 // Forward declarations
@@ -110,6 +114,17 @@ public: // attached table entries
   bool
   hasPitEntries() const;
 
+  /** \return true if every attached PIT entry is an exact match (pit::Entry::isExactMatch),
+   *          so that any Data with the prefix of this entry as its Name satisfies all of them
+   */
+  bool
+  hasOnlyExactMatchPitEntries() const;
+
+  /** \return true if any ancestor of this entry has PIT entries
+   */
+  bool
+  hasPitEntriesInAncestors() const;
+
   const std::vector<shared_ptr<pit::Entry> >&
   getPitEntries() const;
 
@@ -125,6 +140,18 @@ public: // attached table entries
   shared_ptr<strategy_choice::Entry>
   getStrategyChoiceEntry() const;
 
+public: // effective strategy cache
+  /** \brief caches the effective strategy of this entry
+   *  \param generation StrategyChoice generation in which \p strategy is effective
+   */
+  void
+  setEffectiveStrategy(fw::Strategy* strategy, uint64_t generation);
+
+  /** \return cached effective strategy, or nullptr if nothing was cached in \p generation
+   */
+  fw::Strategy*
+  getEffectiveStrategy(uint64_t generation) const;
+
 private:
   // Benefits of storing m_hash
   // 1. m_hash is compared before m_prefix is compared
@@ -135,8 +162,11 @@ private:
   std::vector<shared_ptr<Entry> > m_children; // Children pointers.
   shared_ptr<fib::Entry> m_fibEntry;
   std::vector<shared_ptr<pit::Entry> > m_pitEntries;
+  size_t m_nNonExactMatchPitEntries; // number of PIT entries that are not exact match
   shared_ptr<measurements::Entry> m_measurementsEntry;
   shared_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
+  fw::Strategy* m_effectiveStrategy;
+  uint64_t m_effectiveStrategyGeneration;
 
   // get the Name Tree Node that is associated with this Name Tree Entry
   Node* m_node;
@@ -199,6 +229,12 @@ Entry::hasPitEntries() const
   return !m_pitEntries.empty();
 }
 
+inline bool
+Entry::hasOnlyExactMatchPitEntries() const
+{
+  return m_nNonExactMatchPitEntries == 0;
+}
+
 inline const std::vector<shared_ptr<pit::Entry> >&
 Entry::getPitEntries() const
 {
@@ -217,6 +253,19 @@ Entry::getStrategyChoiceEntry() const
   return m_strategyChoiceEntry;
 }
 
+inline void
+Entry::setEffectiveStrategy(fw::Strategy* strategy, uint64_t generation)
+{
+  m_effectiveStrategy = strategy;
+  m_effectiveStrategyGeneration = generation;
+}
+
+inline fw::Strategy*
+Entry::getEffectiveStrategy(uint64_t generation) const
+{
+  return m_effectiveStrategyGeneration == generation ? m_effectiveStrategy : nullptr;
+}
+
 } // namespace name_tree
 } // namespace nfd
 
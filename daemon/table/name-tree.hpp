@@ -45,6 +45,18 @@ computeHash(const Name& prefix);
 std::vector<size_t>
 computeHashSet(const Name& prefix);
 
+/**
+ * \brief a hash function object on Name, for use with unordered containers
+ */
+struct NameHash
+{
+  size_t
+  operator()(const Name& name) const
+  {
+    return computeHash(name);
+  }
+};
+
 /// a predicate to accept or reject an Entry in find operations
 typedef function<bool (const Entry& entry)> EntrySelector;
 
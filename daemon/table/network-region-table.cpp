@@ -28,14 +28,39 @@
 
 namespace nfd {
 
+NetworkRegionTable::NetworkRegionTable()
+  : m_version(0)
+{
+}
+
+std::pair<NetworkRegionTable::const_iterator, bool>
+NetworkRegionTable::insert(const Name& regionName)
+{
+  auto res = m_regions.insert(regionName);
+  if (res.second) {
+    for (size_t len = 0; len <= regionName.size(); ++len) {
+      m_regionPrefixes.insert(regionName.getPrefix(len));
+    }
+    ++m_version;
+  }
+  return res;
+}
+
+void
+NetworkRegionTable::clear()
+{
+  m_regions.clear();
+  m_regionPrefixes.clear();
+  ++m_version;
+}
+
 bool
 NetworkRegionTable::isInProducerRegion(const Link& link) const
 {
-  for (const Name& regionName : *this) {
-    for (const Name& delegationName : boost::adaptors::values(link.getDelegations())) {
-      if (delegationName.isPrefixOf(regionName)) {
-        return true;
-      }
+  // a delegation name is a prefix of some region name iff it appears in m_regionPrefixes
+  for (const Name& delegationName : boost::adaptors::values(link.getDelegations())) {
+    if (m_regionPrefixes.count(delegationName) > 0) {
+      return true;
     }
   }
   return false;
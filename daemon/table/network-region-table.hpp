@@ -26,7 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_NETWORK_REGION_TABLE_HPP
 #define NFD_DAEMON_TABLE_NETWORK_REGION_TABLE_HPP
 
-#include "common.hpp"
+#include "name-tree.hpp"
 
 namespace nfd {
 
@@ -35,11 +35,44 @@ namespace nfd {
  *  This table is used in forwarding to process Interests with Link objects.
  *
  *  NetworkRegionTable exposes a set-like API, including methods `insert`, `clear`,
- *  `find`, `size`, `begin`, and `end`.
+ *  `find`, `size`, `empty`, `begin`, and `end`.
+ *
+ *  In addition to region names, the table keeps a hash set of every prefix of every region name,
+ *  so that \p isInProducerRegion needs one hash lookup per delegation.
  */
-class NetworkRegionTable : public std::set<Name>
+class NetworkRegionTable
 {
 public:
+  typedef std::set<Name>::const_iterator const_iterator;
+
+  NetworkRegionTable();
+
+  std::pair<const_iterator, bool>
+  insert(const Name& regionName);
+
+  void
+  clear();
+
+  const_iterator
+  find(const Name& regionName) const;
+
+  size_t
+  size() const;
+
+  bool
+  empty() const;
+
+  const_iterator
+  begin() const;
+
+  const_iterator
+  end() const;
+
+  /** \return a number that changes whenever the table is modified
+   */
+  uint64_t
+  getVersion() const;
+
   /** \brief determines whether an Interest has reached a producer region
    *  \param link the Link object on an Interest
    *  \retval true the Interest has reached a producer region
@@ -51,8 +84,49 @@ public:
    */
   bool
   isInProducerRegion(const Link& link) const;
+
+private:
+  std::set<Name> m_regions;
+  std::unordered_set<Name, name_tree::NameHash> m_regionPrefixes;
+  uint64_t m_version;
 };
 
+inline NetworkRegionTable::const_iterator
+NetworkRegionTable::find(const Name& regionName) const
+{
+  return m_regions.find(regionName);
+}
+
+inline size_t
+NetworkRegionTable::size() const
+{
+  return m_regions.size();
+}
+
+inline bool
+NetworkRegionTable::empty() const
+{
+  return m_regions.empty();
+}
+
+inline NetworkRegionTable::const_iterator
+NetworkRegionTable::begin() const
+{
+  return m_regions.begin();
+}
+
+inline NetworkRegionTable::const_iterator
+NetworkRegionTable::end() const
+{
+  return m_regions.end();
+}
+
+inline uint64_t
+NetworkRegionTable::getVersion() const
+{
+  return m_version;
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_TABLE_NETWORK_REGION_TABLE_HPP
@@ -32,8 +32,26 @@ namespace pit {
 const Name Entry::LOCALHOST_NAME("ndn:/localhost");
 const Name Entry::LOCALHOP_NAME("ndn:/localhop");
 
+/** \return \p interest, or a copy of it if its wire is part of a larger packet buffer
+ *          (e.g. an LpPacket or a receive slab), so that the entry does not keep
+ *          the whole buffer alive
+ */
+static shared_ptr<const Interest>
+copyOutOfBuffer(const Interest& interest)
+{
+  if (!interest.hasWire()) {
+    return interest.shared_from_this();
+  }
+
+  const Block& wire = interest.wireEncode();
+  if (wire.size() == wire.getBuffer()->size()) {
+    return interest.shared_from_this();
+  }
+  return make_shared<Interest>(Block(wire.wire(), wire.size()));
+}
+
 Entry::Entry(const Interest& interest)
-  : m_interest(interest.shared_from_this())
+  : m_interest(copyOutOfBuffer(interest))
 {
 }
 
@@ -43,6 +61,17 @@ Entry::getName() const
   return m_interest->getName();
 }
 
+bool
+Entry::isExactMatch() const
+{
+  const Name& name = m_interest->getName();
+  return (name.empty() || !name[-1].isImplicitSha256Digest()) &&
+         m_interest->getMinSuffixComponents() < 0 &&
+         m_interest->getMaxSuffixComponents() < 0 &&
+         m_interest->getPublisherPublicKeyLocator().empty() &&
+         m_interest->getExclude().empty();
+}
+
 bool
 Entry::hasLocalInRecord() const
 {
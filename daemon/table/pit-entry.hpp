@@ -78,6 +78,15 @@ public:
   const Name&
   getName() const;
 
+  /** \brief determines whether Interest is satisfied by any Data of the same Name
+   *
+   *  \return true if Interest Name does not end with an implicit digest, and
+   *          Interest has no selector that restricts which Data can satisfy it
+   *          (MinSuffixComponents, MaxSuffixComponents, PublisherPublicKeyLocator, Exclude)
+   */
+  bool
+  isExactMatch() const;
+
   /** \brief decides whether Interest can be forwarded to face
    *
    *  \return true if OutRecord of this face does not exist or has expired,
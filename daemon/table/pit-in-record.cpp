@@ -24,6 +24,8 @@
 
 #include "pit-in-record.hpp"
 
+#include <ndn-cxx/lp/tags.hpp>
+
 namespace nfd {
 namespace pit {
 
@@ -36,7 +38,27 @@ void
 InRecord::update(const Interest& interest)
 {
   this->FaceRecord::update(interest);
-  m_interest = const_cast<Interest&>(interest).shared_from_this();
+
+  const Block& wire = interest.wireEncode();
+  if (wire.size() == wire.getBuffer()->size()) {
+    // share the buffer, but not the parsed sub-elements
+    m_interestWire = Block(wire.getBuffer(), wire.begin(), wire.end());
+  }
+  else {
+    // Interest is part of a larger packet buffer (e.g. an LpPacket or a receive slab), copy it out
+    m_interestWire = Block(wire.wire(), wire.size());
+  }
+  m_interest.reset();
+}
+
+const Interest&
+InRecord::getInterest() const
+{
+  if (m_interest == nullptr) {
+    m_interest = make_shared<Interest>(this->getInterestWire());
+    m_interest->setTag(make_shared<lp::IncomingFaceIdTag>(this->getFace()->getId()));
+  }
+  return *m_interest;
 }
 
 } // namespace pit
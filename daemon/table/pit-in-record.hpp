@@ -33,6 +33,10 @@ namespace pit {
 
 /** \class InRecord
  *  \brief contains information about an Interest from an incoming face
+ *
+ *  InRecord keeps the wire encoding of the last Interest from the face, not the incoming
+ *  Interest with its tags and the packet buffer it arrived in. getInterest() decodes it
+ *  when it is first forwarded or Nacked, and keeps the decoded Interest until the next update.
  */
 class InRecord : public FaceRecord
 {
@@ -43,18 +47,26 @@ public:
   void
   update(const Interest& interest);
 
+  /** \return wire encoding of the last Interest from the face
+   */
+  const Block&
+  getInterestWire() const;
+
+  /** \return the last Interest from the face, with IncomingFaceIdTag set to the face
+   */
   const Interest&
   getInterest() const;
 
 private:
-  shared_ptr<const Interest> m_interest;
+  Block m_interestWire;
+  mutable shared_ptr<Interest> m_interest; ///< decoded from m_interestWire on first use
 };
 
-inline const Interest&
-InRecord::getInterest() const
+inline const Block&
+InRecord::getInterestWire() const
 {
-  BOOST_ASSERT(static_cast<bool>(m_interest));
-  return *m_interest;
+  BOOST_ASSERT(m_interestWire.hasWire());
+  return m_interestWire;
 }
 
 } // namespace pit
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-quota.hpp"
+
+namespace nfd {
+
+const size_t PitQuota::UNLIMITED = std::numeric_limits<size_t>::max();
+
+PitQuota::PitQuota()
+  : m_capacity(UNLIMITED)
+  , m_faceQuota(UNLIMITED)
+{
+}
+
+void
+PitQuota::setCapacity(size_t nMaxEntries)
+{
+  m_capacity = nMaxEntries;
+}
+
+void
+PitQuota::setFaceQuota(size_t nMaxEntries)
+{
+  m_faceQuota = nMaxEntries;
+}
+
+void
+PitQuota::setPrefixQuota(const Name& prefix, size_t nMaxEntries)
+{
+  for (PrefixRecord& record : m_prefixes) {
+    if (record.prefix == prefix) {
+      record.nMaxEntries = nMaxEntries;
+      return;
+    }
+  }
+  m_prefixes.push_back({prefix, nMaxEntries, 0});
+}
+
+void
+PitQuota::clearPrefixQuotas()
+{
+  m_prefixes.clear();
+}
+
+PitQuota::RejectReason
+PitQuota::check(const Name& name, FaceId face, size_t nEntries) const
+{
+  if (nEntries >= m_capacity) {
+    return REJECT_CAPACITY;
+  }
+
+  if (m_faceQuota != UNLIMITED) {
+    auto it = m_faces.find(face);
+    if (it != m_faces.end() && it->second.nEntries >= m_faceQuota) {
+      return REJECT_FACE;
+    }
+  }
+
+  for (const PrefixRecord& record : m_prefixes) {
+    if (record.nEntries >= record.nMaxEntries && record.prefix.isPrefixOf(name)) {
+      return REJECT_PREFIX;
+    }
+  }
+
+  return REJECT_NONE;
+}
+
+static void
+incrementRejectCounter(PitQuota::Counters& counters, PitQuota::RejectReason reason)
+{
+  switch (reason) {
+  case PitQuota::REJECT_CAPACITY:
+    ++counters.nCapacityRejects;
+    break;
+  case PitQuota::REJECT_FACE:
+    ++counters.nFaceRejects;
+    break;
+  case PitQuota::REJECT_PREFIX:
+    ++counters.nPrefixRejects;
+    break;
+  case PitQuota::REJECT_NONE:
+    break;
+  }
+}
+
+void
+PitQuota::recordReject(RejectReason reason, FaceId face)
+{
+  incrementRejectCounter(m_counters, reason);
+  incrementRejectCounter(m_faces[face].counters, reason);
+}
+
+void
+PitQuota::afterInsert(const Name& name, FaceId face)
+{
+  ++m_faces[face].nEntries;
+
+  for (PrefixRecord& record : m_prefixes) {
+    if (record.prefix.isPrefixOf(name)) {
+      ++record.nEntries;
+    }
+  }
+}
+
+void
+PitQuota::beforeErase(const Name& name, FaceId face)
+{
+  auto it = m_faces.find(face);
+  if (it != m_faces.end() && it->second.nEntries > 0) {
+    --it->second.nEntries;
+  }
+
+  for (PrefixRecord& record : m_prefixes) {
+    if (record.nEntries > 0 && record.prefix.isPrefixOf(name)) {
+      --record.nEntries;
+    }
+  }
+}
+
+void
+PitQuota::removeFace(FaceId face)
+{
+  m_faces.erase(face);
+}
+
+const PitQuota::Counters*
+PitQuota::getFaceCounters(FaceId face) const
+{
+  auto it = m_faces.find(face);
+  if (it == m_faces.end()) {
+    return nullptr;
+  }
+  return &it->second.counters;
+}
+
+size_t
+PitQuota::getNFaceEntries(FaceId face) const
+{
+  auto it = m_faces.find(face);
+  if (it == m_faces.end()) {
+    return 0;
+  }
+  return it->second.nEntries;
+}
+
+std::ostream&
+operator<<(std::ostream& os, PitQuota::RejectReason reason)
+{
+  switch (reason) {
+  case PitQuota::REJECT_NONE:
+    return os << "none";
+  case PitQuota::REJECT_CAPACITY:
+    return os << "capacity";
+  case PitQuota::REJECT_FACE:
+    return os << "face";
+  case PitQuota::REJECT_PREFIX:
+    return os << "prefix";
+  }
+  return os << static_cast<int>(reason);
+}
+
+} // namespace nfd
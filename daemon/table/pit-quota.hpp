@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_QUOTA_HPP
+#define NFD_DAEMON_TABLE_PIT_QUOTA_HPP
+
+#include "core/counter.hpp"
+#include "face/face.hpp"
+
+namespace nfd {
+
+/** \brief bounds the number of PIT entries
+ *
+ *  PitQuota enforces three limits on the creation of new PIT entries:
+ *  \li a capacity of the whole PIT,
+ *  \li a quota of entries created by Interests from each downstream face,
+ *  \li quotas of entries under configured name prefixes.
+ *
+ *  PitQuota only keeps counters, so that check() can be evaluated before
+ *  any NameTree or PIT entry is allocated for an incoming Interest.
+ *  All limits are unlimited by default.
+ */
+class PitQuota : noncopyable
+{
+public:
+  /** \brief indicates why a new PIT entry is rejected
+   */
+  enum RejectReason {
+    REJECT_NONE = 0,
+    /// PIT has reached its capacity
+    REJECT_CAPACITY,
+    /// downstream face has reached its quota
+    REJECT_FACE,
+    /// Interest Name falls under a prefix that has reached its quota
+    REJECT_PREFIX
+  };
+
+  /** \brief counts rejected Interests by reason
+   */
+  class Counters
+  {
+  public:
+    PacketCounter nCapacityRejects;
+    PacketCounter nFaceRejects;
+    PacketCounter nPrefixRejects;
+  };
+
+  PitQuota();
+
+public: // configuration
+  /** \brief sets maximum number of PIT entries
+   */
+  void
+  setCapacity(size_t nMaxEntries);
+
+  size_t
+  getCapacity() const;
+
+  /** \brief sets maximum number of PIT entries created by Interests from each face
+   */
+  void
+  setFaceQuota(size_t nMaxEntries);
+
+  size_t
+  getFaceQuota() const;
+
+  /** \brief sets maximum number of PIT entries under prefix
+   *
+   *  If prefix already has a quota, the quota is updated. If Interest Name falls under
+   *  more than one prefix, every quota applies.
+   *  \note Entries that existed before the quota is set are not counted.
+   */
+  void
+  setPrefixQuota(const Name& prefix, size_t nMaxEntries);
+
+  /** \brief removes all prefix quotas
+   */
+  void
+  clearPrefixQuotas();
+
+public: // admission control
+  /** \brief determines whether a new PIT entry can be created
+   *  \param name Interest Name
+   *  \param face incoming face of Interest
+   *  \param nEntries current number of PIT entries
+   *  \return REJECT_NONE if the entry can be created, otherwise the first quota exceeded
+   */
+  RejectReason
+  check(const Name& name, FaceId face, size_t nEntries) const;
+
+  /** \brief counts a rejected Interest
+   */
+  void
+  recordReject(RejectReason reason, FaceId face);
+
+  /** \brief counts a new PIT entry
+   */
+  void
+  afterInsert(const Name& name, FaceId face);
+
+  /** \brief uncounts a PIT entry
+   */
+  void
+  beforeErase(const Name& name, FaceId face);
+
+  /** \brief forgets counters of face
+   *
+   *  This should be invoked when a face is removed.
+   */
+  void
+  removeFace(FaceId face);
+
+public: // counters
+  const Counters&
+  getCounters() const;
+
+  /** \return rejection counters of Interests from face, or nullptr if none was rejected
+   *          nor counted
+   */
+  const Counters*
+  getFaceCounters(FaceId face) const;
+
+  /** \return number of PIT entries created by Interests from face
+   */
+  size_t
+  getNFaceEntries(FaceId face) const;
+
+public:
+  static const size_t UNLIMITED;
+
+private:
+  struct FaceRecord
+  {
+    FaceRecord()
+      : nEntries(0)
+    {
+    }
+
+    size_t nEntries;
+    Counters counters;
+  };
+
+  struct PrefixRecord
+  {
+    Name prefix;
+    size_t nMaxEntries;
+    size_t nEntries;
+  };
+
+  size_t m_capacity;
+  size_t m_faceQuota;
+  std::unordered_map<FaceId, FaceRecord> m_faces;
+  std::vector<PrefixRecord> m_prefixes;
+  Counters m_counters;
+};
+
+inline size_t
+PitQuota::getCapacity() const
+{
+  return m_capacity;
+}
+
+inline size_t
+PitQuota::getFaceQuota() const
+{
+  return m_faceQuota;
+}
+
+inline const PitQuota::Counters&
+PitQuota::getCounters() const
+{
+  return m_counters;
+}
+
+std::ostream&
+operator<<(std::ostream& os, PitQuota::RejectReason reason);
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_QUOTA_HPP
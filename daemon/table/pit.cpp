@@ -24,10 +24,14 @@
  */
 
 #include "pit.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
 #include <type_traits>
 
 #include <boost/concept/assert.hpp>
 #include <boost/concept_check.hpp>
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
 
 namespace nfd {
@@ -38,6 +42,25 @@ static_assert(std::is_move_constructible<DataMatchResult>::value,
               "DataMatchResult must be MoveConstructible");
 #endif // HAVE_IS_MOVE_CONSTRUCTIBLE
 
+const size_t DataMatchResult::N_INLINE;
+
+void
+DataMatchResult::push_back(const shared_ptr<Entry>& entry)
+{
+  if (m_overflow.empty()) {
+    if (m_size < N_INLINE) {
+      m_inline[m_size++] = entry;
+      return;
+    }
+
+    m_overflow.reserve(N_INLINE * 2);
+    std::move(m_inline.begin(), m_inline.end(), std::back_inserter(m_overflow));
+  }
+
+  m_overflow.push_back(entry);
+  ++m_size;
+}
+
 } // namespace pit
 
 // http://en.cppreference.com/w/cpp/concept/ForwardIterator
@@ -57,14 +80,26 @@ Pit::Pit(NameTree& nameTree)
 {
 }
 
+static FaceId
+getIncomingFaceId(const Interest& interest)
+{
+  shared_ptr<lp::IncomingFaceIdTag> incomingFaceIdTag = interest.getTag<lp::IncomingFaceIdTag>();
+  return incomingFaceIdTag == nullptr ? face::INVALID_FACEID : *incomingFaceIdTag;
+}
+
 std::pair<shared_ptr<pit::Entry>, bool>
 Pit::findOrInsert(const Interest& interest, bool allowInsert)
 {
-  // ensure NameTree entry exists
+  // ensure NameTree entry exists if insertion is allowed
   const Name& name = interest.getName();
   bool isEndWithDigest = name.size() > 0 && name[-1].isImplicitSha256Digest();
-  shared_ptr<name_tree::Entry> nte = m_nameTree.lookup(isEndWithDigest ? name.getPrefix(-1) : name);
-  BOOST_ASSERT(nte != nullptr);
+  const Name& nteName = isEndWithDigest ? name.getPrefix(-1) : name;
+  shared_ptr<name_tree::Entry> nte = allowInsert ? m_nameTree.lookup(nteName) :
+                                                   m_nameTree.findExactMatch(nteName);
+  if (nte == nullptr) {
+    BOOST_ASSERT(!allowInsert);
+    return {nullptr, true};
+  }
   size_t nteNameLen = nte->getPrefix().size();
 
   // check if PIT entry already exists
@@ -90,20 +125,32 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   auto entry = make_shared<pit::Entry>(interest);
   nte->insertPitEntry(entry);
   m_nItems++;
+  m_quota.afterInsert(name, getIncomingFaceId(interest));
   return {entry, true};
 }
 
 pit::DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
+  pit::DataMatchResult matches;
+
+  // fast path: all PIT entries are on Data Name and none of them has selectors
+  shared_ptr<name_tree::Entry> exactNte = m_nameTree.findExactMatch(data.getName());
+  if (exactNte != nullptr && exactNte->hasOnlyExactMatchPitEntries() &&
+      !exactNte->hasPitEntriesInAncestors()) {
+    for (const shared_ptr<pit::Entry>& pitEntry : exactNte->getPitEntries()) {
+      matches.push_back(pitEntry);
+    }
+    return matches;
+  }
+
   auto&& ntMatches = m_nameTree.findAllMatches(data.getName(),
     [] (const name_tree::Entry& entry) { return entry.hasPitEntries(); });
 
-  pit::DataMatchResult matches;
   for (const name_tree::Entry& nte : ntMatches) {
     for (const shared_ptr<pit::Entry>& pitEntry : nte.getPitEntries()) {
       if (pitEntry->getInterest().matchesData(data))
-        matches.emplace_back(pitEntry);
+        matches.push_back(pitEntry);
     }
   }
 
@@ -116,6 +163,8 @@ Pit::erase(shared_ptr<pit::Entry> pitEntry)
   shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(*pitEntry);
   BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
 
+  m_quota.beforeErase(pitEntry->getName(), getIncomingFaceId(pitEntry->getInterest()));
+
   nameTreeEntry->erasePitEntry(pitEntry);
   m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
 
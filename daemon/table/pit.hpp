@@ -28,18 +28,74 @@
 
 #include "name-tree.hpp"
 #include "pit-entry.hpp"
+#include "pit-quota.hpp"
+
+#include <array>
 
 namespace nfd {
 namespace pit {
 
-/** \class DataMatchResult
- *  \brief an unordered iterable of all PIT entries matching Data
+/** \brief an unordered iterable of all PIT entries matching Data
  *
- *  This type shall support:
+ *  This type supports:
  *    iterator<shared_ptr<pit::Entry>> begin()
  *    iterator<shared_ptr<pit::Entry>> end()
+ *
+ *  Up to N_INLINE entries are stored inline without memory allocation,
+ *  which covers the common case of a few Interests pending for the Data name.
  */
-typedef std::vector<shared_ptr<pit::Entry>> DataMatchResult;
+class DataMatchResult
+{
+public:
+  typedef const shared_ptr<Entry>* const_iterator;
+
+  DataMatchResult();
+
+  void
+  push_back(const shared_ptr<Entry>& entry);
+
+  size_t
+  size() const;
+
+  const_iterator
+  begin() const;
+
+  const_iterator
+  end() const;
+
+public:
+  static const size_t N_INLINE = 4;
+
+private:
+  std::array<shared_ptr<Entry>, N_INLINE> m_inline;
+  /// all entries after exceeding N_INLINE, otherwise empty
+  std::vector<shared_ptr<Entry>> m_overflow;
+  size_t m_size;
+};
+
+inline
+DataMatchResult::DataMatchResult()
+  : m_size(0)
+{
+}
+
+inline size_t
+DataMatchResult::size() const
+{
+  return m_size;
+}
+
+inline DataMatchResult::const_iterator
+DataMatchResult::begin() const
+{
+  return m_overflow.empty() ? m_inline.data() : m_overflow.data();
+}
+
+inline DataMatchResult::const_iterator
+DataMatchResult::end() const
+{
+  return this->begin() + m_size;
+}
 
 } // namespace pit
 
@@ -59,6 +115,7 @@ public:
   /** \brief finds a PIT entry for Interest
    *  \param interest the Interest
    *  \return an existing entry with same Name and Selectors; otherwise nullptr
+   *  \note This does not create NameTree entries.
    */
   shared_ptr<pit::Entry>
   find(const Interest& interest) const;
@@ -73,6 +130,11 @@ public:
 
   /** \brief performs a Data match
    *  \return an iterable of all PIT entries matching data
+   *
+   *  If the NameTree entry of Data Name has only exact match PIT entries
+   *  (name_tree::Entry::hasOnlyExactMatchPitEntries) and no ancestor has PIT entries,
+   *  the result is obtained with a single NameTree lookup without evaluating Interest selectors.
+   *  Otherwise, every prefix of Data Name is visited and each PIT entry is matched against Data.
    */
   pit::DataMatchResult
   findAllDataMatches(const Data& data) const;
@@ -83,6 +145,18 @@ public:
   void
   erase(shared_ptr<pit::Entry> pitEntry);
 
+  /** \brief gives access to PIT size limits
+   *
+   *  New entries are counted against the quota of the face in IncomingFaceIdTag
+   *  of the Interest that creates them.
+   *  \note Pit does not enforce the quota; Forwarder consults it before insertion.
+   */
+  PitQuota&
+  getQuota();
+
+  const PitQuota&
+  getQuota() const;
+
 public: // enumeration
   class const_iterator;
 
@@ -154,6 +228,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  PitQuota m_quota;
 };
 
 inline size_t
@@ -162,6 +237,18 @@ Pit::size() const
   return m_nItems;
 }
 
+inline PitQuota&
+Pit::getQuota()
+{
+  return m_quota;
+}
+
+inline const PitQuota&
+Pit::getQuota() const
+{
+  return m_quota;
+}
+
 inline shared_ptr<pit::Entry>
 Pit::find(const Interest& interest) const
 {
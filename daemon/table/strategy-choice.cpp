@@ -39,6 +39,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_generation(1)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -86,6 +87,17 @@ StrategyChoice::getStrategy(const Name& strategyName) const
   return candidate;
 }
 
+std::vector<fw::Strategy*>
+StrategyChoice::getInstalledStrategies() const
+{
+  std::vector<fw::Strategy*> strategies;
+  strategies.reserve(m_strategyInstances.size());
+  for (const auto& instance : m_strategyInstances) {
+    strategies.push_back(instance.second.get());
+  }
+  return strategies;
+}
+
 bool
 StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 {
@@ -118,6 +130,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(*strategy);
+  ++m_generation;
   return true;
 }
 
@@ -144,6 +157,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(shared_ptr<Entry>());
   m_nameTree.eraseEntryIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -177,17 +191,20 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 Strategy&
 StrategyChoice::findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const
 {
-  shared_ptr<strategy_choice::Entry> entry = nte->getStrategyChoiceEntry();
-  if (static_cast<bool>(entry))
-    return entry->getStrategy();
+  Strategy* strategy = nte->getEffectiveStrategy(m_generation);
+  if (strategy != nullptr) {
+    return *strategy;
+  }
 
-  nte = m_nameTree.findLongestPrefixMatch(nte,
+  shared_ptr<name_tree::Entry> scNte = m_nameTree.findLongestPrefixMatch(nte,
     [] (const name_tree::Entry& entry) {
       return static_cast<bool>(entry.getStrategyChoiceEntry());
     });
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return nte->getStrategyChoiceEntry()->getStrategy();
+  BOOST_ASSERT(static_cast<bool>(scNte));
+  strategy = &scNte->getStrategyChoiceEntry()->getStrategy();
+  nte->setEffectiveStrategy(strategy, m_generation);
+  return *strategy;
 }
 
 Strategy&
@@ -222,6 +239,7 @@ StrategyChoice::setDefaultStrategy(shared_ptr<Strategy> strategy)
   NFD_LOG_INFO("setDefaultStrategy " << strategy->getName());
 
   entry->setStrategy(*strategy);
+  ++m_generation;
 }
 
 static inline void
@@ -63,6 +63,18 @@ public: // available Strategy types
   bool
   install(shared_ptr<fw::Strategy> strategy);
 
+  /** \brief get Strategy instance by strategyName
+   *  \param strategyName a versioned or unversioned strategyName
+   *  \return the strategy, or nullptr if not installed
+   */
+  fw::Strategy*
+  getStrategy(const Name& strategyName) const;
+
+  /** \return all installed Strategy instances
+   */
+  std::vector<fw::Strategy*>
+  getInstalledStrategies() const;
+
 public: // Strategy Choice table
   /** \brief set strategy of prefix to be strategyName
    *  \param prefix the name prefix for which \p strategyName should be used
@@ -146,12 +158,6 @@ public: // enumeration
   end() const;
 
 private:
-  /** \brief get Strategy instance by strategyName
-   *  \param strategyName a versioned or unversioned strategyName
-   */
-  fw::Strategy*
-  getStrategy(const Name& strategyName) const;
-
   void
   setDefaultStrategy(shared_ptr<fw::Strategy> strategy);
 
@@ -160,6 +166,10 @@ private:
                  fw::Strategy& oldStrategy,
                  fw::Strategy& newStrategy);
 
+  /** \brief find effective strategy of a NameTree entry
+   *
+   *  The result is cached on \p nte, and is valid until the generation changes.
+   */
   fw::Strategy&
   findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const;
 
@@ -167,6 +177,14 @@ private:
   NameTree& m_nameTree;
   size_t m_nItems;
 
+  /** \brief generation of effective strategies
+   *
+   *  This is incremented whenever a StrategyChoice entry is inserted, changed, or erased,
+   *  which invalidates effective strategies cached on NameTree entries.
+   *  It starts at 1, so that a new NameTree entry has no valid cached strategy.
+   */
+  uint64_t m_generation;
+
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
 };
@@ -30,7 +30,40 @@ namespace nfd {
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (unique_ptr<fw::StrategyInfo>& item : m_slots) {
+    item.reset();
+  }
+  m_otherItems.reset();
+}
+
+fw::StrategyInfo*
+StrategyInfoHost::getOtherItem(int typeId) const
+{
+  if (m_otherItems == nullptr) {
+    return nullptr;
+  }
+
+  auto it = m_otherItems->find(typeId);
+  if (it == m_otherItems->end()) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
+void
+StrategyInfoHost::setOtherItem(int typeId, unique_ptr<fw::StrategyInfo> item)
+{
+  if (item == nullptr) {
+    if (m_otherItems != nullptr) {
+      m_otherItems->erase(typeId);
+    }
+    return;
+  }
+
+  if (m_otherItems == nullptr) {
+    m_otherItems.reset(new OtherItems);
+  }
+  (*m_otherItems)[typeId] = std::move(item);
 }
 
 } // namespace nfd
@@ -28,9 +28,14 @@
 
 #include "fw/strategy-info.hpp"
 
+#include <array>
+
 namespace nfd {
 
 /** \brief base class for an entity onto which StrategyInfo objects may be placed
+ *
+ *  Items of types registered in fw::getStrategyInfoSlot are stored in fixed slots,
+ *  so that they are found in constant time; other items are stored in a map.
  */
 class StrategyInfoHost
 {
@@ -38,17 +43,22 @@ public:
   /** \brief get a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
    *  \retval nullptr if no StrategyInfo of type T is stored
+   *
+   *  The returned pointer is valid until the item is replaced or erased,
+   *  or the host is destroyed.
    */
   template<typename T>
-  shared_ptr<T>
+  T*
   getStrategyInfo() const;
 
   /** \brief set a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
+   *
+   *  If \p strategyInfo is nullptr, the stored item of type T is erased.
    */
   template<typename T>
   void
-  setStrategyInfo(shared_ptr<T> strategyInfo);
+  setStrategyInfo(unique_ptr<T> strategyInfo);
 
   /** \brief get or create a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of from nfd::fw::StrategyInfo
@@ -57,7 +67,7 @@ public:
    *  otherwise, the existing item is returned.
    */
   template<typename T, typename ...A>
-  shared_ptr<T>
+  T*
   getOrCreateStrategyInfo(A&&... args);
 
   /** \brief clear all StrategyInfo items
@@ -66,50 +76,80 @@ public:
   clearStrategyInfo();
 
 private:
-  std::map<int, shared_ptr<fw::StrategyInfo>> m_items;
+  fw::StrategyInfo*
+  getItem(size_t slot, int typeId) const;
+
+  void
+  setItem(size_t slot, int typeId, unique_ptr<fw::StrategyInfo> item);
+
+  fw::StrategyInfo*
+  getOtherItem(int typeId) const;
+
+  void
+  setOtherItem(int typeId, unique_ptr<fw::StrategyInfo> item);
+
+private:
+  std::array<unique_ptr<fw::StrategyInfo>, fw::STRATEGY_INFO_N_SLOTS> m_slots;
+
+  typedef std::map<int, unique_ptr<fw::StrategyInfo>> OtherItems;
+  /** \brief items of types without a fixed slot; created on first use
+   */
+  unique_ptr<OtherItems> m_otherItems;
 };
 
 
+inline fw::StrategyInfo*
+StrategyInfoHost::getItem(size_t slot, int typeId) const
+{
+  if (slot < m_slots.size()) {
+    return m_slots[slot].get();
+  }
+  return this->getOtherItem(typeId);
+}
+
+inline void
+StrategyInfoHost::setItem(size_t slot, int typeId, unique_ptr<fw::StrategyInfo> item)
+{
+  if (slot < m_slots.size()) {
+    m_slots[slot] = std::move(item);
+  }
+  else {
+    this->setOtherItem(typeId, std::move(item));
+  }
+}
+
 template<typename T>
-shared_ptr<T>
+T*
 StrategyInfoHost::getStrategyInfo() const
 {
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  auto it = m_items.find(T::getTypeId());
-  if (it == m_items.end()) {
-    return nullptr;
-  }
-  return static_pointer_cast<T, fw::StrategyInfo>(it->second);
+  return static_cast<T*>(this->getItem(fw::getStrategyInfoSlot(T::getTypeId()), T::getTypeId()));
 }
 
 template<typename T>
 void
-StrategyInfoHost::setStrategyInfo(shared_ptr<T> item)
+StrategyInfoHost::setStrategyInfo(unique_ptr<T> item)
 {
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  if (item == nullptr) {
-    m_items.erase(T::getTypeId());
-  }
-  else {
-    m_items[T::getTypeId()] = item;
-  }
+  this->setItem(fw::getStrategyInfoSlot(T::getTypeId()), T::getTypeId(), std::move(item));
 }
 
 template<typename T, typename ...A>
-shared_ptr<T>
+T*
 StrategyInfoHost::getOrCreateStrategyInfo(A&&... args)
 {
   static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                 "T must inherit from StrategyInfo");
 
-  shared_ptr<T> item = this->getStrategyInfo<T>();
-  if (!static_cast<bool>(item)) {
-    item = make_shared<T>(std::forward<A>(args)...);
-    this->setStrategyInfo(item);
+  T* item = this->getStrategyInfo<T>();
+  if (item == nullptr) {
+    unique_ptr<T> created = make_unique<T>(std::forward<A>(args)...);
+    item = created.get();
+    this->setStrategyInfo(std::move(created));
   }
   return item;
 }
@@ -28,20 +28,27 @@
 #include "core/logger.hpp"
 
 #include <ndn-cxx/management/nfd-control-parameters.hpp>
+#include <ndn-cxx/management/nfd-control-response.hpp>
 
 namespace nfd {
 namespace rib {
 
 using ndn::nfd::ControlParameters;
+using ndn::nfd::ControlResponse;
 
 NFD_LOG_INIT("FibUpdater");
 
 const unsigned int FibUpdater::MAX_NUM_TIMEOUTS = 10;
 const uint32_t FibUpdater::ERROR_FACE_NOT_FOUND = 410;
+const Name FibUpdater::BATCH_UPDATE_COMMAND_PREFIX("/localhost/nfd/fib/batch-update");
+const size_t FibUpdater::MAX_BATCH_UPDATE_SIZE = 4096;
 
-FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
+FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller,
+                       ndn::Face& face, ndn::KeyChain& keyChain)
   : m_rib(rib)
   , m_controller(controller)
+  , m_face(face)
+  , m_keyChain(keyChain)
 {
   rib.setFibUpdater(this);
 }
@@ -195,6 +202,11 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
   std::string updateString = (updates.size() == 1) ? " update" : " updates";
   NFD_LOG_DEBUG("Applying " << updates.size() << updateString << " to FIB");
 
+  if (updates.size() > 1) {
+    sendBatchUpdate(updates, onSuccess, onFailure);
+    return;
+  }
+
   for (const FibUpdate& update : updates) {
     NFD_LOG_DEBUG("Sending FIB update: " << update);
 
@@ -260,6 +272,53 @@ FibUpdater::sendRemoveNextHopUpdate(const FibUpdate& update,
     bind(&FibUpdater::onUpdateError, this, update, onSuccess, onFailure, _1, _2, nTimeouts));
 }
 
+void
+FibUpdater::sendBatchUpdate(const FibUpdateList& updates,
+                            const FibUpdateSuccessCallback& onSuccess,
+                            const FibUpdateFailureCallback& onFailure,
+                            uint32_t nTimeouts)
+{
+  FibBatchUpdate parameters;
+  FibUpdateList sentUpdates;
+  size_t parametersSize = 0;
+
+  for (const FibUpdate& update : updates) {
+    FibBatchUpdate::Entry entry;
+    entry.action = (update.action == FibUpdate::ADD_NEXTHOP) ? FibBatchUpdate::ADD_NEXTHOP :
+                                                               FibBatchUpdate::REMOVE_NEXTHOP;
+    entry.name = update.name;
+    entry.faceId = update.faceId;
+    entry.cost = update.cost;
+
+    parametersSize += FibBatchUpdate::getEntryWireSize(entry);
+    if (parametersSize > MAX_BATCH_UPDATE_SIZE && !sentUpdates.empty()) {
+      break;
+    }
+
+    if (entry.action == FibBatchUpdate::ADD_NEXTHOP) {
+      parameters.addAddNextHop(entry.name, entry.faceId, entry.cost);
+    }
+    else {
+      parameters.addRemoveNextHop(entry.name, entry.faceId);
+    }
+    sentUpdates.push_back(update);
+  }
+
+  NFD_LOG_DEBUG("Sending FIB batch update with " << sentUpdates.size() << " of "
+                << updates.size() << " updates");
+
+  // KeyChain appends the timestamp, random value and signature of a signed command Interest
+  Interest command(Name(BATCH_UPDATE_COMMAND_PREFIX).append(parameters.wireEncode()));
+  m_keyChain.sign(command);
+
+  m_face.expressInterest(command,
+                         bind(&FibUpdater::onBatchUpdateResponse, this, sentUpdates, _2,
+                              onSuccess, onFailure, nTimeouts),
+                         bind(&FibUpdater::onBatchUpdateError, this, sentUpdates, onSuccess, onFailure,
+                              ndn::nfd::Controller::ERROR_TIMEOUT, std::string("Timeout"), 0,
+                              nTimeouts));
+}
+
 void
 FibUpdater::onUpdateSuccess(const FibUpdate update,
                             const FibUpdateSuccessCallback& onSuccess,
@@ -309,6 +368,110 @@ FibUpdater::onUpdateError(const FibUpdate update,
   }
 }
 
+void
+FibUpdater::onBatchUpdateResponse(const FibUpdateList& sentUpdates, const Data& data,
+                                  const FibUpdateSuccessCallback& onSuccess,
+                                  const FibUpdateFailureCallback& onFailure,
+                                  uint32_t nTimeouts)
+{
+  ControlResponse response;
+  try {
+    response.wireDecode(data.getContent().blockFromValue());
+  }
+  catch (const tlv::Error& e) {
+    return onBatchUpdateError(sentUpdates, onSuccess, onFailure,
+                              ndn::nfd::Controller::ERROR_SERVER, e.what(), 0, nTimeouts);
+  }
+
+  if (response.getCode() < ndn::nfd::Controller::ERROR_LBOUND) {
+    return onBatchUpdateSuccess(sentUpdates, onSuccess, onFailure);
+  }
+
+  uint64_t failedFaceId = 0;
+  if (response.getCode() == ERROR_FACE_NOT_FOUND) {
+    try {
+      ControlParameters body(response.getBody());
+      if (body.hasFaceId()) {
+        failedFaceId = body.getFaceId();
+      }
+    }
+    catch (const tlv::Error&) {
+    }
+  }
+
+  onBatchUpdateError(sentUpdates, onSuccess, onFailure,
+                     response.getCode(), response.getText(), failedFaceId, nTimeouts);
+}
+
+void
+FibUpdater::onBatchUpdateSuccess(const FibUpdateList& sentUpdates,
+                                 const FibUpdateSuccessCallback& onSuccess,
+                                 const FibUpdateFailureCallback& onFailure)
+{
+  bool isForBatchFaceId = (sentUpdates.front().faceId == m_batchFaceId);
+  FibUpdateList& updates = isForBatchFaceId ? m_updatesForBatchFaceId :
+                                              m_updatesForNonBatchFaceId;
+
+  // sendBatchUpdate takes updates from the front of the list, and later updates are appended
+  BOOST_ASSERT(sentUpdates.size() <= updates.size());
+  updates.erase(updates.begin(), std::next(updates.begin(), sentUpdates.size()));
+
+  if (!updates.empty()) {
+    sendUpdates(updates, onSuccess, onFailure);
+  }
+  else if (isForBatchFaceId) {
+    sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+  }
+  else {
+    onSuccess(m_inheritedRoutes);
+  }
+}
+
+void
+FibUpdater::onBatchUpdateError(const FibUpdateList& sentUpdates,
+                               const FibUpdateSuccessCallback& onSuccess,
+                               const FibUpdateFailureCallback& onFailure,
+                               uint32_t code, const std::string& error, uint64_t failedFaceId,
+                               uint32_t nTimeouts)
+{
+  NFD_LOG_DEBUG("Failed to apply batch of " << sentUpdates.size() << " updates"
+                << " (code: " << code << ", error: " << error << ")");
+
+  bool isForBatchFaceId = (sentUpdates.front().faceId == m_batchFaceId);
+  FibUpdateList& updates = isForBatchFaceId ? m_updatesForBatchFaceId :
+                                              m_updatesForNonBatchFaceId;
+
+  if (code == ndn::nfd::Controller::ERROR_TIMEOUT && nTimeouts < MAX_NUM_TIMEOUTS) {
+    sendBatchUpdate(updates, onSuccess, onFailure, ++nTimeouts);
+  }
+  else if (code == ERROR_FACE_NOT_FOUND) {
+    if (isForBatchFaceId) {
+      onFailure(code, error);
+      return;
+    }
+
+    size_t nUpdates = updates.size();
+    updates.remove_if([failedFaceId] (const FibUpdate& update) {
+        return update.faceId == failedFaceId;
+      });
+
+    if (updates.size() == nUpdates) {
+      BOOST_THROW_EXCEPTION(Error("Non-recoverable error: " + error + " code: " + to_string(code) +
+                                  " (no updates for FaceId " + to_string(failedFaceId) + ")"));
+    }
+
+    if (!updates.empty()) {
+      sendUpdates(updates, onSuccess, onFailure);
+    }
+    else {
+      onSuccess(m_inheritedRoutes);
+    }
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("Non-recoverable error: " + error + " code: " + to_string(code)));
+  }
+}
+
 void
 FibUpdater::addFibUpdate(FibUpdate update)
 {
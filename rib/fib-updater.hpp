@@ -30,8 +30,11 @@
 #include "fib-update.hpp"
 #include "rib.hpp"
 #include "rib-update-batch.hpp"
+#include "core/fib-batch-update.hpp"
 
+#include <ndn-cxx/face.hpp>
 #include <ndn-cxx/management/nfd-controller.hpp>
+#include <ndn-cxx/security/key-chain.hpp>
 
 namespace nfd {
 namespace rib {
@@ -57,7 +60,11 @@ public:
   typedef function<void(RibUpdateList inheritedRoutes)> FibUpdateSuccessCallback;
   typedef function<void(uint32_t code, const std::string& error)> FibUpdateFailureCallback;
 
-  FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
+  /** \param face the face used to express fib/batch-update commands
+   *  \param keyChain the KeyChain used to sign fib/batch-update commands
+   */
+  FibUpdater(Rib& rib, ndn::nfd::Controller& controller,
+             ndn::Face& face, ndn::KeyChain& keyChain);
 
   /** \brief computes FibUpdates using the provided RibUpdateBatch and then sends the
    *         updates to NFD's FIB
@@ -79,6 +86,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   /** \brief sends the passed updates to NFD
   *
+  *   A single update is sent as a FibAddNextHopCommand or FibRemoveNextHopCommand.
+  *   Multiple updates are sent as fib/batch-update commands.
+  *
   *   onSuccess or onFailure will be called based on the results in
   *   onUpdateSuccess or onUpdateFailure
   *
@@ -126,6 +136,19 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
                           const FibUpdateFailureCallback& onFailure,
                           uint32_t nTimeouts = 0);
 
+  /** \brief sends a fib/batch-update command to NFD carrying the updates at the front of
+  *          the passed list, as many as fit in one command
+  *
+  *   The remaining updates are sent after this command succeeds.
+  *
+  *   \param nTimeouts the number of times this command has failed due to timeout
+  */
+  void
+  sendBatchUpdate(const FibUpdateList& updates,
+                  const FibUpdateSuccessCallback& onSuccess,
+                  const FibUpdateFailureCallback& onFailure,
+                  uint32_t nTimeouts = 0);
+
 private:
   /** \brief calculates the FibUpdates generated by a RIB registration
   */
@@ -175,6 +198,46 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
                 const FibUpdateFailureCallback& onFailure,
                 uint32_t code, const std::string& error, uint32_t nTimeouts);
 
+  /** \brief decodes the ControlResponse of a fib/batch-update command, and calls
+  *          onBatchUpdateSuccess or onBatchUpdateError
+  */
+  void
+  onBatchUpdateResponse(const FibUpdateList& sentUpdates, const Data& data,
+                        const FibUpdateSuccessCallback& onSuccess,
+                        const FibUpdateFailureCallback& onFailure,
+                        uint32_t nTimeouts);
+
+  /** \brief callback used when a fib/batch-update command is successful.
+  *
+  *   The sent updates are removed from their update list. The rest of that list is sent
+  *   if it is not empty; otherwise the process continues as in onUpdateSuccess.
+  */
+  void
+  onBatchUpdateSuccess(const FibUpdateList& sentUpdates,
+                       const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure);
+
+  /** \brief callback used when a fib/batch-update command fails.
+  *
+  *   A batch is applied atomically, so none of the sent updates has taken effect.
+  *
+  *   If the command has not reached the max number of timeouts allowed, it is retried.
+  *
+  *   If the command failed due to a non-existent face that is the face of the update batch,
+  *   the FIB update process fails. If the face is a different face, the updates for that
+  *   face are dropped and the rest of the list is sent again.
+  *
+  *   Otherwise, a non-recoverable error has occurred and an exception is thrown.
+  *
+  *   \param failedFaceId the non-existent face reported by NFD, if code is ERROR_FACE_NOT_FOUND
+  */
+  void
+  onBatchUpdateError(const FibUpdateList& sentUpdates,
+                     const FibUpdateSuccessCallback& onSuccess,
+                     const FibUpdateFailureCallback& onFailure,
+                     uint32_t code, const std::string& error, uint64_t failedFaceId,
+                     uint32_t nTimeouts);
+
 private:
   /** \brief adds the update to an update list based on its Face ID
   *
@@ -257,9 +320,11 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
-  uint64_t m_batchFaceId;
+  ndn::Face& m_face;
+  ndn::KeyChain& m_keyChain;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  uint64_t m_batchFaceId;
   FibUpdateList m_updatesForBatchFaceId;
   FibUpdateList m_updatesForNonBatchFaceId;
 
@@ -271,6 +336,14 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 private:
   static const unsigned int MAX_NUM_TIMEOUTS;
   static const uint32_t ERROR_FACE_NOT_FOUND;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const Name BATCH_UPDATE_COMMAND_PREFIX;
+
+  /** \brief maximum size of FibBatchUpdate in a command, leaving room in the packet
+   *         for the rest of the command name and the signature
+   */
+  static const size_t MAX_BATCH_UPDATE_SIZE;
 };
 
 } // namespace rib
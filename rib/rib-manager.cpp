@@ -83,7 +83,7 @@ RibManager::RibManager(ndn::Face& face, ndn::KeyChain& keyChain)
   , m_isLocalhopEnabled(false)
   , m_prefixPropagator(m_nfdController, m_keyChain, m_managedRib)
   , m_ribStatusPublisher(m_managedRib, face, LIST_COMMAND_PREFIX, m_keyChain)
-  , m_fibUpdater(m_managedRib, m_nfdController)
+  , m_fibUpdater(m_managedRib, m_nfdController, m_face, m_keyChain)
   , m_signedVerbDispatch(SIGNED_COMMAND_VERBS,
                          SIGNED_COMMAND_VERBS +
                          (sizeof(SIGNED_COMMAND_VERBS) / sizeof(SignedVerbAndProcessor)))
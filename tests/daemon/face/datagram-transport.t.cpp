@@ -26,12 +26,97 @@
 #include "unicast-udp-transport-fixture.hpp"
 #include "multicast-udp-transport-fixture.hpp"
 
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/datagram_protocol.hpp>
 #include <boost/mpl/vector.hpp>
 
 namespace nfd {
 namespace face {
+
+typedef boost::asio::local::datagram_protocol LocalDatagram;
+
+NFD_LOG_INCLASS_2TEMPLATE_SPECIALIZATION_DEFINE(DatagramTransport, LocalDatagram, Unicast,
+                                                "LocalDatagramTransport");
+
 namespace tests {
 
+/** \brief DatagramTransport over one end of a Unix datagram socket pair
+ *
+ *  Unlike UDP over loopback, a socket pair fills up its send buffer until the peer reads,
+ *  and reports a send error once the peer is closed, without any error on the receive side.
+ */
+class LocalDatagramTransport : public DatagramTransport<LocalDatagram>
+{
+public:
+  LocalDatagramTransport(protocol::socket&& socket, ndn::nfd::FacePersistency persistency,
+                         size_t batchSize)
+    : DatagramTransport(std::move(socket), batchSize)
+  {
+    this->setLocalUri(FaceUri("dummy://"));
+    this->setRemoteUri(FaceUri("dummy://"));
+    this->setScope(ndn::nfd::FACE_SCOPE_LOCAL);
+    this->setPersistency(persistency);
+    this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+    this->setMtu(MTU_UNLIMITED);
+  }
+
+protected:
+  virtual void
+  beforeChangePersistency(ndn::nfd::FacePersistency newPersistency) DECL_OVERRIDE
+  {
+  }
+};
+
+class LocalDatagramTransportFixture : public BaseFixture
+{
+protected:
+  LocalDatagramTransportFixture()
+    : transport(nullptr)
+    , remoteSocket(g_io)
+  {
+  }
+
+  void
+  initialize(ndn::nfd::FacePersistency persistency, size_t batchSize, int sendBufferSize = 0)
+  {
+    LocalDatagram::socket sock(g_io);
+    boost::asio::local::connect_pair(sock, remoteSocket);
+    if (sendBufferSize > 0) {
+      sock.set_option(boost::asio::socket_base::send_buffer_size(sendBufferSize));
+    }
+    remoteSocket.non_blocking(true);
+
+    face = make_unique<Face>(make_unique<DummyReceiveLinkService>(),
+                             make_unique<LocalDatagramTransport>(std::move(sock), persistency,
+                                                                 batchSize));
+    transport = static_cast<LocalDatagramTransport*>(face->getTransport());
+
+    BOOST_REQUIRE_EQUAL(transport->getState(), TransportState::UP);
+  }
+
+  /** \brief read the datagrams that are waiting on the remote socket, without blocking
+   */
+  void
+  remoteReadAvailable(std::vector<Block>& received)
+  {
+    std::vector<uint8_t> buf(ndn::MAX_NDN_PACKET_SIZE);
+    boost::system::error_code error;
+    size_t nBytes = 0;
+    while ((nBytes = remoteSocket.receive(boost::asio::buffer(buf), 0, error)) > 0 && !error) {
+      received.emplace_back(buf.data(), nBytes);
+    }
+    BOOST_REQUIRE_EQUAL(error, boost::asio::error::would_block);
+  }
+
+protected:
+  LimitedIo limitedIo;
+  LocalDatagramTransport* transport;
+  LocalDatagram::socket remoteSocket;
+
+private:
+  unique_ptr<Face> face;
+};
+
 BOOST_AUTO_TEST_SUITE(Face)
 BOOST_AUTO_TEST_SUITE(TestDatagramTransport)
 
@@ -151,6 +236,74 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Close, T, DatagramTransportFixtures, T)
   BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
 }
 
+BOOST_FIXTURE_TEST_SUITE(Batched, LocalDatagramTransportFixture)
+
+BOOST_AUTO_TEST_CASE(SendBufferFull)
+{
+  initialize(ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 8, 4096);
+
+  std::vector<Block> pkts;
+  std::vector<uint8_t> bytes(1000);
+  for (size_t i = 0; i < 64; ++i) {
+    bytes[0] = static_cast<uint8_t>(i);
+    pkts.push_back(ndn::encoding::makeBinaryBlock(300, bytes.data(), bytes.size()));
+    transport->send(Transport::Packet{Block{pkts.back()}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, pkts.size());
+
+  // the send buffer fills up before the queue is drained
+  g_io.poll();
+  std::vector<Block> received;
+  remoteReadAvailable(received);
+  BOOST_CHECK_GT(received.size(), 0);
+  BOOST_CHECK_LT(received.size(), pkts.size());
+
+  // the rest of the queue is sent as the remote end reads
+  for (int i = 0; i < 100 && received.size() < pkts.size(); ++i) {
+    limitedIo.defer(time::milliseconds(10));
+    remoteReadAvailable(received);
+  }
+
+  BOOST_REQUIRE_EQUAL(received.size(), pkts.size());
+  for (size_t i = 0; i < pkts.size(); ++i) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(received[i].begin(), received[i].end(),
+                                  pkts[i].begin(), pkts[i].end());
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
+BOOST_AUTO_TEST_CASE(SendErrorOnDemand)
+{
+  initialize(ndn::nfd::FACE_PERSISTENCY_ON_DEMAND, 8);
+
+  transport->afterStateChange.connectSingleShot([this] (TransportState oldState,
+                                                        TransportState newState) {
+    BOOST_CHECK_EQUAL(oldState, TransportState::UP);
+    BOOST_CHECK_EQUAL(newState, TransportState::FAILED);
+    limitedIo.afterOp();
+  });
+
+  // sending to a closed peer fails with ECONNREFUSED
+  remoteSocket.close();
+  transport->send(Transport::Packet{ndn::encoding::makeStringBlock(300, "hello")});
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+}
+
+BOOST_AUTO_TEST_CASE(SendErrorPermanent)
+{
+  initialize(ndn::nfd::FACE_PERSISTENCY_PERMANENT, 8);
+
+  remoteSocket.close();
+  transport->send(Transport::Packet{ndn::encoding::makeStringBlock(300, "hello")});
+  transport->send(Transport::Packet{ndn::encoding::makeStringBlock(301, "world")});
+  limitedIo.defer(time::milliseconds(100));
+
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, 2);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Batched
+
 BOOST_AUTO_TEST_SUITE_END() // TestDatagramTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
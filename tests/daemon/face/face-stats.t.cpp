@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/face-stats.hpp"
+
+#include "tests/test-common.hpp"
+#include "dummy-receive-link-service.hpp"
+#include "dummy-transport.hpp"
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+
+class FaceStatsFixture : public UnitTestTimeFixture
+{
+public:
+  FaceStatsFixture()
+    : face(make_unique<DummyReceiveLinkService>(), make_unique<DummyTransport>())
+    , transport(static_cast<DummyTransport*>(face.getTransport()))
+    , packet(makeInterest("/A")->wireEncode())
+  {
+    face.setId(1);
+  }
+
+  void
+  transfer(size_t nIn, size_t nOut)
+  {
+    for (size_t i = 0; i < nIn; ++i) {
+      transport->receivePacket(packet);
+    }
+    for (size_t i = 0; i < nOut; ++i) {
+      transport->send(Transport::Packet(Block(packet)));
+    }
+  }
+
+public:
+  nfd::Face face;
+  DummyTransport* transport;
+  Block packet;
+  FaceStats stats;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFaceStats, FaceStatsFixture)
+
+BOOST_AUTO_TEST_CASE(Rates)
+{
+  stats.addFace(face);
+  transfer(200, 100);
+  this->advanceClocks(time::milliseconds(100), time::seconds(2));
+
+  const FaceStats::Rates& rates = stats.getRates(face);
+  BOOST_CHECK_CLOSE(rates.nInPackets, 100.0, 0.1);
+  BOOST_CHECK_CLOSE(rates.nOutPackets, 50.0, 0.1);
+  BOOST_CHECK_CLOSE(rates.nInBytes, 100.0 * packet.size(), 0.1);
+  BOOST_CHECK_CLOSE(rates.nOutBytes, 50.0 * packet.size(), 0.1);
+
+  // within MIN_SAMPLE_INTERVAL, the previous rates are returned
+  transfer(1000, 1000);
+  this->advanceClocks(time::milliseconds(100), time::milliseconds(500));
+  BOOST_CHECK_CLOSE(stats.getRates(face).nInPackets, 100.0, 0.1);
+
+  this->advanceClocks(time::milliseconds(100), time::milliseconds(500));
+  BOOST_CHECK_CLOSE(stats.getRates(face).nInPackets, 1000.0, 0.1);
+  BOOST_CHECK_CLOSE(stats.getRates(face).nOutPackets, 1000.0, 0.1);
+
+  // no traffic
+  this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  BOOST_CHECK_EQUAL(stats.getRates(face).nInPackets, 0.0);
+  BOOST_CHECK_EQUAL(stats.getRates(face).nOutBytes, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownFace)
+{
+  transfer(50, 50);
+
+  // first sample of a face not seen by addFace only establishes a baseline
+  BOOST_CHECK_EQUAL(stats.getRates(face).nInPackets, 0.0);
+
+  transfer(50, 0);
+  this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  BOOST_CHECK_CLOSE(stats.getRates(face).nInPackets, 50.0, 0.1);
+  BOOST_CHECK_EQUAL(stats.getRates(face).nOutPackets, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveFace)
+{
+  stats.addFace(face);
+  transfer(100, 0);
+  this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  BOOST_CHECK_CLOSE(stats.getRates(face).nInPackets, 100.0, 0.1);
+
+  stats.removeFace(face.getId());
+  transfer(100, 0);
+  this->advanceClocks(time::milliseconds(100), time::seconds(1));
+  BOOST_CHECK_EQUAL(stats.getRates(face).nInPackets, 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFaceStats
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef NFD_TESTS_DAEMON_FACE_FIND_NETWORK_INTERFACE_HPP
+#define NFD_TESTS_DAEMON_FACE_FIND_NETWORK_INTERFACE_HPP
+
+#include "tests/limited-io.hpp"
+
+#include <ndn-cxx/util/network-monitor.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+/** \brief find the network interface that has \p address
+ *  \param monitor a network monitor; if it has not enumerated the interfaces yet,
+ *                 g_io is run until it does
+ *  \return the interface, or nullptr if no interface has \p address
+ */
+inline shared_ptr<ndn::util::NetworkInterface>
+findNetworkInterface(ndn::util::NetworkMonitor& monitor, const boost::asio::ip::address& address)
+{
+  if (monitor.listNetworkInterfaces().empty()) {
+    nfd::tests::LimitedIo limitedIo;
+    monitor.onEnumerationCompleted.connectSingleShot([&limitedIo] { limitedIo.afterOp(); });
+    limitedIo.run(1, time::seconds(5));
+  }
+
+  for (const shared_ptr<ndn::util::NetworkInterface>& netif : monitor.listNetworkInterfaces()) {
+    if (address.is_v4()) {
+      for (const auto& addr : netif->getIpv4Addresses()) {
+        if (addr == address.to_v4())
+          return netif;
+      }
+    }
+    else {
+      for (const auto& addr : netif->getIpv6Addresses()) {
+        if (addr == address.to_v6())
+          return netif;
+      }
+    }
+  }
+  return nullptr;
+}
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_TESTS_DAEMON_FACE_FIND_NETWORK_INTERFACE_HPP
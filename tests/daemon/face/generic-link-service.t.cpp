@@ -191,6 +191,22 @@ BOOST_AUTO_TEST_CASE(ReceiveBareData)
   BOOST_CHECK_EQUAL(receivedData.back(), *data1);
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveBareDataInPlace)
+{
+  // Initialize with Options that disables all services
+  GenericLinkService::Options options;
+  options.allowLocalFields = false;
+  initialize(options);
+
+  Block wire = makeData("/12345678")->wireEncode();
+
+  transport->receivePacket(wire);
+
+  BOOST_REQUIRE_EQUAL(receivedData.size(), 1);
+  // decoded Data references the received buffer, it is not copied
+  BOOST_CHECK(receivedData.back().wireEncode().getBuffer() == wire.getBuffer());
+}
+
 BOOST_AUTO_TEST_CASE(ReceiveData)
 {
   // Initialize with Options that disables all services
@@ -55,7 +55,7 @@ protected:
   }
 
   void
-  initialize(ip::address_v4 address)
+  initialize(ip::address_v4 address, size_t batchSize = 1)
   {
     openMulticastSockets(remoteSockRx, remoteSockTx, multicastEp.port());
 
@@ -66,7 +66,8 @@ protected:
 
     face = make_unique<Face>(
              make_unique<DummyReceiveLinkService>(),
-             make_unique<MulticastUdpTransport>(localEp, multicastEp, std::move(sockRx), std::move(sockTx)));
+             make_unique<MulticastUdpTransport>(localEp, multicastEp, std::move(sockRx), std::move(sockTx),
+                                                batchSize));
     transport = static_cast<MulticastUdpTransport*>(face->getTransport());
     receivedPackets = &static_cast<DummyReceiveLinkService*>(face->getLinkService())->receivedPackets;
 
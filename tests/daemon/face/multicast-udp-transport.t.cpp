@@ -101,6 +101,56 @@ BOOST_AUTO_TEST_CASE(ReceiveMultipleRemoteEndpoints)
                  receivedPackets->at(2).remoteEndpoint);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedReceive)
+{
+  SKIP_IF_IP_UNAVAILABLE(defaultAddr);
+  initialize(defaultAddr, 8);
+
+  // a burst longer than the batch is waiting when the socket becomes readable
+  udp::socket remoteSockTx2(g_io);
+  remoteSockTx2.open(udp::v4());
+  remoteSockTx2.set_option(udp::socket::reuse_address(true));
+  remoteSockTx2.set_option(ip::multicast::enable_loopback(true));
+  remoteSockTx2.bind(udp::endpoint(ip::address_v4::any(), 7071));
+
+  udp::endpoint destEp(multicastEp.address(), localEp.port());
+  std::vector<Block> pkts;
+  for (uint64_t i = 0; i < 20; ++i) {
+    pkts.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    remoteSockTx2.send_to(boost::asio::buffer(pkts.back().wire(), pkts.back().size()), destEp);
+  }
+  limitedIo.defer(time::milliseconds(200));
+
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, pkts.size());
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), pkts.size());
+  for (size_t i = 0; i < pkts.size(); ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == pkts[i]);
+    BOOST_CHECK_EQUAL(receivedPackets->at(i).remoteEndpoint, receivedPackets->at(0).remoteEndpoint);
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedSend)
+{
+  SKIP_IF_IP_UNAVAILABLE(defaultAddr);
+  initialize(defaultAddr, 8);
+
+  // packets sent during one turn of the event loop go out together to the multicast group
+  std::vector<Block> pkts;
+  for (uint64_t i = 0; i < 20; ++i) {
+    pkts.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    transport->send(Transport::Packet{Block{pkts.back()}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, pkts.size());
+
+  for (const Block& pkt : pkts) {
+    std::vector<uint8_t> readBuf(pkt.size());
+    remoteRead(readBuf);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), pkt.begin(), pkt.end());
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestMulticastUdpTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
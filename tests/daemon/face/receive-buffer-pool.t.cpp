@@ -0,0 +1,194 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/receive-buffer-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cstring>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestReceiveBufferPool, BaseFixture)
+
+/** \brief receives \p wire into pool as if read from a socket
+ */
+static void
+receive(ReceiveBufferPool& pool, const Block& wire, size_t nBytes)
+{
+  BOOST_REQUIRE_GE(pool.getWritableSize(), nBytes);
+  std::memcpy(pool.getWritePosition(), wire.wire(), nBytes);
+  pool.commit(nBytes);
+}
+
+BOOST_AUTO_TEST_CASE(ExtractBlocks)
+{
+  ReceiveBufferPool pool;
+  pool.prepare();
+  BOOST_CHECK_GE(pool.getWritableSize(), ndn::MAX_NDN_PACKET_SIZE);
+
+  Block interest = makeInterest("/A")->wireEncode();
+  Block data = makeData("/B")->wireEncode();
+  receive(pool, interest, interest.size());
+  receive(pool, data, 5); // incomplete
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), interest.size() + 5);
+
+  bool isOk = false;
+  Block element;
+  std::tie(isOk, element) = pool.extractBlock();
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK(element == interest);
+  std::tie(isOk, element) = pool.extractBlock();
+  BOOST_CHECK(!isOk);
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), 5);
+
+  std::memcpy(pool.getWritePosition(), data.wire() + 5, data.size() - 5);
+  pool.commit(data.size() - 5);
+  std::tie(isOk, element) = pool.extractBlock();
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK(element == data);
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), 0);
+
+  // received octets are referenced, not copied
+  BOOST_CHECK_EQUAL(pool.getNCopiedBytes(), 0);
+  BOOST_CHECK_EQUAL(pool.getNAllocatedSlabs(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Discard)
+{
+  ReceiveBufferPool pool;
+  pool.prepare();
+
+  Block interest = makeInterest("/A")->wireEncode();
+  receive(pool, interest, interest.size() - 1);
+  pool.discardPending();
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), 0);
+
+  receive(pool, interest, interest.size());
+  bool isOk = false;
+  Block element;
+  std::tie(isOk, element) = pool.extractBlock();
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK(element == interest);
+}
+
+BOOST_AUTO_TEST_CASE(SlabReuse)
+{
+  ReceiveBufferPool pool(ndn::MAX_NDN_PACKET_SIZE, 2);
+  Block interest = makeInterest("/A")->wireEncode();
+
+  pool.prepare();
+  receive(pool, interest, interest.size());
+  Block retained = std::get<1>(pool.extractBlock());
+  BOOST_CHECK_EQUAL(pool.getNAllocatedSlabs(), 1);
+
+  // the slab cannot hold a complete packet anymore, and is referenced by retained
+  pool.prepare();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedSlabs(), 2);
+  receive(pool, interest, interest.size());
+  BOOST_CHECK(std::get<0>(pool.extractBlock()));
+
+  // the second slab is no longer referenced by any Block
+  pool.prepare();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedSlabs(), 2);
+  BOOST_CHECK_EQUAL(pool.getNReusedSlabs(), 1);
+
+  // every slab is referenced, a new one is allocated in place of one of them
+  receive(pool, interest, interest.size());
+  Block retained2 = std::get<1>(pool.extractBlock());
+  pool.prepare();
+  BOOST_CHECK_EQUAL(pool.getNAllocatedSlabs(), 3);
+
+  // retained Blocks are still valid
+  BOOST_CHECK(retained == interest);
+  BOOST_CHECK(retained2 == interest);
+  BOOST_CHECK(retained.getBuffer() != retained2.getBuffer());
+}
+
+BOOST_AUTO_TEST_CASE(MovePending)
+{
+  ReceiveBufferPool pool(ndn::MAX_NDN_PACKET_SIZE, 2);
+  Block interest = makeInterest("/A")->wireEncode();
+
+  pool.prepare();
+  receive(pool, interest, interest.size());
+  receive(pool, interest, 3);
+  Block retained = std::get<1>(pool.extractBlock());
+
+  // the incomplete packet is moved to another slab, so that a complete packet would fit
+  pool.prepare();
+  BOOST_CHECK_EQUAL(pool.getNCopiedBytes(), 3);
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), 3);
+  BOOST_CHECK_EQUAL(pool.getWritableSize(), ndn::MAX_NDN_PACKET_SIZE - 3);
+
+  std::memcpy(pool.getWritePosition(), interest.wire() + 3, interest.size() - 3);
+  pool.commit(interest.size() - 3);
+  Block element = std::get<1>(pool.extractBlock());
+  BOOST_CHECK(element == interest);
+  BOOST_CHECK(element.getBuffer() != retained.getBuffer());
+}
+
+BOOST_AUTO_TEST_CASE(TooLarge)
+{
+  ReceiveBufferPool pool;
+  pool.prepare();
+
+  // the slab holds the whole element, which is larger than MAX_NDN_PACKET_SIZE
+  ndn::Buffer value(ndn::MAX_NDN_PACKET_SIZE);
+  Block large = ndn::encoding::makeBinaryBlock(tlv::Content, value.buf(), value.size());
+  BOOST_REQUIRE_GE(pool.getWritableSize(), large.size());
+  receive(pool, large, large.size());
+
+  bool isOk = true;
+  Block element;
+  std::tie(isOk, element) = pool.extractBlock();
+  BOOST_CHECK(!isOk);
+  BOOST_CHECK_EQUAL(pool.getPendingSize(), large.size());
+}
+
+BOOST_AUTO_TEST_CASE(Write)
+{
+  ReceiveBufferPool pool;
+  Block interest = makeInterest("/A")->wireEncode();
+
+  pool.prepare();
+  pool.write(interest.wire(), interest.size());
+  BOOST_CHECK_EQUAL(pool.getNCopiedBytes(), interest.size());
+
+  Block element = std::get<1>(pool.extractBlock());
+  BOOST_CHECK(element == interest);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestReceiveBufferPool
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -67,6 +67,71 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendGathered, T, StreamTransportFixtures, T)
+{
+  this->initialize();
+
+  // more packets than one gathered write can hold
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 100; ++i) {
+    auto block = ndn::encoding::makeStringBlock(300, "packet" + to_string(i));
+    expected.insert(expected.end(), block.begin(), block.end());
+    this->transport->send(Transport::Packet{std::move(block)});
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, 100);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueBytes, expected.size());
+
+  std::vector<uint8_t> readBuf(expected.size());
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  this->limitedIo.defer(time::milliseconds(100));
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueBytes, 0);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueDrops, 0);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueLimit, T, StreamTransportFixtures, T)
+{
+  this->initialize();
+
+  auto block = ndn::encoding::makeStringBlock(300, "hello");
+  this->transport->setSendQueueLimit(block.size() * 2);
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueLimit(), block.size() * 2);
+
+  for (int i = 0; i < 3; ++i) {
+    this->transport->send(Transport::Packet{Block{block}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, 3);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueBytes, block.size() * 2);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueDrops, 1);
+
+  std::vector<uint8_t> readBuf(block.size() * 2);
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  this->limitedIo.defer(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueBytes, 0);
+
+  // a packet larger than the limit is accepted when the queue is empty
+  std::vector<uint8_t> bytes(block.size() * 3, 0);
+  auto large = ndn::encoding::makeBinaryBlock(301, bytes.data(), bytes.size());
+  this->transport->send(Transport::Packet{Block{large}});
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueBytes, large.size());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nSendQueueDrops, 1);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   this->initialize();
@@ -24,8 +24,11 @@
  */
 
 #include "face/udp-channel.hpp"
+#include "face/face.hpp"
 
+#include "find-network-interface.hpp"
 #include "tests/test-common.hpp"
+#include "tests/limited-io.hpp"
 
 namespace nfd {
 namespace tests {
@@ -34,6 +37,56 @@ BOOST_AUTO_TEST_SUITE(Face)
 BOOST_FIXTURE_TEST_SUITE(TestUdpChannel, BaseFixture)
 
 using nfd::Face;
+namespace ip = boost::asio::ip;
+
+// the first datagram from a new peer is handed to the face by the channel, while the face
+// already waits for the next one on its own socket
+BOOST_AUTO_TEST_CASE(ReceiveOnNewFace)
+{
+  ndn::util::NetworkMonitor netmon(g_io);
+  shared_ptr<ndn::util::NetworkInterface> loopback =
+    nfd::face::tests::findNetworkInterface(netmon, ip::address_v4::loopback());
+  if (loopback == nullptr) {
+    BOOST_WARN_MESSAGE(false, "No loopback interface, cannot perform this test");
+    return;
+  }
+
+  LimitedIo limitedIo;
+  udp::Endpoint localEp(ip::address_v4::loopback(), 20070);
+  auto channel = make_shared<UdpChannel>(localEp, loopback, time::seconds(10));
+
+  std::vector<Interest> receivedInterests;
+  shared_ptr<Face> face;
+  channel->listen(
+    [&] (const shared_ptr<Face>& newFace) {
+      face = newFace;
+      face->afterReceiveInterest.connect([&] (const Interest& interest) {
+        receivedInterests.push_back(interest);
+        limitedIo.afterOp();
+      });
+    },
+    [] (const std::string& reason) { BOOST_FAIL(reason); });
+
+  ip::udp::socket remoteSocket(g_io, udp::Endpoint(ip::address_v4::loopback(), 0));
+  remoteSocket.connect(localEp);
+
+  Block interest1 = makeInterest("/udp-channel/1")->wireEncode();
+  Block interest2 = makeInterest("/udp-channel/2")->wireEncode();
+  remoteSocket.send(boost::asio::buffer(interest1.wire(), interest1.size()));
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE(face != nullptr);
+
+  remoteSocket.send(boost::asio::buffer(interest2.wire(), interest2.size()));
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+
+  BOOST_REQUIRE_EQUAL(receivedInterests.size(), 2);
+  BOOST_CHECK_EQUAL(receivedInterests[0].getName(), "/udp-channel/1");
+  BOOST_CHECK_EQUAL(receivedInterests[1].getName(), "/udp-channel/2");
+  BOOST_CHECK_EQUAL(channel->size(), 1);
+
+  face->close();
+  limitedIo.defer(time::milliseconds(100));
+}
 
 // TODO add the equivalent of these test cases from udp.t.cpp as of commit:65caf200924b28748037750449e28bcb548dbc9c
 // MultipleAccepts
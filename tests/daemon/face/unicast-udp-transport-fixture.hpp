@@ -30,6 +30,7 @@
 #include "face/face.hpp"
 
 #include "dummy-receive-link-service.hpp"
+#include "find-network-interface.hpp"
 #include "tests/limited-io.hpp"
 
 namespace nfd {
@@ -53,8 +54,13 @@ protected:
 
   void
   initialize(ip::address address = ip::address_v4::loopback(),
-             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT)
+             ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+             size_t batchSize = 1)
   {
+    netmon = make_unique<ndn::util::NetworkMonitor>(g_io);
+    shared_ptr<ndn::util::NetworkInterface> netif = findNetworkInterface(*netmon, address);
+    BOOST_REQUIRE_MESSAGE(netif != nullptr, "no network interface has " << address);
+
     udp::socket sock(g_io);
     sock.connect(udp::endpoint(address, 7070));
     localEp = sock.local_endpoint();
@@ -63,7 +69,8 @@ protected:
 
     face = make_unique<Face>(
              make_unique<DummyReceiveLinkService>(),
-             make_unique<UnicastUdpTransport>(std::move(sock), persistency, time::seconds(3)));
+             make_unique<UnicastUdpTransport>(std::move(sock), persistency, time::seconds(3),
+                                              netif, batchSize));
     transport = static_cast<UnicastUdpTransport*>(face->getTransport());
     receivedPackets = &static_cast<DummyReceiveLinkService*>(face->getLinkService())->receivedPackets;
 
@@ -114,6 +121,7 @@ protected:
   std::vector<Transport::Packet>* receivedPackets;
 
 private:
+  unique_ptr<ndn::util::NetworkMonitor> netmon;
   unique_ptr<Face> face;
 };
 
@@ -205,6 +205,46 @@ BOOST_AUTO_TEST_CASE(ChangePersistencyNoExpirationTime)
   BOOST_CHECK_EQUAL(transport->getExpirationTime(), time::steady_clock::TimePoint::max());
 }
 
+BOOST_AUTO_TEST_CASE(BatchedReceive)
+{
+  initialize(ip::address_v4::loopback(), ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 8);
+
+  // a burst longer than the batch is waiting when the socket becomes readable
+  std::vector<Block> pkts;
+  for (uint64_t i = 0; i < 20; ++i) {
+    pkts.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    remoteSocket.send(boost::asio::buffer(pkts.back().wire(), pkts.back().size()));
+  }
+  limitedIo.defer(time::milliseconds(200));
+
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, pkts.size());
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), pkts.size());
+  for (size_t i = 0; i < pkts.size(); ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == pkts[i]);
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedSend)
+{
+  initialize(ip::address_v4::loopback(), ndn::nfd::FACE_PERSISTENCY_PERSISTENT, 8);
+
+  // packets sent during one turn of the event loop go out together
+  std::vector<Block> pkts;
+  for (uint64_t i = 0; i < 20; ++i) {
+    pkts.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    transport->send(Transport::Packet{Block{pkts.back()}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nOutPackets, pkts.size());
+
+  for (const Block& pkt : pkts) {
+    std::vector<uint8_t> readBuf(pkt.size());
+    remoteRead(readBuf);
+    BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), pkt.begin(), pkt.end());
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnicastUdpTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/congestion-window.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestCongestionWindow, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(SlowStart)
+{
+  CongestionWindow window;
+  BOOST_CHECK_EQUAL(window.getSize(), 4.0);
+  BOOST_CHECK_EQUAL(window.canSend(3), true);
+  BOOST_CHECK_EQUAL(window.canSend(4), false);
+
+  // one Interest per Data, doubling the window every round trip
+  for (int i = 0; i < 4; ++i) {
+    window.increase();
+  }
+  BOOST_CHECK_EQUAL(window.getSize(), 8.0);
+  BOOST_CHECK_EQUAL(window.canSend(7), true);
+  BOOST_CHECK_EQUAL(window.canSend(8), false);
+}
+
+BOOST_AUTO_TEST_CASE(CongestionAvoidance)
+{
+  CongestionWindow window;
+  for (int i = 0; i < 12; ++i) {
+    window.increase();
+  }
+  BOOST_CHECK_EQUAL(window.getSize(), 16.0);
+
+  time::steady_clock::TimePoint sendTime = time::steady_clock::now();
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(window.decrease(sendTime), true);
+  BOOST_CHECK_EQUAL(window.getSize(), 8.0);
+  BOOST_CHECK_EQUAL(window.getSlowStartThreshold(), 8.0);
+
+  // about one Interest per round trip
+  for (int i = 0; i < 8; ++i) {
+    window.increase();
+  }
+  BOOST_CHECK_GT(window.getSize(), 8.9);
+  BOOST_CHECK_LT(window.getSize(), 9.0);
+  window.increase();
+  BOOST_CHECK_GT(window.getSize(), 9.0);
+  BOOST_CHECK_LT(window.getSize(), 9.2);
+}
+
+BOOST_AUTO_TEST_CASE(DecreaseOncePerRound)
+{
+  CongestionWindow window;
+  for (int i = 0; i < 12; ++i) {
+    window.increase();
+  }
+
+  time::steady_clock::TimePoint sendTime = time::steady_clock::now();
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(window.decrease(sendTime), true);
+  BOOST_CHECK_EQUAL(window.getSize(), 8.0);
+
+  // other losses of the same round trip belong to the same congestion event
+  this->advanceClocks(time::milliseconds(10));
+  BOOST_CHECK_EQUAL(window.decrease(sendTime), false);
+  BOOST_CHECK_EQUAL(window.decrease(sendTime + time::milliseconds(50)), false);
+  BOOST_CHECK_EQUAL(window.getSize(), 8.0);
+
+  // an Interest sent after the decrease is a new congestion event
+  sendTime = time::steady_clock::now();
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(window.decrease(sendTime), true);
+  BOOST_CHECK_EQUAL(window.getSize(), 4.0);
+}
+
+BOOST_AUTO_TEST_CASE(Bounds)
+{
+  CongestionWindow::Options options;
+  options.initialWindow = 2.0;
+  options.maxWindow = 3.0;
+  CongestionWindow window(options);
+
+  for (int i = 0; i < 5; ++i) {
+    window.increase();
+  }
+  BOOST_CHECK_EQUAL(window.getSize(), 3.0);
+
+  for (int i = 0; i < 5; ++i) {
+    time::steady_clock::TimePoint sendTime = time::steady_clock::now();
+    this->advanceClocks(time::milliseconds(100));
+    window.decrease(sendTime);
+  }
+  BOOST_CHECK_EQUAL(window.getSize(), 1.0);
+  BOOST_CHECK_EQUAL(window.canSend(0), true);
+  BOOST_CHECK_EQUAL(window.canSend(1), false);
+
+  window.reset();
+  BOOST_CHECK_EQUAL(window.getSize(), 2.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCongestionWindow
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
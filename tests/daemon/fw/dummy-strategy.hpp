@@ -92,6 +92,12 @@ public:
     ++afterReceiveNack_count;
   }
 
+  virtual std::vector<CongestionStatus>
+  getCongestionStatus() const DECL_OVERRIDE
+  {
+    return congestionStatus;
+  }
+
 public:
   int afterReceiveInterest_count;
   bool wantAfterReceiveInterestCalls;
@@ -103,6 +109,7 @@ public:
   int beforeExpirePendingInterest_count;
   int afterReceiveNack_count;
 
+  std::vector<CongestionStatus> congestionStatus;
 };
 
 } // namespace tests
@@ -89,6 +89,40 @@ BOOST_AUTO_TEST_CASE(AddReserved)
   BOOST_CHECK_EQUAL(face1->getId(), 5);
 }
 
+BOOST_AUTO_TEST_CASE(StaleFaceId)
+{
+  Forwarder forwarder;
+  FaceTable& faceTable = forwarder.getFaceTable();
+
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+  faceTable.add(face1);
+  faceTable.add(face2);
+  FaceId id1 = face1->getId();
+  FaceId id2 = face2->getId();
+  BOOST_CHECK_EQUAL(faceTable.get(id1), face1);
+  BOOST_CHECK_EQUAL(faceTable.get(id2), face2);
+
+  face1->close();
+  BOOST_CHECK(faceTable.get(id1) == nullptr);
+
+  // FaceId is not reused, although the storage of face1 is
+  shared_ptr<Face> face3 = make_shared<DummyFace>();
+  faceTable.add(face3);
+  FaceId id3 = face3->getId();
+  BOOST_CHECK_NE(id3, id1);
+  BOOST_CHECK_NE(id3, id2);
+  BOOST_CHECK_EQUAL(id3, id2 + 1);
+  BOOST_CHECK(faceTable.get(id1) == nullptr);
+  BOOST_CHECK_EQUAL(faceTable.get(id3), face3);
+  BOOST_CHECK_EQUAL(faceTable.get(id2), face2);
+  BOOST_CHECK_EQUAL(faceTable.size(), 2);
+
+  BOOST_CHECK(faceTable.get(face::INVALID_FACEID) == nullptr);
+  BOOST_CHECK(faceTable.get(id3 + 1000) == nullptr);
+  BOOST_CHECK(faceTable.get(std::numeric_limits<FaceId>::max()) == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(Enumerate)
 {
   Forwarder forwarder;
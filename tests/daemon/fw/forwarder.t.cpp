@@ -675,11 +675,69 @@ BOOST_FIXTURE_TEST_CASE(InterestLoopWithShortLifetime, UnitTestTimeFixture) // B
   // an Interest if its Name+Nonce has appeared any point in the past.
 }
 
+BOOST_AUTO_TEST_CASE(InterestOverQuota)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>("dummy://", "dummy://",
+                                      ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                      ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                      ndn::nfd::LINK_TYPE_MULTI_ACCESS);
+  auto face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Fib& fib = forwarder.getFib();
+  shared_ptr<fib::Entry> fibEntry = fib.insert(Name("/LkJ5ydGJ")).first;
+  fibEntry->addNextHop(face3, 0);
+
+  Pit& pit = forwarder.getPit();
+  PitQuota& quota = pit.getQuota();
+  quota.setCapacity(1);
+
+  shared_ptr<Interest> interest1 = makeInterest("/LkJ5ydGJ/1", 5311);
+  face1->receiveInterest(*interest1);
+  BOOST_CHECK(face1->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.size(), 1);
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(face1->getId()), 1);
+
+  // PIT is full, new Interest is Nacked
+  shared_ptr<Interest> interest2 = makeInterest("/LkJ5ydGJ/2", 3079);
+  face1->receiveInterest(*interest2);
+  BOOST_REQUIRE_EQUAL(face1->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getInterest(), *interest2);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getReason(), lp::NackReason::CONGESTION);
+  BOOST_CHECK_EQUAL(pit.size(), 1);
+  BOOST_CHECK_EQUAL(quota.getCounters().nCapacityRejects, 1);
+  BOOST_REQUIRE(quota.getFaceCounters(face1->getId()) != nullptr);
+  BOOST_CHECK_EQUAL(quota.getFaceCounters(face1->getId())->nCapacityRejects, 1);
+
+  // Interest that matches an existing PIT entry is admitted
+  face1->sentNacks.clear();
+  shared_ptr<Interest> interest1b = makeInterest("/LkJ5ydGJ/1", 4107);
+  face1->receiveInterest(*interest1b);
+  BOOST_CHECK(face1->sentNacks.empty());
+  BOOST_CHECK_EQUAL(quota.getCounters().nCapacityRejects, 1);
+
+  // don't send Nack to multi-access face
+  shared_ptr<Interest> interest3 = makeInterest("/LkJ5ydGJ/3", 9527);
+  face2->receiveInterest(*interest3);
+  BOOST_CHECK(face2->sentNacks.empty());
+  BOOST_CHECK_EQUAL(quota.getCounters().nCapacityRejects, 2);
+
+  // counters of a removed face are forgotten
+  FaceId faceId1 = face1->getId();
+  face1->close();
+  BOOST_CHECK(quota.getFaceCounters(faceId1) == nullptr);
+  BOOST_CHECK_EQUAL(quota.getCounters().nCapacityRejects, 2);
+}
+
 BOOST_AUTO_TEST_CASE(LinkDelegation)
 {
   Forwarder forwarder;
   shared_ptr<Face> face1 = make_shared<DummyFace>();
-  shared_ptr<Face> face2 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
   forwarder.addFace(face1);
   forwarder.addFace(face2);
 
@@ -715,6 +773,9 @@ BOOST_AUTO_TEST_CASE(LinkDelegation)
   forwarder.onContentStoreMiss(*face1, pit1, *interest1);
   BOOST_CHECK_EQUAL(getLastFibPrefix(), "/");
   BOOST_CHECK_EQUAL(interest1->hasSelectedDelegation(), false);
+  forwarder.onOutgoingInterest(pit1, *face2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face2->sentInterests.back().hasSelectedDelegation(), false);
 
   fibRoot->removeNextHop(face2);
 
@@ -735,6 +796,11 @@ BOOST_AUTO_TEST_CASE(LinkDelegation)
   BOOST_CHECK_EQUAL(getLastFibPrefix(), "/telia");
   BOOST_REQUIRE_EQUAL(interest2->hasSelectedDelegation(), true);
   BOOST_CHECK_EQUAL(interest2->getSelectedDelegation(), "/telia/terabits");
+  // the Interest sent upstream carries the SelectedDelegation
+  forwarder.onOutgoingInterest(pit2, *face2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.back().hasSelectedDelegation(), true);
+  BOOST_CHECK_EQUAL(face2->sentInterests.back().getSelectedDelegation(), "/telia/terabits");
 
   fib.erase(*fibTelia);
   fib.erase(*fibUcla);
@@ -754,6 +820,11 @@ BOOST_AUTO_TEST_CASE(LinkDelegation)
   BOOST_CHECK_EQUAL(getLastFibPrefix(), "/ucla");
   BOOST_REQUIRE_EQUAL(interest3->hasSelectedDelegation(), true);
   BOOST_CHECK_EQUAL(interest3->getSelectedDelegation(), "/ucla/cs");
+  forwarder.onOutgoingInterest(pit3, *face2, true);
+  BOOST_CHECK_EQUAL(pit3->getInRecords().front().getInterest().getNonce(), interest3->getNonce());
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 3);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.back().hasSelectedDelegation(), true);
+  BOOST_CHECK_EQUAL(face2->sentInterests.back().getSelectedDelegation(), "/ucla/cs");
 
   fib.erase(*fibUcla);
 
@@ -775,6 +846,10 @@ BOOST_AUTO_TEST_CASE(LinkDelegation)
   BOOST_CHECK_EQUAL(getLastFibPrefix(), "/ucla");
   BOOST_REQUIRE_EQUAL(interest4->hasSelectedDelegation(), true);
   BOOST_CHECK_EQUAL(interest4->getSelectedDelegation(), "/ucla/cs");
+  forwarder.onOutgoingInterest(pit4, *face2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 4);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.back().hasSelectedDelegation(), true);
+  BOOST_CHECK_EQUAL(face2->sentInterests.back().getSelectedDelegation(), "/ucla/cs");
 
   fib.erase(*fibTelia);
   fib.erase(*fibUcla);
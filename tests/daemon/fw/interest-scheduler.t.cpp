@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/interest-scheduler.hpp"
+#include "fw/forwarder.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+class InterestSchedulerFixture : public UnitTestTimeFixture
+{
+protected:
+  InterestSchedulerFixture()
+    : scheduler(bind(&InterestSchedulerFixture::sendInterest, this, _1, _2))
+    , downstream(make_shared<DummyFace>())
+    , upstream(make_shared<DummyFace>())
+  {
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream);
+  }
+
+  void
+  sendInterest(const shared_ptr<pit::Entry>& pitEntry, const shared_ptr<Face>& outFace)
+  {
+    BOOST_CHECK_EQUAL(outFace, upstream);
+    sentNames.push_back(pitEntry->getName());
+  }
+
+  shared_ptr<pit::Entry>
+  insertPitEntry(const Name& name, time::milliseconds lifetime = time::seconds(4))
+  {
+    shared_ptr<Interest> interest = makeInterest(name);
+    interest->setInterestLifetime(lifetime);
+    shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(downstream, *interest);
+    return pitEntry;
+  }
+
+protected:
+  Forwarder forwarder;
+  InterestScheduler scheduler;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream;
+  std::vector<Name> sentNames;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestInterestScheduler, InterestSchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(Unlimited)
+{
+  for (int i = 0; i < 100; ++i) {
+    scheduler.schedule(insertPitEntry(Name("/A").appendNumber(i)), upstream, time::milliseconds(10));
+  }
+  BOOST_CHECK_EQUAL(sentNames.size(), 100);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(upstream->getId()), 0);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nSent, 100);
+
+  // without a rate limit, the deadline is not checked
+  scheduler.schedule(insertPitEntry("/B", time::milliseconds(100)), upstream, time::milliseconds(200));
+  BOOST_CHECK_EQUAL(sentNames.size(), 101);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nDeadlineMissed, 0);
+}
+
+BOOST_AUTO_TEST_CASE(PriorityClass)
+{
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/vehicle/control/brake"),
+                    InterestScheduler::DEFAULT_PRIORITY_CLASS);
+
+  scheduler.setPriorityClass("/vehicle", 2);
+  scheduler.setPriorityClass("/vehicle/control", 0);
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/vehicle/control/brake"), 0);
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/vehicle/control"), 0);
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/vehicle/video/1"), 2);
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/other"), InterestScheduler::DEFAULT_PRIORITY_CLASS);
+
+  scheduler.setPriorityClass("/", 3);
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/other"), 3);
+
+  scheduler.clearPriorityClasses();
+  BOOST_CHECK_EQUAL(scheduler.getPriorityClass("/vehicle/control/brake"),
+                    InterestScheduler::DEFAULT_PRIORITY_CLASS);
+}
+
+BOOST_AUTO_TEST_CASE(Order)
+{
+  scheduler.setRate(10);
+  scheduler.setPriorityClass("/bulk", 2);
+  scheduler.setPriorityClass("/control", 0);
+
+  // the token is taken by the first Interest, others are queued
+  scheduler.schedule(insertPitEntry("/bulk/0"), upstream, time::milliseconds(10));
+  scheduler.schedule(insertPitEntry("/bulk/1", time::seconds(4)), upstream, time::milliseconds(10));
+  scheduler.schedule(insertPitEntry("/bulk/2", time::seconds(2)), upstream, time::milliseconds(10));
+  scheduler.schedule(insertPitEntry("/other"), upstream, time::milliseconds(10));
+  scheduler.schedule(insertPitEntry("/control"), upstream, time::milliseconds(10));
+  BOOST_CHECK_EQUAL(sentNames.size(), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(upstream->getId()), 4);
+
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(50));
+  BOOST_CHECK_EQUAL(sentNames.size(), 1);
+
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(400));
+  std::vector<Name> expected{"/bulk/0", "/control", "/other", "/bulk/2", "/bulk/1"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(sentNames.begin(), sentNames.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(upstream->getId()), 0);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nSent, 5);
+}
+
+BOOST_AUTO_TEST_CASE(Burst)
+{
+  scheduler.setRate(10, 3);
+  for (int i = 0; i < 5; ++i) {
+    scheduler.schedule(insertPitEntry(Name("/A").appendNumber(i)), upstream, time::milliseconds(10));
+  }
+  BOOST_CHECK_EQUAL(sentNames.size(), 3);
+
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(200));
+  BOOST_CHECK_EQUAL(sentNames.size(), 5);
+
+  // tokens are refilled up to burst
+  this->advanceClocks(time::milliseconds(10), time::seconds(1));
+  for (int i = 5; i < 10; ++i) {
+    scheduler.schedule(insertPitEntry(Name("/A").appendNumber(i)), upstream, time::milliseconds(10));
+  }
+  BOOST_CHECK_EQUAL(sentNames.size(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(DeadlineMissed)
+{
+  scheduler.setRate(1);
+
+  // cannot be satisfied even if sent now
+  scheduler.schedule(insertPitEntry("/A/0", time::milliseconds(100)), upstream, time::milliseconds(200));
+  BOOST_CHECK_EQUAL(sentNames.size(), 0);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nDeadlineMissed, 1);
+
+  scheduler.setPriorityClass("/A/3", 2);
+  scheduler.schedule(insertPitEntry("/A/1"), upstream, time::milliseconds(200));
+  scheduler.schedule(insertPitEntry("/A/2"), upstream, time::milliseconds(200));
+  // its turn comes after 3 seconds, which is too late
+  scheduler.schedule(insertPitEntry("/A/3", time::milliseconds(2100)), upstream, time::milliseconds(200));
+  scheduler.schedule(insertPitEntry("/A/4"), upstream, time::milliseconds(200));
+  BOOST_CHECK_EQUAL(sentNames.size(), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(), 3);
+
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(3500));
+  std::vector<Name> expected{"/A/1", "/A/2", "/A/4"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(sentNames.begin(), sentNames.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nDeadlineMissed, 2);
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nSent, 3);
+}
+
+BOOST_AUTO_TEST_CASE(SatisfiedWhileQueued)
+{
+  scheduler.setRate(10);
+  scheduler.schedule(insertPitEntry("/A/0"), upstream, time::milliseconds(10));
+  shared_ptr<pit::Entry> pitEntry = insertPitEntry("/A/1");
+  scheduler.schedule(pitEntry, upstream, time::milliseconds(10));
+  scheduler.schedule(insertPitEntry("/A/2"), upstream, time::milliseconds(10));
+
+  pitEntry->deleteInRecords();
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(500));
+  std::vector<Name> expected{"/A/0", "/A/2"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(sentNames.begin(), sentNames.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(scheduler.getCounters().nDeadlineMissed, 0);
+}
+
+BOOST_AUTO_TEST_CASE(SetRate)
+{
+  BOOST_CHECK_THROW(scheduler.setRate(-1), InterestScheduler::Error);
+  BOOST_CHECK_THROW(scheduler.setRate(10, 0), InterestScheduler::Error);
+
+  scheduler.setRate(1);
+  for (int i = 0; i < 5; ++i) {
+    scheduler.schedule(insertPitEntry(Name("/A").appendNumber(i)), upstream, time::milliseconds(10));
+  }
+  BOOST_CHECK_EQUAL(sentNames.size(), 1);
+
+  // queued Interests are sent when the rate becomes unlimited
+  scheduler.setRate(0);
+  BOOST_CHECK_EQUAL(sentNames.size(), 5);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(upstream->getId()), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RemoveFace)
+{
+  scheduler.setRate(1);
+  for (int i = 0; i < 5; ++i) {
+    scheduler.schedule(insertPitEntry(Name("/A").appendNumber(i)), upstream, time::milliseconds(10));
+  }
+  scheduler.removeFace(upstream->getId());
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(upstream->getId()), 0);
+
+  this->advanceClocks(time::milliseconds(100), time::seconds(5));
+  BOOST_CHECK_EQUAL(sentNames.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestScheduler
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/interface-weights.hpp"
+#include "fw/forwarder.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestInterfaceWeights, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(GetSet)
+{
+  InterfaceWeights weights({{"eth0", 2}, {"wlan0", 1}});
+  BOOST_CHECK_EQUAL(weights.get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights.get("wlan0"), 1);
+  BOOST_CHECK_EQUAL(weights.get("wwan0"), 0);
+
+  weights.set("wwan0", 3);
+  BOOST_CHECK_EQUAL(weights.get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights.get("wwan0"), 3);
+
+  weights.assign({{"wlan0", 5}});
+  BOOST_CHECK_EQUAL(weights.get("eth0"), 0);
+  BOOST_CHECK_EQUAL(weights.get("wlan0"), 5);
+  BOOST_CHECK_EQUAL(weights.getWeights().size(), 1);
+
+  weights.reset();
+  BOOST_CHECK_EQUAL(weights.get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights.get("wlan0"), 1);
+
+  weights.setDefaults({{"wwan0", 1}});
+  BOOST_CHECK_EQUAL(weights.get("eth0"), 0);
+  weights.set("wwan0", 3);
+  weights.reset();
+  BOOST_CHECK_EQUAL(weights.get("wwan0"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FaceWeight)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  BOOST_REQUIRE_NE(face1->getId(), face2->getId());
+
+  std::string interfaceName = face1->getInterfaceName();
+  InterfaceWeights weights({{interfaceName, 1}});
+  BOOST_CHECK_EQUAL(weights.getFaceWeight(*face1), 1);
+  BOOST_CHECK_EQUAL(weights.getFaceWeight(*face2), 1);
+
+  // cached weights are invalidated on update
+  weights.set(interfaceName, 4);
+  BOOST_CHECK_EQUAL(weights.getFaceWeight(*face1), 4);
+  weights.assign({});
+  BOOST_CHECK_EQUAL(weights.getFaceWeight(*face2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FaceWeightChurn)
+{
+  Forwarder forwarder;
+  InterfaceWeights weights({{make_shared<DummyFace>()->getInterfaceName(), 2}});
+
+  // faces created after others are removed, so that FaceTable storage is reused
+  for (int i = 0; i < 100; ++i) {
+    auto face = make_shared<DummyFace>();
+    forwarder.addFace(face);
+    BOOST_CHECK_EQUAL(weights.getFaceWeight(*face), 2);
+    weights.removeFace(face->getId());
+    face->close();
+  }
+
+  auto face = make_shared<DummyFace>();
+  face->setId(std::numeric_limits<FaceId>::max() - 1);
+  weights.assign({{face->getInterfaceName(), 3}});
+  BOOST_CHECK_EQUAL(weights.getFaceWeight(*face), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Parse)
+{
+  InterfaceWeights::WeightMap weights = InterfaceWeights::parse("eth0=2, wlan0 = 1,,wwan0=-1");
+  BOOST_CHECK_EQUAL(weights.size(), 3);
+  BOOST_CHECK_EQUAL(weights["eth0"], 2);
+  BOOST_CHECK_EQUAL(weights["wlan0"], 1);
+  BOOST_CHECK_EQUAL(weights["wwan0"], -1);
+
+  BOOST_CHECK_EQUAL(InterfaceWeights::parse("").size(), 0);
+
+  BOOST_CHECK_THROW(InterfaceWeights::parse("eth0"), InterfaceWeights::Error);
+  BOOST_CHECK_THROW(InterfaceWeights::parse("=1"), InterfaceWeights::Error);
+  BOOST_CHECK_THROW(InterfaceWeights::parse("eth0=high"), InterfaceWeights::Error);
+  BOOST_CHECK_THROW(InterfaceWeights::parse("eth0=1,wlan0="), InterfaceWeights::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterfaceWeights
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
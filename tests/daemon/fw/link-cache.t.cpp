@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/link-cache.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestLinkCache, BaseFixture)
+
+class LinkCacheFixture : public BaseFixture
+{
+public:
+  LinkCacheFixture()
+    : fib(nameTree)
+    , cache(fib, nrt)
+    , face(make_shared<DummyFace>())
+    , link(makeLink("/net/ndnsim", {{10, "/telia/terabits"}, {20, "/ucla/cs"}}))
+  {
+  }
+
+public:
+  NameTree nameTree;
+  Fib fib;
+  NetworkRegionTable nrt;
+  LinkCache cache;
+  shared_ptr<Face> face;
+  shared_ptr<Link> link;
+};
+
+BOOST_FIXTURE_TEST_CASE(ProducerRegion, LinkCacheFixture)
+{
+  nrt.insert("/ucla/cs/irl");
+
+  const LinkCache::Result& res = cache.evaluate(*link);
+  BOOST_CHECK_EQUAL(res.isInProducerRegion, true);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(DefaultFreeZone, LinkCacheFixture)
+{
+  fib.insert("/ucla").first->addNextHop(face, 10);
+
+  const LinkCache::Result& res1 = cache.evaluate(*link);
+  BOOST_CHECK_EQUAL(res1.isInProducerRegion, false);
+  BOOST_CHECK_EQUAL(res1.fibEntry->getPrefix(), "/ucla");
+  BOOST_CHECK_EQUAL(res1.selectedDelegation, "/ucla/cs");
+
+  // same Link, possibly decoded from another Interest, hits the cache
+  Link link2(link->wireEncode());
+  const LinkCache::Result& res2 = cache.evaluate(link2);
+  BOOST_CHECK_EQUAL(&res2, &res1);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ConsumerRegion, LinkCacheFixture)
+{
+  fib.insert("/").first->addNextHop(face, 10);
+
+  const LinkCache::Result& res = cache.evaluate(*link);
+  BOOST_CHECK_EQUAL(res.isInProducerRegion, false);
+  BOOST_CHECK_EQUAL(res.fibEntry->getPrefix(), "/");
+  BOOST_CHECK(res.selectedDelegation.empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(FibChange, LinkCacheFixture)
+{
+  shared_ptr<fib::Entry> fibTelia = fib.insert("/telia").first;
+  fibTelia->addNextHop(face, 10);
+  fib.insert("/ucla").first->addNextHop(face, 10);
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).selectedDelegation, "/telia/terabits");
+
+  // cost change does not flush the cache
+  fibTelia->addNextHop(face, 20);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).selectedDelegation, "/telia/terabits");
+
+  fibTelia->removeNextHop(face);
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).selectedDelegation, "/ucla/cs");
+
+  fib.erase("/telia");
+  fib.removeNextHopFromAllEntries(face);
+  const LinkCache::Result& res = cache.evaluate(*link);
+  BOOST_CHECK(res.selectedDelegation.empty());
+  BOOST_CHECK_EQUAL(res.fibEntry->hasNextHops(), false);
+}
+
+BOOST_FIXTURE_TEST_CASE(NetworkRegionTableChange, LinkCacheFixture)
+{
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).isInProducerRegion, false);
+
+  nrt.insert("/telia/terabits");
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).isInProducerRegion, true);
+
+  nrt.clear();
+  BOOST_CHECK_EQUAL(cache.evaluate(*link).isInProducerRegion, false);
+}
+
+BOOST_FIXTURE_TEST_CASE(Capacity, LinkCacheFixture)
+{
+  LinkCache smallCache(fib, nrt, 2);
+  for (int i = 0; i < 5; ++i) {
+    shared_ptr<Link> linkI = makeLink(Name("/net/ndnsim").appendNumber(i), {{10, "/ucla/cs"}});
+    smallCache.evaluate(*linkI);
+    BOOST_CHECK_LE(smallCache.size(), 2);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLinkCache
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace nfd
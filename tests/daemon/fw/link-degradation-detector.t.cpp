@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/link-degradation-detector.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestLinkDegradationDetector, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(ConsecutiveTimeouts)
+{
+  LinkDegradationDetector detector;
+  for (int i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(detector.afterSendInterest(false), false);
+    this->advanceClocks(time::milliseconds(20));
+    BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(20), false), false);
+  }
+
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), false);
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), false);
+  // any Data restarts the count
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(20), true), false);
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), false);
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+
+  time::steady_clock::TimePoint lastData = time::steady_clock::now();
+  this->advanceClocks(time::milliseconds(100));
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), true);
+  BOOST_CHECK_EQUAL(detector.getReason(), LinkDegradationDetector::CONSECUTIVE_TIMEOUTS);
+  BOOST_CHECK(detector.getLastDataTime() == lastData);
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(true), false);
+
+  // a Data of a retransmitted Interest is not a valid RTT sample, so the link stays degraded
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(20), true), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), true);
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(25), false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+}
+
+BOOST_AUTO_TEST_CASE(RttInflation)
+{
+  LinkDegradationDetector detector;
+  for (int i = 0; i < 10; ++i) {
+    detector.afterSendInterest(false);
+    BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(20), false), false);
+  }
+
+  // 60ms is 3 times the minimum, but within 50ms of it
+  for (int i = 0; i < 10; ++i) {
+    detector.afterSendInterest(false);
+    BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(60), false), false);
+  }
+
+  // smoothed RTT reaches 0.75 * 60 + 0.25 * 400 = 145ms
+  detector.afterSendInterest(false);
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(400), false), true);
+  BOOST_CHECK_EQUAL(detector.getReason(), LinkDegradationDetector::RTT_INFLATION);
+
+  detector.afterSendInterest(false);
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(300), false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), true);
+
+  detector.afterSendInterest(false);
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(30), false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+
+  // smoothing restarts from the healthy sample
+  detector.afterSendInterest(false);
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(30), false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+}
+
+BOOST_AUTO_TEST_CASE(DeliveryRateDrop)
+{
+  LinkDegradationDetector detector;
+
+  // 10 Data per 250ms rate interval
+  for (int i = 0; i < 100; ++i) {
+    detector.afterSendInterest(false);
+    detector.afterReceiveData(time::milliseconds(20), false);
+    this->advanceClocks(time::milliseconds(25));
+  }
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+
+  // consumer goes idle: no demand is not a drop
+  this->advanceClocks(time::milliseconds(100), time::seconds(5));
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(false), false);
+  this->advanceClocks(time::milliseconds(300));
+  BOOST_CHECK_EQUAL(detector.afterSendInterest(false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+  detector.afterReceiveData(time::milliseconds(20), false);
+  detector.afterReceiveData(time::milliseconds(20), false);
+
+  // same demand, one in ten Interests is satisfied
+  bool isDetected = false;
+  int nSent = 0;
+  for (; nSent < 100 && !isDetected; ++nSent) {
+    isDetected = detector.afterSendInterest(false);
+    if (nSent % 10 == 9) {
+      detector.afterReceiveData(time::milliseconds(20), false);
+    }
+    this->advanceClocks(time::milliseconds(25));
+  }
+  BOOST_CHECK_EQUAL(isDetected, true);
+  BOOST_CHECK_LE(nSent, 30);
+  BOOST_CHECK_EQUAL(detector.getReason(), LinkDegradationDetector::DELIVERY_RATE_DROP);
+
+  // a single healthy Data does not end a rate drop; a rate interval without drop does
+  BOOST_CHECK_EQUAL(detector.afterReceiveData(time::milliseconds(20), false), false);
+  BOOST_CHECK_EQUAL(detector.isDegraded(), true);
+  for (int i = 0; i < 20; ++i) {
+    detector.afterSendInterest(false);
+    detector.afterReceiveData(time::milliseconds(20), false);
+    this->advanceClocks(time::milliseconds(25));
+  }
+  BOOST_CHECK_EQUAL(detector.isDegraded(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Reset)
+{
+  LinkDegradationDetector detector;
+  for (int i = 0; i < 3; ++i) {
+    detector.afterSendInterest(true);
+  }
+  BOOST_CHECK_EQUAL(detector.isDegraded(), true);
+
+  detector.reset();
+  BOOST_CHECK_EQUAL(detector.getReason(), LinkDegradationDetector::NONE);
+  BOOST_CHECK(detector.getLastDataTime() == time::steady_clock::now());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLinkDegradationDetector
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
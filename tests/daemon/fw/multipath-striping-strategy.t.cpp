@@ -0,0 +1,297 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/multipath-striping-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "topology-tester.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestMultipathStripingStrategy, UnitTestTimeFixture)
+
+/** \brief consumer that keeps a fixed number of Interests outstanding,
+ *         and re-expresses an Interest upon timeout
+ */
+class PipelineConsumer : noncopyable
+{
+public:
+  PipelineConsumer(ndn::Face& face, const Name& prefix)
+    : m_face(face)
+    , m_prefix(prefix)
+    , m_nextSegment(0)
+  {
+  }
+
+  void
+  start(size_t pipelineSize)
+  {
+    for (size_t i = 0; i < pipelineSize; ++i) {
+      this->expressNext();
+    }
+  }
+
+private:
+  void
+  expressNext()
+  {
+    this->express(Name(m_prefix).appendSegment(m_nextSegment++));
+  }
+
+  void
+  express(const Name& name)
+  {
+    Interest interest(name);
+    interest.setInterestLifetime(time::seconds(2));
+    m_face.expressInterest(interest,
+                           bind(&PipelineConsumer::expressNext, this),
+                           bind(&PipelineConsumer::express, this, name));
+  }
+
+private:
+  ndn::Face& m_face;
+  Name m_prefix;
+  uint64_t m_nextSegment;
+};
+
+class TwoInterfacesFixture : public UnitTestTimeFixture
+{
+protected:
+  TwoInterfacesFixture()
+  {
+    /*
+     *                  +--------+
+     *           +----->| mobile |<------+
+     *           |      +--------+       |
+     *      WLAN |                       | LTE
+     *      10ms |                       | 40ms
+     *    8 Mbps |                       | 4 Mbps
+     *   1% loss |                       | 2% loss
+     *           |      +--------+       |
+     *           +----->| server |<------+
+     *                  +--------+
+     */
+
+    mobile = topo.addForwarder("M");
+    server = topo.addForwarder("S");
+
+    topo.setStrategy<fw::MultipathStripingStrategy>(mobile);
+
+    linkWlan = topo.addLink("WLAN", time::milliseconds(10), {mobile, server});
+    linkWlan->setBandwidth(WLAN_BANDWIDTH);
+    linkWlan->setLossRate(0.01);
+
+    linkLte = topo.addLink("LTE", time::milliseconds(40), {mobile, server});
+    linkLte->setBandwidth(LTE_BANDWIDTH);
+    linkLte->setLossRate(0.02);
+
+    shared_ptr<TopologyAppLink> producer = topo.addAppFace("p", server, "ndn:/server");
+    ndn::Face& producerFace = producer->getClientFace();
+    producerFace.setInterestFilter("ndn:/server",
+      [&producerFace] (const ndn::InterestFilter&, const Interest& interest) {
+        producerFace.put(*makePayloadData(interest.getName()));
+      });
+
+    consumer = topo.addAppFace("c", mobile);
+  }
+
+  static shared_ptr<Data>
+  makePayloadData(const Name& name)
+  {
+    static const std::vector<uint8_t> PAYLOAD(1000);
+    auto data = make_shared<Data>(name);
+    data->setContent(PAYLOAD.data(), PAYLOAD.size());
+    return signData(data);
+  }
+
+  /** \return maximum number of Data that a link can deliver in \p duration
+   */
+  static uint64_t
+  computeCapacity(uint64_t bandwidth, const time::nanoseconds& duration)
+  {
+    size_t dataSize = makePayloadData(Name("ndn:/server").appendSegment(0))->wireEncode().size();
+    return bandwidth * time::duration_cast<time::milliseconds>(duration).count() /
+           (1000 * 8 * dataSize);
+  }
+
+  /** \brief retrieve Data with 100 Interests outstanding for \p duration
+   *  \return number of Data received by the consumer
+   */
+  uint64_t
+  runTransfer(const time::nanoseconds& duration)
+  {
+    pipeline = make_unique<PipelineConsumer>(consumer->getClientFace(), "ndn:/server");
+    pipeline->start(100);
+    this->advanceClocks(time::milliseconds(1), duration);
+    return consumer->getForwarderFace().getCounters().nOutData;
+  }
+
+protected:
+  static const uint64_t WLAN_BANDWIDTH = 8000000;
+  static const uint64_t LTE_BANDWIDTH = 4000000;
+
+  TopologyTester topo;
+  TopologyNode mobile;
+  TopologyNode server;
+  shared_ptr<TopologyLink> linkWlan;
+  shared_ptr<TopologyLink> linkLte;
+  shared_ptr<TopologyAppLink> consumer;
+  unique_ptr<PipelineConsumer> pipeline;
+};
+
+BOOST_FIXTURE_TEST_CASE(Aggregate, TwoInterfacesFixture)
+{
+  topo.registerPrefix(mobile, linkWlan->getFace(mobile), "ndn:/server");
+  topo.registerPrefix(mobile, linkLte->getFace(mobile), "ndn:/server");
+
+  const time::seconds duration(5);
+  uint64_t nReceived = this->runTransfer(duration);
+
+  // goodput exceeds what either link alone can carry
+  BOOST_CHECK_GT(nReceived, computeCapacity(WLAN_BANDWIDTH, duration));
+  BOOST_CHECK_GT(nReceived, computeCapacity(LTE_BANDWIDTH, duration));
+
+  // WLAN carries more Interests than LTE, in proportion to its higher rate
+  uint64_t nWlanInterests = linkWlan->getFace(mobile).getCounters().nOutInterests;
+  uint64_t nLteInterests = linkLte->getFace(mobile).getCounters().nOutInterests;
+  BOOST_CHECK_GT(nWlanInterests, nLteInterests);
+  BOOST_CHECK_GT(nLteInterests, nWlanInterests / 4);
+}
+
+BOOST_FIXTURE_TEST_CASE(SingleLink, TwoInterfacesFixture)
+{
+  topo.registerPrefix(mobile, linkWlan->getFace(mobile), "ndn:/server");
+
+  const time::seconds duration(5);
+  uint64_t nReceived = this->runTransfer(duration);
+
+  // link emulation limits goodput, and the window keeps the link busy
+  uint64_t capacity = computeCapacity(WLAN_BANDWIDTH, duration);
+  BOOST_CHECK_LE(nReceived, capacity);
+  BOOST_CHECK_GT(nReceived, capacity * 3 / 4);
+  BOOST_CHECK_EQUAL(linkLte->getFace(mobile).getCounters().nOutInterests, 0);
+}
+
+class DummyFacesFixture : public UnitTestTimeFixture
+{
+protected:
+  DummyFacesFixture()
+    : strategy(make_shared<MultipathStripingStrategy>(ref(forwarder)))
+    , downstream(make_shared<DummyFace>("dummy://", "dummy://", ndn::nfd::FACE_SCOPE_LOCAL))
+    , upstream1(make_shared<DummyFace>())
+    , upstream2(make_shared<DummyFace>())
+  {
+    forwarder.getStrategyChoice().install(strategy);
+    forwarder.getStrategyChoice().insert("/", MultipathStripingStrategy::STRATEGY_NAME);
+
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream1);
+    forwarder.addFace(upstream2);
+    fibEntry = forwarder.getFib().insert("/").first;
+  }
+
+  size_t
+  getNInFlight(const shared_ptr<DummyFace>& face) const
+  {
+    const MultipathStripingStrategy::FaceInfo* fi = strategy->getFaceInfo(face->getId());
+    return fi == nullptr ? 0 : fi->nInFlight;
+  }
+
+protected:
+  Forwarder forwarder;
+  shared_ptr<MultipathStripingStrategy> strategy;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream1;
+  shared_ptr<DummyFace> upstream2;
+  shared_ptr<fib::Entry> fibEntry;
+};
+
+BOOST_FIXTURE_TEST_CASE(WindowFull, DummyFacesFixture)
+{
+  fibEntry->addNextHop(upstream1, 0);
+
+  const size_t nInterests = MultipathStripingStrategy::MIN_WINDOW + 2;
+  for (size_t i = 0; i < nInterests; ++i) {
+    downstream->receiveInterest(*makeInterest(Name("/A").appendSegment(i)));
+  }
+
+  // Interests beyond the window are held, not sent or Nacked
+  BOOST_CHECK_EQUAL(upstream1->sentInterests.size(), MultipathStripingStrategy::MIN_WINDOW);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), MultipathStripingStrategy::MIN_WINDOW);
+  BOOST_CHECK_EQUAL(strategy->getNHeldInterests(), 2);
+  BOOST_CHECK_EQUAL(downstream->sentNacks.size(), 0);
+
+  // a Data opens the window for the oldest held Interest
+  upstream1->receiveData(*makeData(Name("/A").appendSegment(0)));
+  BOOST_REQUIRE_EQUAL(upstream1->sentInterests.size(), MultipathStripingStrategy::MIN_WINDOW + 1);
+  BOOST_CHECK_EQUAL(upstream1->sentInterests.back().getName(),
+                    Name("/A").appendSegment(MultipathStripingStrategy::MIN_WINDOW));
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), MultipathStripingStrategy::MIN_WINDOW);
+  BOOST_CHECK_EQUAL(strategy->getNHeldInterests(), 1);
+
+  // expired Interests leave the window and the held queue
+  this->advanceClocks(time::milliseconds(100), time::seconds(5));
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), 0);
+  BOOST_CHECK_EQUAL(strategy->getNHeldInterests(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(NackFailoverMovesInFlight, DummyFacesFixture)
+{
+  fibEntry->addNextHop(upstream1, 0);
+  fibEntry->addNextHop(upstream2, 10);
+
+  downstream->receiveInterest(*makeInterest("/A/1"));
+  BOOST_REQUIRE_EQUAL(upstream1->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), 1);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream2), 0);
+
+  // the Interest is counted on the face it fails over to
+  upstream1->receiveNack(makeNack("/A/1", upstream1->sentInterests.back().getNonce(),
+                                  lp::NackReason::NO_ROUTE));
+  BOOST_REQUIRE_EQUAL(upstream2->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), 0);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream2), 1);
+
+  // the Interest is no longer counted once the Nack is returned downstream
+  upstream2->receiveNack(makeNack("/A/1", upstream2->sentInterests.back().getNonce(),
+                                  lp::NackReason::NO_ROUTE));
+  BOOST_CHECK_EQUAL(downstream->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream1), 0);
+  BOOST_CHECK_EQUAL(this->getNInFlight(upstream2), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMultipathStripingStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
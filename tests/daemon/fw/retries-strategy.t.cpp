@@ -0,0 +1,551 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/retries-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "topology-tester.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+/** \brief RetriesStrategy that exposes insertPendingInterest and setCongestionControl
+ */
+class RetriesTestStrategy : public RetriesStrategy
+{
+public:
+  explicit
+  RetriesTestStrategy(Forwarder& forwarder)
+    : RetriesStrategy(forwarder, STRATEGY_NAME)
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE
+  {
+  }
+
+  using RetriesStrategy::insertPendingInterest;
+  using RetriesStrategy::setCongestionControl;
+
+public:
+  // RetriesStrategy keeps a reference to its name
+  static const Name STRATEGY_NAME;
+};
+
+const Name RetriesTestStrategy::STRATEGY_NAME("ndn:/retries-test-strategy");
+
+class RetriesStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  RetriesStrategyFixture()
+    : strategy(make_shared<RetriesTestStrategy>(ref(forwarder)))
+    , downstream(make_shared<DummyFace>("dummy://", "dummy://", ndn::nfd::FACE_SCOPE_LOCAL))
+    , upstream(make_shared<DummyFace>())
+  {
+    forwarder.getStrategyChoice().install(strategy);
+    forwarder.getStrategyChoice().insert("/", RetriesTestStrategy::STRATEGY_NAME);
+
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream);
+    fibEntry = forwarder.getFib().insert("/").first;
+    fibEntry->addNextHop(upstream, 0);
+  }
+
+  /** \brief receives an Interest from downstream, and sends it to \p outFace
+   *
+   *  downstream is a local face, because RetriesStrategy only sends Interests that have
+   *  a local in-record.
+   */
+  shared_ptr<pit::Entry>
+  expressInterest(const Name& name, const shared_ptr<Face>& outFace)
+  {
+    shared_ptr<Interest> interest = makeInterest(name);
+    interest->setInterestLifetime(time::seconds(4));
+    shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(downstream, *interest);
+
+    strategy->insertPendingInterest(*interest, outFace, fibEntry, pitEntry);
+    return pitEntry;
+  }
+
+  void
+  receiveData(const shared_ptr<pit::Entry>& pitEntry, const Face& inFace)
+  {
+    shared_ptr<Data> data = makeData(pitEntry->getName());
+    strategy->beforeSatisfyInterest(pitEntry, inFace, *data);
+  }
+
+  /** \brief sends an Interest upstream, and returns Data after \p rtt
+   *  \return number of retransmissions
+   */
+  size_t
+  retrieve(const Name& name, time::milliseconds rtt)
+  {
+    size_t nSentBefore = upstream->sentInterests.size();
+    shared_ptr<pit::Entry> pitEntry = this->expressInterest(name, upstream);
+    this->advanceClocks(time::milliseconds(1), rtt);
+
+    this->receiveData(pitEntry, *upstream);
+    size_t nSent = upstream->sentInterests.size() - nSentBefore;
+    BOOST_REQUIRE_GE(nSent, 1);
+    return nSent - 1;
+  }
+
+protected:
+  Forwarder forwarder;
+  shared_ptr<RetriesTestStrategy> strategy;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream;
+  shared_ptr<fib::Entry> fibEntry;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestRetriesStrategy, RetriesStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(MixedRttProducers)
+{
+  // Trace: a fast producer (20ms) and a slow producer (400ms) on the same interface,
+  // retrieved in rounds of 10 fast Interests followed by 1 slow Interest.
+  static const size_t N_ROUNDS = 5;
+  size_t nFastRetx = 0;
+  std::vector<size_t> nSlowRetx;
+  for (size_t round = 0; round < N_ROUNDS; ++round) {
+    for (size_t i = 0; i < 10; ++i) {
+      nFastRetx += this->retrieve(Name("/fast").appendNumber(round * 10 + i), time::milliseconds(20));
+    }
+    nSlowRetx.push_back(this->retrieve(Name("/slow").appendNumber(round), time::milliseconds(400)));
+  }
+
+  BOOST_CHECK_EQUAL(nFastRetx, 0);
+
+  // The first slow Interest has no per-prefix estimate, and falls back to the per-interface
+  // estimator that is dominated by the fast producer, resulting in spurious retransmissions.
+  BOOST_CHECK_GT(nSlowRetx.front(), 0);
+
+  // Afterwards, RTO of the slow producer comes from its own estimator.
+  for (size_t round = 1; round < N_ROUNDS; ++round) {
+    BOOST_CHECK_EQUAL(nSlowRetx[round], 0);
+  }
+}
+
+class ProactiveHandoverFixture : public RetriesStrategyFixture
+{
+protected:
+  ProactiveHandoverFixture()
+    : secondary(make_shared<DummyFace>())
+  {
+    // handover is not held back by the initial congestion window of secondary
+    strategy->setCongestionControl(false);
+
+    forwarder.addFace(secondary);
+    fibEntry->addNextHop(secondary, 10);
+
+    // RTO of upstream converges to about 40ms
+    for (int i = 0; i < 10; ++i) {
+      this->retrieve(Name("/A").appendNumber(i), time::milliseconds(20));
+    }
+    BOOST_REQUIRE(strategy->getLinkDegradationDetector(upstream->getId()) != nullptr);
+  }
+
+  LinkDegradationDetector::Reason
+  getUpstreamState() const
+  {
+    return strategy->getLinkDegradationDetector(upstream->getId())->getReason();
+  }
+
+protected:
+  shared_ptr<DummyFace> secondary;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ProactiveHandover, ProactiveHandoverFixture)
+
+BOOST_AUTO_TEST_CASE(ConsecutiveTimeouts)
+{
+  // upstream stops answering, but its interface is not declared down
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (int i = 0; i < 5; ++i) {
+    pitEntries.push_back(this->expressInterest(Name("/A/lost").appendNumber(i), upstream));
+  }
+  BOOST_CHECK_EQUAL(secondary->sentInterests.size(), 0);
+
+  time::steady_clock::TimePoint lostSince = time::steady_clock::now();
+  for (int i = 0; i < 1000 && getUpstreamState() == LinkDegradationDetector::NONE; ++i) {
+    this->advanceClocks(time::milliseconds(1));
+  }
+  BOOST_REQUIRE_EQUAL(getUpstreamState(), LinkDegradationDetector::CONSECUTIVE_TIMEOUTS);
+  BOOST_CHECK_LT(time::steady_clock::now() - lostSince, time::milliseconds(100));
+  BOOST_CHECK_EQUAL(upstream->getState(), face::TransportState::UP);
+
+  // every outstanding Interest is duplicated onto secondary
+  BOOST_REQUIRE_EQUAL(secondary->sentInterests.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    BOOST_CHECK_EQUAL(secondary->sentInterests[i].getName(), pitEntries[i]->getName());
+  }
+
+  // while upstream is degraded, new Interests are duplicated as well
+  pitEntries.push_back(this->expressInterest("/A/new", upstream));
+  BOOST_REQUIRE_EQUAL(secondary->sentInterests.size(), 6);
+  BOOST_CHECK_EQUAL(secondary->sentInterests.back().getName(), "/A/new");
+
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(20));
+  for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+    this->receiveData(pitEntry, *secondary);
+  }
+
+  // upstream recovers on a Data of an Interest that was not retransmitted
+  BOOST_CHECK_EQUAL(this->retrieve("/A/recovered", time::milliseconds(20)), 0);
+  BOOST_CHECK_EQUAL(getUpstreamState(), LinkDegradationDetector::NONE);
+  size_t nSecondarySent = secondary->sentInterests.size();
+  BOOST_CHECK_EQUAL(this->retrieve("/A/healthy", time::milliseconds(20)), 0);
+  BOOST_CHECK_EQUAL(secondary->sentInterests.size(), nSecondarySent);
+}
+
+BOOST_AUTO_TEST_CASE(RttInflation)
+{
+  // upstream queue builds up: RTT grows by half each time, but stays below RTO
+  static const int RTTS[] = {30, 45, 68, 101, 152};
+  for (int rtt : RTTS) {
+    BOOST_CHECK_EQUAL(getUpstreamState(), LinkDegradationDetector::NONE);
+    BOOST_CHECK_EQUAL(this->retrieve(Name("/A/slow").appendNumber(rtt), time::milliseconds(rtt)), 0);
+  }
+  BOOST_CHECK_EQUAL(getUpstreamState(), LinkDegradationDetector::RTT_INFLATION);
+  BOOST_CHECK_EQUAL(secondary->sentInterests.size(), 0);
+
+  shared_ptr<pit::Entry> pitEntry = this->expressInterest("/A/new", upstream);
+  BOOST_REQUIRE_EQUAL(secondary->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(secondary->sentInterests.back().getName(), "/A/new");
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(20));
+  this->receiveData(pitEntry, *secondary);
+}
+
+BOOST_AUTO_TEST_CASE(NoSecondary)
+{
+  secondary->setState(face::FaceState::DOWN);
+
+  for (int i = 0; i < 5; ++i) {
+    this->expressInterest(Name("/A/lost").appendNumber(i), upstream);
+  }
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(100));
+  BOOST_CHECK_EQUAL(getUpstreamState(), LinkDegradationDetector::CONSECUTIVE_TIMEOUTS);
+  BOOST_CHECK_EQUAL(secondary->sentInterests.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ProactiveHandover
+
+class CongestionControlFixture : public RetriesStrategyFixture
+{
+protected:
+  Strategy::CongestionStatus
+  getUpstreamStatus() const
+  {
+    std::vector<Strategy::CongestionStatus> statuses = strategy->getCongestionStatus();
+    BOOST_REQUIRE_EQUAL(statuses.size(), 1);
+    BOOST_REQUIRE_EQUAL(statuses.front().faceId, upstream->getId());
+    return statuses.front();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(CongestionControl, CongestionControlFixture)
+
+BOOST_AUTO_TEST_CASE(QueueUntilData)
+{
+  BOOST_CHECK(strategy->getCongestionWindow(upstream->getId()) == nullptr);
+
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (int i = 0; i < 6; ++i) {
+    pitEntries.push_back(this->expressInterest(Name("/A").appendNumber(i), upstream));
+  }
+
+  // initial window is 4 Interests, the rest waits in the strategy
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 4);
+  Strategy::CongestionStatus status = this->getUpstreamStatus();
+  BOOST_CHECK_EQUAL(status.window, 4.0);
+  BOOST_CHECK_EQUAL(status.nInFlight, 4);
+  BOOST_CHECK_EQUAL(status.nQueued, 2);
+
+  // Data grows the window in slow start, so both queued Interests are sent
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(20));
+  this->receiveData(pitEntries[0], *upstream);
+  BOOST_REQUIRE_EQUAL(upstream->sentInterests.size(), 6);
+  BOOST_CHECK_EQUAL(upstream->sentInterests[4].getName(), "/A/%04");
+  BOOST_CHECK_EQUAL(upstream->sentInterests[5].getName(), "/A/%05");
+  status = this->getUpstreamStatus();
+  BOOST_CHECK_EQUAL(status.window, 5.0);
+  BOOST_CHECK_EQUAL(status.nInFlight, 5);
+  BOOST_CHECK_EQUAL(status.nQueued, 0);
+
+  for (size_t i = 1; i < pitEntries.size(); ++i) {
+    this->receiveData(pitEntries[i], *upstream);
+  }
+  status = this->getUpstreamStatus();
+  BOOST_CHECK_EQUAL(status.window, 10.0);
+  BOOST_CHECK_EQUAL(status.nInFlight, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Timeout)
+{
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (int i = 0; i < 4; ++i) {
+    pitEntries.push_back(this->expressInterest(Name("/A").appendNumber(i), upstream));
+  }
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 4);
+
+  // all four time out in the same round trip, which halves the window once;
+  // two retransmissions fit in the window, and the other two wait behind them
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(600));
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 6);
+  Strategy::CongestionStatus status = this->getUpstreamStatus();
+  BOOST_CHECK_EQUAL(status.window, 2.0);
+  BOOST_CHECK_EQUAL(status.nInFlight, 2);
+  BOOST_CHECK_EQUAL(status.nQueued, 2);
+
+  this->receiveData(pitEntries[0], *upstream);
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 7);
+  status = this->getUpstreamStatus();
+  BOOST_CHECK_EQUAL(status.window, 2.5); // congestion avoidance
+  BOOST_CHECK_EQUAL(status.nInFlight, 2);
+  BOOST_CHECK_EQUAL(status.nQueued, 1);
+}
+
+BOOST_AUTO_TEST_CASE(CongestionNack)
+{
+  shared_ptr<pit::Entry> pitEntry = this->expressInterest("/A", upstream);
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 1);
+
+  // Congestion Nack halves the window, and the Interest is retransmitted without waiting for RTO
+  lp::Nack congestion = makeNack("/A", 1, lp::NackReason::CONGESTION);
+  strategy->afterReceiveNack(*upstream, congestion, fibEntry, pitEntry);
+  BOOST_CHECK_EQUAL(this->getUpstreamStatus().window, 2.0);
+  BOOST_CHECK_EQUAL(this->getUpstreamStatus().nInFlight, 1);
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(downstream->sentNacks.size(), 0);
+
+  // other Nack reasons leave the window unchanged;
+  // upstream is the only nexthop, so the Nack is returned downstream
+  this->advanceClocks(time::milliseconds(1), time::milliseconds(20));
+  lp::Nack noRoute = makeNack("/A", 2, lp::NackReason::NO_ROUTE);
+  strategy->afterReceiveNack(*upstream, noRoute, fibEntry, pitEntry);
+  BOOST_CHECK_EQUAL(this->getUpstreamStatus().window, 2.0);
+  BOOST_CHECK_EQUAL(this->getUpstreamStatus().nInFlight, 0);
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 2);
+  BOOST_REQUIRE_EQUAL(downstream->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(downstream->sentNacks.back().getReason(), lp::NackReason::NO_ROUTE);
+}
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  strategy->setCongestionControl(false);
+  for (int i = 0; i < 6; ++i) {
+    this->expressInterest(Name("/A").appendNumber(i), upstream);
+  }
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), 6);
+  BOOST_CHECK(strategy->getCongestionStatus().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CongestionControl
+
+/** \brief RetriesStrategy that sends a new Interest to the lowest cost nexthop
+ *         that is not backed off
+ */
+class LowestCostRetriesStrategy : public RetriesStrategy
+{
+public:
+  explicit
+  LowestCostRetriesStrategy(Forwarder& forwarder)
+    : RetriesStrategy(forwarder, STRATEGY_NAME)
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE
+  {
+    Face* outFace = nullptr;
+    for (const fib::NextHop& nexthop : fibEntry->getNextHops()) {
+      if (!pitEntry->canForwardTo(nexthop.getFace()))
+        continue;
+      if (outFace == nullptr)
+        outFace = &nexthop.getFace();
+      if (!this->isNackBackedOff(*fibEntry, nexthop.getFace())) {
+        outFace = &nexthop.getFace();
+        break;
+      }
+    }
+
+    if (outFace == nullptr) {
+      this->rejectPendingInterest(pitEntry);
+      return;
+    }
+    this->insertPendingInterest(interest, outFace->shared_from_this(), fibEntry, pitEntry);
+  }
+
+public:
+  // RetriesStrategy keeps a reference to its name
+  static const Name STRATEGY_NAME;
+};
+
+const Name LowestCostRetriesStrategy::STRATEGY_NAME("ndn:/lowest-cost-retries-strategy");
+
+class NackFailoverFixture : public UnitTestTimeFixture
+{
+protected:
+  NackFailoverFixture()
+    : nData(0)
+    , nNacks(0)
+  {
+    /*
+     *                  +--------+
+     *           +----->| mobile |<------+
+     *           |      +--------+       |
+     *      WLAN |                       | LTE
+     *      10ms |                       | 40ms
+     *           v                       v
+     *      +--------+              +--------+
+     *      | access |              | server |
+     *      +--------+              +--------+
+     *
+     *  The access router has no route to /P, so it returns NoRoute Nacks.
+     */
+    mobile = topo.addForwarder("M");
+    access = topo.addForwarder("A");
+    server = topo.addForwarder("S");
+
+    topo.setStrategy<LowestCostRetriesStrategy>(mobile);
+
+    linkWlan = topo.addLink("WLAN", time::milliseconds(10), {mobile, access});
+    linkLte = topo.addLink("LTE", time::milliseconds(40), {mobile, server});
+    topo.registerPrefix(mobile, linkWlan->getFace(mobile), "ndn:/P", 0);
+    topo.registerPrefix(mobile, linkLte->getFace(mobile), "ndn:/P", 10);
+
+    consumer = topo.addAppFace("c", mobile);
+  }
+
+  /** \brief express an Interest from consumer, and wait for Data or Nack
+   *  \return time until Data or Nack arrives
+   */
+  time::nanoseconds
+  express(const Name& name)
+  {
+    size_t nResponses = nData + nNacks;
+    time::steady_clock::TimePoint sendTime = time::steady_clock::now();
+    time::steady_clock::TimePoint responseTime = sendTime;
+    consumer->getClientFace().expressInterest(Interest(name),
+      bind([this, &responseTime] { ++nData; responseTime = time::steady_clock::now(); }),
+      bind([this, &responseTime] { ++nNacks; responseTime = time::steady_clock::now(); }),
+      bind([] {}));
+
+    for (int i = 0; i < 2000 && nData + nNacks == nResponses; ++i) {
+      this->advanceClocks(time::milliseconds(1));
+    }
+    BOOST_REQUIRE_EQUAL(nData + nNacks, nResponses + 1);
+    return responseTime - sendTime;
+  }
+
+  uint64_t
+  getNOutInterests(const shared_ptr<TopologyLink>& link)
+  {
+    return link->getFace(mobile).getCounters().nOutInterests;
+  }
+
+protected:
+  TopologyTester topo;
+  TopologyNode mobile;
+  TopologyNode access;
+  TopologyNode server;
+  shared_ptr<TopologyLink> linkWlan;
+  shared_ptr<TopologyLink> linkLte;
+  shared_ptr<TopologyAppLink> consumer;
+  size_t nData;
+  size_t nNacks;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NackFailover, NackFailoverFixture)
+
+BOOST_AUTO_TEST_CASE(FailoverLatency)
+{
+  shared_ptr<TopologyAppLink> producer = topo.addAppFace("p", server, "ndn:/P");
+  topo.addEchoProducer(producer->getClientFace(), "ndn:/P");
+
+  // Nack round trip on WLAN plus Data round trip on LTE,
+  // instead of waiting for RTO which is about 500ms before any RTT is measured
+  time::nanoseconds latency = this->express("/P/1");
+  BOOST_TEST_MESSAGE("failover latency " << time::duration_cast<time::milliseconds>(latency));
+  BOOST_CHECK_EQUAL(nData, 1);
+  BOOST_CHECK_GE(latency, time::milliseconds(100));
+  BOOST_CHECK_LT(latency, time::milliseconds(120));
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkWlan), 1);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkLte), 1);
+
+  // while WLAN is backed off, Interests go to LTE directly
+  latency = this->express("/P/2");
+  BOOST_CHECK_EQUAL(nData, 2);
+  BOOST_CHECK_LT(latency, time::milliseconds(100));
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkWlan), 1);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkLte), 2);
+
+  // WLAN is tried again after the backoff, and another Nack doubles the backoff
+  this->advanceClocks(time::milliseconds(10), RetriesStrategy::NACK_BACKOFF_INITIAL);
+  latency = this->express("/P/3");
+  BOOST_CHECK_EQUAL(nData, 3);
+  BOOST_CHECK_LT(latency, time::milliseconds(120));
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkWlan), 2);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkLte), 3);
+
+  this->advanceClocks(time::milliseconds(10), RetriesStrategy::NACK_BACKOFF_INITIAL);
+  this->express("/P/4");
+  BOOST_CHECK_EQUAL(nData, 4);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkWlan), 2);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkLte), 4);
+  BOOST_CHECK_EQUAL(nNacks, 0);
+}
+
+BOOST_AUTO_TEST_CASE(AllNexthopsFail)
+{
+  // server has no producer, so LTE returns a NoRoute Nack as well
+  time::nanoseconds latency = this->express("/P/1");
+  BOOST_CHECK_EQUAL(nData, 0);
+  BOOST_CHECK_EQUAL(nNacks, 1);
+  BOOST_CHECK_LT(latency, time::milliseconds(120));
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkWlan), 1);
+  BOOST_CHECK_EQUAL(this->getNOutInterests(linkLte), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // NackFailover
+
+BOOST_AUTO_TEST_SUITE_END() // TestRetriesStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
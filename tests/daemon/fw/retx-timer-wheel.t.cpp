@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/retx-timer-wheel.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestRetxTimerWheel, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(ScheduleCancel)
+{
+  RetxTimerWheel wheel(time::milliseconds(1), 16);
+  int nFired1 = 0;
+  int nFired2 = 0;
+  RetxTimer timer1(wheel, [&] { ++nFired1; });
+  RetxTimer timer2(wheel, [&] { ++nFired2; });
+
+  timer1.schedule(time::milliseconds(5));
+  timer2.schedule(time::milliseconds(40)); // more than one revolution
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+  BOOST_CHECK(timer1.isPending());
+
+  this->advanceClocks(time::milliseconds(1), 4);
+  BOOST_CHECK_EQUAL(nFired1, 0);
+  this->advanceClocks(time::milliseconds(1), 1);
+  BOOST_CHECK_EQUAL(nFired1, 1);
+  BOOST_CHECK(!timer1.isPending());
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  // rescheduling replaces the previous expiry
+  timer1.schedule(time::milliseconds(100));
+  timer1.schedule(time::milliseconds(3));
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+  this->advanceClocks(time::milliseconds(1), 3);
+  BOOST_CHECK_EQUAL(nFired1, 2);
+
+  this->advanceClocks(time::milliseconds(1), 31);
+  BOOST_CHECK_EQUAL(nFired2, 0);
+  this->advanceClocks(time::milliseconds(1), 1);
+  BOOST_CHECK_EQUAL(nFired2, 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  timer1.schedule(time::milliseconds(2));
+  timer1.cancel();
+  BOOST_CHECK(!timer1.isPending());
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  this->advanceClocks(time::milliseconds(1), 10);
+  BOOST_CHECK_EQUAL(nFired1, 2);
+}
+
+BOOST_AUTO_TEST_CASE(Callback)
+{
+  RetxTimerWheel wheel(time::milliseconds(1), 16);
+
+  // callback reschedules its own timer
+  int nFired = 0;
+  unique_ptr<RetxTimer> timer;
+  timer = make_unique<RetxTimer>(wheel, [&] {
+    if (++nFired < 5) {
+      timer->schedule(time::milliseconds(7));
+    }
+  });
+  timer->schedule(time::milliseconds(7));
+  this->advanceClocks(time::milliseconds(1), 100);
+  BOOST_CHECK_EQUAL(nFired, 5);
+
+  // callback destructs its own timer and another due timer
+  unique_ptr<RetxTimer> timer2;
+  timer = make_unique<RetxTimer>(wheel, [&] { timer.reset(); timer2.reset(); });
+  timer2 = make_unique<RetxTimer>(wheel, [] { BOOST_ERROR("timer2 should be destructed"); });
+  timer->schedule(time::milliseconds(5));
+  timer2->schedule(time::milliseconds(5));
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+  this->advanceClocks(time::milliseconds(1), 10);
+  BOOST_CHECK(timer == nullptr);
+  BOOST_CHECK(timer2 == nullptr);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Destruct)
+{
+  RetxTimerWheel wheel(time::milliseconds(1), 16);
+  {
+    RetxTimer timer(wheel, [] { BOOST_ERROR("timer should be destructed"); });
+    timer.schedule(time::milliseconds(1));
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+  }
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  this->advanceClocks(time::milliseconds(1), 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRetxTimerWheel
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
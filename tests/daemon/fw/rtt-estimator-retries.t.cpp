@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/rtt-estimator-retries.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestRttEstimatorRetries, UnitTestTimeFixture)
+
+BOOST_AUTO_TEST_CASE(InitialRto)
+{
+  RttEstimatorRetries rtt;
+  BOOST_CHECK_EQUAL(rtt.hasSamples(), false);
+  BOOST_CHECK_EQUAL(rtt.computeRto(), time::milliseconds(492));
+  BOOST_CHECK_EQUAL(rtt.getRttMean(), 250);
+
+  BOOST_CHECK_EQUAL(rtt.addRttMeasurement({}), -1);
+  BOOST_CHECK_EQUAL(rtt.hasSamples(), false);
+}
+
+BOOST_AUTO_TEST_CASE(SlidingWindow)
+{
+  // reference: re-fold a window of the latest 6 samples, oldest first
+  std::vector<float> window;
+  auto computeReference = [&window] (float& mean, float& var) {
+    mean = window[0];
+    var = window[0] / 2;
+    for (size_t i = 1; i < window.size(); ++i) {
+      var = (var * 0.125f) + (std::abs(window[i] - mean) * 0.875f);
+      mean = (mean * 0.3f) + (window[i] * 0.7f);
+    }
+  };
+
+  RttEstimatorRetries rtt;
+  for (int i = 0; i < 200; ++i) {
+    std::vector<time::steady_clock::TimePoint> retries;
+    for (int j = 0; j <= i % 3; ++j) {
+      retries.push_back(time::steady_clock::now());
+      this->advanceClocks(time::milliseconds(1), time::milliseconds(15 + (i * 7) % 40));
+    }
+    this->advanceClocks(time::milliseconds(1), time::milliseconds((i * 37) % 300));
+
+    rtt.addRttMeasurement(retries);
+    BOOST_REQUIRE(rtt.hasSamples());
+
+    window.push_back(rtt.getLastRtt());
+    if (window.size() > 6) {
+      window.erase(window.begin());
+    }
+    float mean = 0, var = 0;
+    computeReference(mean, var);
+    BOOST_CHECK_EQUAL(rtt.getRttMean(), mean);
+    int rto = std::max(5, static_cast<int>(std::ceil(2 * (mean + var * 4))));
+    BOOST_CHECK_EQUAL(rtt.computeRto(), time::milliseconds(rto));
+  }
+
+  rtt.reset();
+  BOOST_CHECK_EQUAL(rtt.hasSamples(), false);
+  BOOST_CHECK_EQUAL(rtt.computeRto(), time::milliseconds(492));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRttEstimatorRetries
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace nfd
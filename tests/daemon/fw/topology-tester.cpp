@@ -39,6 +39,8 @@ using face::GenericLinkService;
 TopologyLink::TopologyLink(const time::nanoseconds& delay)
   : m_isUp(true)
   , m_delay(delay)
+  , m_bandwidth(0)
+  , m_lossRate(0.0)
 {
   BOOST_ASSERT(delay > time::nanoseconds::zero());
   // zero delay does not work on OSX
@@ -68,20 +70,34 @@ TopologyLink::transmit(TopologyNode i, const Block& packet)
     return;
   }
 
+  if (m_lossRate > 0.0 && std::bernoulli_distribution(m_lossRate)(m_lossRng)) {
+    return;
+  }
+
+  time::nanoseconds delay = m_delay;
+  if (m_bandwidth > 0) {
+    time::steady_clock::TimePoint now = time::steady_clock::now();
+    time::steady_clock::TimePoint& txEnd = m_txEnd[i];
+    txEnd = std::max(txEnd, now) +
+            time::nanoseconds(packet.size() * 8 * 1000000000 / m_bandwidth);
+    delay += txEnd - now;
+  }
+
   for (auto&& p : m_transports) {
     if (p.first == i) {
       continue;
     }
 
     InternalTransportBase* recipient = p.second;
-    this->scheduleReceive(recipient, packet);
+    this->scheduleReceive(recipient, packet, delay);
   }
 }
 
 void
-TopologyLink::scheduleReceive(InternalTransportBase* recipient, const Block& packet)
+TopologyLink::scheduleReceive(InternalTransportBase* recipient, const Block& packet,
+                              const time::nanoseconds& delay)
 {
-  scheduler::schedule(m_delay, [packet, recipient] {
+  scheduler::schedule(delay, [packet, recipient] {
     recipient->receiveFromLink(packet);
   });
 }
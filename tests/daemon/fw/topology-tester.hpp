@@ -36,6 +36,8 @@
 #include "fw/strategy.hpp"
 #include "tests/test-common.hpp"
 
+#include <random>
+
 namespace nfd {
 namespace fw {
 namespace tests {
@@ -70,6 +72,29 @@ public:
     m_isUp = true;
   }
 
+  /** \brief limit the transmission rate of each face on this link
+   *  \param bitsPerSecond transmission rate, or zero for unlimited
+   *
+   *  Packets sent by a face are transmitted one at a time; a packet that is sent while the
+   *  face is transmitting waits in an unbounded queue.
+   */
+  void
+  setBandwidth(uint64_t bitsPerSecond)
+  {
+    m_bandwidth = bitsPerSecond;
+  }
+
+  /** \brief drop packets at random
+   *  \param lossRate probability that a packet is dropped, between 0 and 1
+   *
+   *  Random numbers come from a fixed seed, so that test results are reproducible.
+   */
+  void
+  setLossRate(double lossRate)
+  {
+    m_lossRate = lossRate;
+  }
+
   /** \brief attach a face to the link
    *  \param i forwarder index
    *  \param face a Face with InternalForwarderTransport
@@ -96,11 +121,19 @@ private:
   transmit(TopologyNode i, const Block& packet);
 
   void
-  scheduleReceive(face::InternalTransportBase* recipient, const Block& packet);
+  scheduleReceive(face::InternalTransportBase* recipient, const Block& packet,
+                  const time::nanoseconds& delay);
 
 private:
   bool m_isUp;
   time::nanoseconds m_delay;
+  uint64_t m_bandwidth;
+  double m_lossRate;
+  std::mt19937 m_lossRng;
+
+  /// when each face finishes transmitting its queued packets
+  std::unordered_map<TopologyNode, time::steady_clock::TimePoint> m_txEnd;
+
   std::unordered_map<TopologyNode, face::InternalTransportBase*> m_transports;
   std::unordered_map<TopologyNode, shared_ptr<Face>> m_faces;
 };
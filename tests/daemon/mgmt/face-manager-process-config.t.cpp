@@ -71,6 +71,7 @@ BOOST_AUTO_TEST_CASE(ProcessSectionUnix)
     "  unix\n"
     "  {\n"
     "    path /tmp/nfd.sock\n"
+    "    send_queue_limit 1048576\n"
     "  }\n"
     "}\n";
   BOOST_CHECK_NO_THROW(parseConfig(CONFIG, true));
@@ -104,6 +105,7 @@ BOOST_AUTO_TEST_CASE(ProcessSectionTcp)
     "    port 16363\n"
     "    enable_v4 yes\n"
     "    enable_v6 yes\n"
+    "    send_queue_limit 1048576\n"
     "  }\n"
     "}\n";
   BOOST_CHECK_NO_THROW(parseConfig(CONFIG, true));
@@ -167,6 +169,7 @@ BOOST_AUTO_TEST_CASE(ProcessSectionUdp)
     "    enable_v6 yes\n"
     "    idle_timeout 30\n"
     "    keep_alive_interval 25\n"
+    "    batch_size 32\n"
     "    mcast yes\n"
     "    mcast_port 56363\n"
     "    mcast_group 224.0.23.170\n"
@@ -176,6 +179,31 @@ BOOST_AUTO_TEST_CASE(ProcessSectionUdp)
   BOOST_CHECK_NO_THROW(parseConfig(CONFIG, false));
 }
 
+BOOST_AUTO_TEST_CASE(ProcessSectionUdpBadBatchSize)
+{
+  const std::string CONFIG1 =
+    "face_system\n"
+    "{\n"
+    "  udp\n"
+    "  {\n"
+    "    batch_size 0\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG1, false), ConfigFile::Error);
+
+  const std::string CONFIG2 =
+    "face_system\n"
+    "{\n"
+    "  udp\n"
+    "  {\n"
+    "    batch_size 1025\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(ProcessSectionUdpBadIdleTimeout)
 {
   const std::string CONFIG =
@@ -24,9 +24,12 @@
  */
 
 #include "mgmt/face-manager.hpp"
+#include "core/nfd-tlv.hpp"
 #include "manager-common-fixture.hpp"
 #include "../face/dummy-face.hpp"
+#include "face/generic-link-service.hpp"
 #include "face/tcp-factory.hpp"
+#include "face/tcp-transport.hpp"
 #include "face/udp-factory.hpp"
 
 #include <ndn-cxx/util/random.hpp>
@@ -264,6 +267,85 @@ BOOST_AUTO_TEST_CASE(FaceDataset)
   // TODO#3325 check dataset contents including counter values
 }
 
+BOOST_AUTO_TEST_CASE(FaceDatasetRates)
+{
+  auto face = addFace(REMOVE_LAST_NOTIFICATION);
+  const face::FaceCounters& counters = face->getCounters();
+  const_cast<PacketCounter&>(counters.nInPackets).set(3000);
+  const_cast<PacketCounter&>(counters.nOutPackets).set(1000);
+  const_cast<ByteCounter&>(counters.nInBytes).set(600000);
+  const_cast<ByteCounter&>(counters.nOutBytes).set(200000);
+  advanceClocks(time::milliseconds(10), time::seconds(2));
+
+  receiveInterest(makeInterest("/localhost/nfd/faces/list"));
+
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+
+  Block element = content.elements().front();
+  ndn::nfd::FaceStatus decodedStatus;
+  BOOST_REQUIRE_NO_THROW(decodedStatus.wireDecode(element));
+  BOOST_CHECK_EQUAL(decodedStatus.getFaceId(), face->getId());
+  element.parse();
+  auto readRate = [&element] (uint32_t type) {
+    return static_cast<double>(ndn::readNonNegativeInteger(element.get(type)));
+  };
+  // rates are computed over the interval since the face was added, which is slightly above 2s
+  BOOST_CHECK_CLOSE(readRate(tlv::InPacketRate), 1500.0, 1.0);
+  BOOST_CHECK_CLOSE(readRate(tlv::OutPacketRate), 500.0, 1.0);
+  BOOST_CHECK_CLOSE(readRate(tlv::InByteRate), 300000.0, 1.0);
+  BOOST_CHECK_CLOSE(readRate(tlv::OutByteRate), 100000.0, 1.0);
+
+  // send queue counters are only present for stream faces
+  BOOST_CHECK(element.find(tlv::SendQueueBytes) == element.elements_end());
+  BOOST_CHECK(element.find(tlv::NSendQueueDrops) == element.elements_end());
+}
+
+BOOST_AUTO_TEST_CASE(FaceDatasetStreamFace)
+{
+  using boost::asio::ip::tcp;
+  tcp::acceptor acceptor(g_io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+  tcp::socket localSocket(g_io);
+  tcp::socket remoteSocket(g_io);
+  remoteSocket.connect(acceptor.local_endpoint());
+  acceptor.accept(localSocket);
+
+  auto transport = make_unique<face::TcpTransport>(std::move(localSocket),
+                                                   ndn::nfd::FACE_PERSISTENCY_PERSISTENT);
+  face::TcpTransport* tcpTransport = transport.get();
+  auto face = make_shared<Face>(make_unique<face::GenericLinkService>(), std::move(transport));
+  m_faceTable.add(face);
+  advanceClocks(time::milliseconds(1), 10); // wait for notification posted
+  m_responses.pop_back();
+
+  // the first Interest is written; the second does not fit in the send queue and is dropped
+  tcpTransport->setSendQueueLimit(1);
+  face->sendInterest(*makeInterest("/A"));
+  face->sendInterest(*makeInterest("/B"));
+  BOOST_CHECK_GT(tcpTransport->getCounters().nSendQueueBytes, 0);
+
+  receiveInterest(makeInterest("/localhost/nfd/faces/list"));
+
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+
+  Block element = content.elements().front();
+  ndn::nfd::FaceStatus decodedStatus;
+  BOOST_REQUIRE_NO_THROW(decodedStatus.wireDecode(element));
+  BOOST_CHECK_EQUAL(decodedStatus.getFaceId(), face->getId());
+  element.parse();
+  BOOST_REQUIRE(element.find(tlv::SendQueueBytes) != element.elements_end());
+  BOOST_REQUIRE(element.find(tlv::NSendQueueDrops) != element.elements_end());
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*element.find(tlv::SendQueueBytes)),
+                    tcpTransport->getCounters().nSendQueueBytes);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*element.find(tlv::NSendQueueDrops)), 1);
+
+  face->close();
+  advanceClocks(time::milliseconds(1), 10);
+}
+
 BOOST_AUTO_TEST_CASE(FaceQuery)
 {
   auto face1 = addFace(REMOVE_LAST_NOTIFICATION); // dummy://
@@ -56,6 +56,15 @@ public: // for test
     return ControlParameters().setName(name).setFaceId(id).setCost(cost);
   }
 
+  shared_ptr<Interest>
+  makeBatchUpdateRequest(const FibBatchUpdate& batch)
+  {
+    auto command = makeInterest(Name("/localhost/nfd/fib/batch-update").append(batch.wireEncode()));
+    m_keyChain.sign(*command, ndn::security::SigningInfo(ndn::security::SigningInfo::SIGNER_TYPE_ID,
+                                                         m_identityName));
+    return command;
+  }
+
   FaceId
   addFace()
   {
@@ -106,7 +115,7 @@ public: // for check
 
     if (faceId != face::FACEID_NULL) {
       for (auto&& record : nextHops) {
-        if (record.getFace()->getId() == faceId) {
+        if (record.getFace().getId() == faceId) {
           return expectedCost != -1 && record.getCost() != static_cast<uint32_t>(expectedCost) ?
             CheckNextHopResult::WRONG_COST : CheckNextHopResult::OK;
         }
@@ -387,6 +396,113 @@ BOOST_AUTO_TEST_CASE(RecordNotExist)
 
 BOOST_AUTO_TEST_SUITE_END() // RemoveNextHop
 
+BOOST_AUTO_TEST_SUITE(BatchUpdate)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  FibBatchUpdate batch;
+  batch.addAddNextHop("/A", 1, 10)
+       .addRemoveNextHop("/B", 2)
+       .addAddNextHop("/A/C", 3, 0);
+
+  FibBatchUpdate decoded(batch.wireEncode());
+  BOOST_REQUIRE_EQUAL(decoded.size(), 3);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[0].action, FibBatchUpdate::ADD_NEXTHOP);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[0].name, "/A");
+  BOOST_CHECK_EQUAL(decoded.getEntries()[0].faceId, 1);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[0].cost, 10);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[1].action, FibBatchUpdate::REMOVE_NEXTHOP);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[1].name, "/B");
+  BOOST_CHECK_EQUAL(decoded.getEntries()[1].faceId, 2);
+  BOOST_CHECK_EQUAL(decoded.getEntries()[2].name, "/A/C");
+
+  size_t entriesSize = 0;
+  for (const FibBatchUpdate::Entry& entry : batch.getEntries()) {
+    entriesSize += FibBatchUpdate::getEntryWireSize(entry);
+  }
+  BOOST_CHECK_EQUAL(batch.wireEncode().value_size(), entriesSize);
+
+  BOOST_CHECK_THROW(FibBatchUpdate(ndn::makeEmptyBlock(tlv::Name)), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Apply)
+{
+  FaceId face1 = addFace();
+  FaceId face2 = addFace();
+
+  FibBatchUpdate setup;
+  setup.addAddNextHop("/hello", face1, 10);
+  receiveInterest(makeBatchUpdateRequest(setup));
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face1, 10), CheckNextHopResult::OK);
+
+  FibBatchUpdate batch;
+  batch.addAddNextHop("/hello", face2, 20)
+       .addRemoveNextHop("/hello", face1)
+       .addAddNextHop("/world", face1, 30)
+       .addRemoveNextHop("/world/none", face2);
+  auto command = makeBatchUpdateRequest(batch);
+
+  m_responses.clear();
+  receiveInterest(command);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, command->getName(),
+                                  ControlResponse(200, "Success").setBody(batch.wireEncode())),
+                    CheckResponseResult::OK);
+
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face2, 20), CheckNextHopResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/world", 1, face1, 30), CheckNextHopResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/world/none"), CheckNextHopResult::NO_FIB_ENTRY);
+
+  // removing the last nexthop erases the entry
+  FibBatchUpdate removal;
+  removal.addRemoveNextHop("/hello", face2)
+         .addRemoveNextHop("/world", face1);
+  receiveInterest(makeBatchUpdateRequest(removal));
+  BOOST_CHECK_EQUAL(checkNextHop("/hello"), CheckNextHopResult::NO_FIB_ENTRY);
+  BOOST_CHECK_EQUAL(checkNextHop("/world"), CheckNextHopResult::NO_FIB_ENTRY);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownFaceIdIsAtomic)
+{
+  FaceId face1 = addFace();
+  FaceId unknownFace = face1 + 100;
+
+  FibBatchUpdate batch;
+  batch.addAddNextHop("/hello", face1, 10)
+       .addRemoveNextHop("/world", unknownFace) // not an error
+       .addAddNextHop("/world", unknownFace, 20);
+  auto command = makeBatchUpdateRequest(batch);
+
+  receiveInterest(command);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, command->getName(),
+                                  makeResponse(410, "Face not found",
+                                               ControlParameters().setFaceId(unknownFace))),
+                    CheckResponseResult::OK);
+
+  // the valid change preceding the failed one is not applied either
+  BOOST_CHECK_EQUAL(checkNextHop("/hello"), CheckNextHopResult::NO_FIB_ENTRY);
+  BOOST_CHECK_EQUAL(checkNextHop("/world"), CheckNextHopResult::NO_FIB_ENTRY);
+}
+
+BOOST_AUTO_TEST_CASE(ImplicitFaceId)
+{
+  FaceId face1 = addFace();
+
+  FibBatchUpdate batch;
+  batch.addAddNextHop("/hello", 0, 10)
+       .addAddNextHop("/world", 0, 20);
+  auto command = makeBatchUpdateRequest(batch);
+  command->setTag(make_shared<lp::IncomingFaceIdTag>(face1));
+
+  receiveInterest(command);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, face1, 10), CheckNextHopResult::OK);
+  BOOST_CHECK_EQUAL(checkNextHop("/world", 1, face1, 20), CheckNextHopResult::OK);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // BatchUpdate
+
 // @todo Remove when ndn::nfd::FibEntry implements operator!= and operator<<
 class FibEntry : public ndn::nfd::FibEntry
 {
@@ -476,7 +592,7 @@ BOOST_AUTO_TEST_CASE(FibDataset)
     const auto& nextHops = matchedEntry->getNextHops();
     for (auto&& next : nextHops) {
       ndn::nfd::NextHopRecord nextHopRecord;
-      nextHopRecord.setFaceId(next.getFace()->getId());
+      nextHopRecord.setFaceId(next.getFace().getId());
       nextHopRecord.setCost(next.getCost());
       record.addNextHopRecord(nextHopRecord);
     }
@@ -24,9 +24,13 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "core/nfd-tlv.hpp"
+#include "fw/interest-scheduler.hpp"
+#include "fw/vehicular-priority-strategy.hpp"
 #include "version.hpp"
 
 #include "manager-common-fixture.hpp"
+#include "../face/dummy-face.hpp"
 
 namespace nfd {
 namespace tests {
@@ -97,6 +101,45 @@ BOOST_AUTO_TEST_CASE(GeneralStatus)
   // TODO#3325 check packet counter values
 }
 
+BOOST_AUTO_TEST_CASE(InterestSchedulerCounters)
+{
+  auto downstream = make_shared<DummyFace>();
+  auto upstream = make_shared<DummyFace>();
+  m_forwarder.addFace(downstream);
+  m_forwarder.addFace(upstream);
+  auto insertPitEntry = [&] (const Name& name, time::milliseconds lifetime) {
+    shared_ptr<Interest> interest = makeInterest(name);
+    interest->setInterestLifetime(lifetime);
+    shared_ptr<pit::Entry> pitEntry = m_forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(downstream, *interest);
+    return pitEntry;
+  };
+
+  fw::InterestScheduler* scheduler = m_forwarder.getStrategyChoice()
+    .getStrategy(fw::VehicularPriorityStrategy::STRATEGY_NAME)->getInterestScheduler();
+  BOOST_REQUIRE(scheduler != nullptr);
+  scheduler->setRate(1);
+  // the first Interest takes the token, the second cannot be sent in time, the third waits
+  scheduler->schedule(insertPitEntry("/A/0", time::seconds(4)), upstream, time::milliseconds(10));
+  scheduler->schedule(insertPitEntry("/A/1", time::milliseconds(100)), upstream, time::milliseconds(200));
+  scheduler->schedule(insertPitEntry("/A/2", time::seconds(4)), upstream, time::milliseconds(10));
+
+  auto request = makeInterest("ndn:/localhost/nfd/status/general");
+  request->setMustBeFresh(true);
+  request->setChildSelector(1);
+  this->receiveInterest(request);
+
+  Block response = this->concatenateResponses(0, m_responses.size());
+  BOOST_REQUIRE_NO_THROW(ndn::nfd::ForwarderStatus(response));
+  response.parse();
+  BOOST_REQUIRE(response.find(tlv::NSchedulerSent) != response.elements_end());
+  BOOST_REQUIRE(response.find(tlv::NDeadlineMisses) != response.elements_end());
+  BOOST_REQUIRE(response.find(tlv::NSchedulerQueued) != response.elements_end());
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*response.find(tlv::NSchedulerSent)), 1);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*response.find(tlv::NDeadlineMisses)), 1);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(*response.find(tlv::NSchedulerQueued)), 1);
+}
+
 BOOST_AUTO_TEST_CASE(GeneralStatusLegacy) // request GeneralStatus with legacy name
 {
   auto request = makeInterest("ndn:/localhost/nfd/status");
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/strategy-choice-manager.hpp"
+#include "core/nfd-tlv.hpp"
 #include "manager-common-fixture.hpp"
 
 #include "face/face.hpp"
@@ -31,6 +32,8 @@
 #include "table/name-tree.hpp"
 #include "table/strategy-choice.hpp"
 #include "fw/strategy.hpp"
+#include "fw/interface-weights.hpp"
+#include "fw/preferred-wlan-strategy.hpp"
 #include "tests/daemon/face/dummy-face.hpp"
 #include "tests/daemon/fw/dummy-strategy.hpp"
 
@@ -163,6 +166,52 @@ BOOST_AUTO_TEST_CASE(UnsetStrategy)
   BOOST_CHECK_EQUAL(findStrategy("/test"), "/localhost/nfd/strategy/test-strategy-a"); // parent
 }
 
+BOOST_AUTO_TEST_CASE(SetInterfaceWeights)
+{
+  auto testSetWeights = [this] (const ControlParameters& parameters) -> Name {
+    m_responses.clear();
+    auto command = makeControlCommandRequest("/localhost/nfd/strategy-choice/set-weights", parameters);
+    receiveInterest(command);
+    return command->getName();
+  };
+
+  installStrategy("/localhost/nfd/strategy/test-strategy-a");
+
+  const Name& wlanStrategyName = fw::PreferredWlanStrategy::STRATEGY_NAME;
+  fw::InterfaceWeights* weights = m_strategyChoice.getStrategy(wlanStrategyName)->getInterfaceWeights();
+  BOOST_REQUIRE(weights != nullptr);
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 2);
+
+  auto parameters = ControlParameters().setName(wlanStrategyName.getPrefix(-1)).setUri("eth0=1,eth1=2");
+  auto commandName = testSetWeights(parameters); // succeed, unversioned name
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  parameters.setName(wlanStrategyName);
+  BOOST_CHECK_EQUAL(checkResponse(0, commandName, makeResponse(200, "OK", parameters)),
+                    CheckResponseResult::OK);
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 1);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 2);
+  BOOST_CHECK_EQUAL(weights->get("wlan0"), 1); // unchanged
+
+  commandName = testSetWeights(ControlParameters().setName(wlanStrategyName).setUri("eth0")); // malformed
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, commandName, ControlResponse(400, "Malformed interface weights")),
+                    CheckResponseResult::OK);
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 1);
+
+  commandName = testSetWeights(ControlParameters().setName("/localhost/nfd/strategy/test-strategy-b")
+                                                  .setUri("eth0=1")); // not installed
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, commandName, ControlResponse(504, "Unsupported strategy")),
+                    CheckResponseResult::OK);
+
+  commandName = testSetWeights(ControlParameters().setName("/localhost/nfd/strategy/test-strategy-a")
+                                                  .setUri("eth0=1")); // no interface weights
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, commandName,
+                                  ControlResponse(405, "Strategy does not use interface weights")),
+                    CheckResponseResult::OK);
+}
+
 // @todo Remove when ndn::nfd::StrategyChoice implements operator!= and operator<<
 class StrategyChoice : public ndn::nfd::StrategyChoice
 {
@@ -241,6 +290,54 @@ BOOST_AUTO_TEST_CASE(ListChoices)
                                 expectedRecords.begin(), expectedRecords.end());
 }
 
+BOOST_AUTO_TEST_CASE(ListCongestionStatus)
+{
+  const Name strategyName("/strategy-congestion");
+  auto strategy = make_shared<DummyStrategy>(ref(m_forwarder), strategyName);
+  m_strategyChoice.install(strategy);
+  // chosen for two namespaces, but listed once
+  m_strategyChoice.insert("/A", strategyName);
+  m_strategyChoice.insert("/B", strategyName);
+
+  fw::Strategy::CongestionStatus status;
+  status.faceId = 300;
+  status.window = 12.7;
+  status.nInFlight = 12;
+  status.nQueued = 3;
+  strategy->congestionStatus.push_back(status);
+  status.faceId = 301;
+  status.window = 1.0;
+  status.nInFlight = 0;
+  status.nQueued = 0;
+  strategy->congestionStatus.push_back(status);
+
+  receiveInterest(makeInterest("/localhost/nfd/strategy-choice/congestion"));
+
+  Block content;
+  BOOST_CHECK_NO_THROW(content = concatenateResponses());
+  BOOST_CHECK_NO_THROW(content.parse());
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  Block entry = content.elements()[0];
+  BOOST_CHECK_EQUAL(entry.type(), tlv::CongestionStatus);
+  entry.parse();
+  BOOST_REQUIRE_EQUAL(entry.elements().size(), 5);
+  BOOST_CHECK_EQUAL(Name(entry.elements()[0]), strategyName);
+  BOOST_CHECK_EQUAL(entry.elements()[1].type(), ndn::tlv::nfd::FaceId);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[1]), 300);
+  BOOST_CHECK_EQUAL(entry.elements()[2].type(), tlv::CongestionWindow);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[2]), 12);
+  BOOST_CHECK_EQUAL(entry.elements()[3].type(), tlv::NInFlightInterests);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[3]), 12);
+  BOOST_CHECK_EQUAL(entry.elements()[4].type(), tlv::NQueuedInterests);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[4]), 3);
+
+  entry = content.elements()[1];
+  entry.parse();
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[1]), 301);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(entry.elements()[2]), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyChoiceManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
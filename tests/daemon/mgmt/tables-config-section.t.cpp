@@ -25,7 +25,10 @@
 
 #include "mgmt/tables-config-section.hpp"
 #include "fw/forwarder.hpp"
-
+#include "fw/interface-weights.hpp"
+#include "fw/preferred-wlan-strategy.hpp"
+#include "fw/interest-scheduler.hpp"
+#include "fw/vehicular-priority-strategy.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/daemon/fw/dummy-strategy.hpp"
@@ -171,6 +174,70 @@ BOOST_AUTO_TEST_CASE(InvalidValueCsMaxPackets)
 
 BOOST_AUTO_TEST_SUITE_END() // Cs
 
+BOOST_AUTO_TEST_SUITE(Pit)
+
+BOOST_AUTO_TEST_CASE(ValidPitQuota)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  pit_max_entries 2\n"
+    "  pit_max_entries_per_face 1\n"
+    "  pit_prefix_quota\n"
+    "  {\n"
+    "    /A 1\n"
+    "  }\n"
+    "}\n";
+
+  PitQuota& quota = m_pit.getQuota();
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(quota.getCapacity(), PitQuota::UNLIMITED);
+  BOOST_CHECK_EQUAL(quota.getFaceQuota(), PitQuota::UNLIMITED);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(quota.getCapacity(), 2);
+  BOOST_CHECK_EQUAL(quota.getFaceQuota(), 1);
+  quota.afterInsert("/A/1", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/2", 257, 1), PitQuota::REJECT_PREFIX);
+
+  // options are reset when absent
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(quota.getCapacity(), PitQuota::UNLIMITED);
+  BOOST_CHECK_EQUAL(quota.getFaceQuota(), PitQuota::UNLIMITED);
+  BOOST_CHECK_EQUAL(quota.check("/A/2", 257, 1), PitQuota::REJECT_NONE);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidPitMaxEntries)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  pit_max_entries invalid\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DuplicatePitPrefixQuota)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  pit_prefix_quota\n"
+    "  {\n"
+    "    /A 1\n"
+    "    /A 2\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Pit
+
 BOOST_AUTO_TEST_SUITE(ConfigStrategy)
 
 BOOST_AUTO_TEST_CASE(Unversioned)
@@ -381,6 +448,311 @@ BOOST_AUTO_TEST_CASE(Reload)
 
 BOOST_AUTO_TEST_SUITE_END() // NetworkRegion
 
+BOOST_AUTO_TEST_SUITE(InterfaceWeights)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/preferred-wlan\n"
+    "    {\n"
+    "      eth1 2\n"
+    "      wlan1 1\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  fw::Strategy* strategy = m_strategyChoice.getStrategy(fw::PreferredWlanStrategy::STRATEGY_NAME);
+  BOOST_REQUIRE(strategy != nullptr);
+  fw::InterfaceWeights* weights = strategy->getInterfaceWeights();
+  BOOST_REQUIRE(weights != nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 0);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 2);
+  BOOST_CHECK_EQUAL(weights->get("wlan1"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Reload)
+{
+  const std::string CONFIG_WITH_WEIGHTS =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/preferred-wlan\n"
+    "    {\n"
+    "      eth1 2\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  const std::string CONFIG_WITHOUT_STRATEGY =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "  }\n"
+    "}\n";
+
+  fw::Strategy* strategy = m_strategyChoice.getStrategy(fw::PreferredWlanStrategy::STRATEGY_NAME);
+  BOOST_REQUIRE(strategy != nullptr);
+  fw::InterfaceWeights* weights = strategy->getInterfaceWeights();
+  BOOST_REQUIRE(weights != nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITH_WEIGHTS, false));
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 0);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 2);
+
+  // removed subsection restores built-in weights
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITHOUT_STRATEGY, false));
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 0);
+
+  // removed section restores built-in weights, also after a management update
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITH_WEIGHTS, false));
+  weights->set("wlan0", 7);
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(weights->get("eth0"), 2);
+  BOOST_CHECK_EQUAL(weights->get("eth1"), 0);
+  BOOST_CHECK_EQUAL(weights->get("wlan0"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(NonExisting)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/test-doesnt-exist\n"
+    "    {\n"
+    "      eth0 1\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(WithoutWeights)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/best-route\n"
+    "    {\n"
+    "      eth0 1\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidWeight)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interface_weights\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/preferred-wlan\n"
+    "    {\n"
+    "      eth0 high\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // InterfaceWeights
+
+BOOST_AUTO_TEST_SUITE(InterestScheduling)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      rate 500\n"
+    "      burst 10\n"
+    "      priority\n"
+    "      {\n"
+    "        /vehicle/control 0\n"
+    "        /vehicle/video 2\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  fw::Strategy* strategy = m_strategyChoice.getStrategy(fw::VehicularPriorityStrategy::STRATEGY_NAME);
+  BOOST_REQUIRE(strategy != nullptr);
+  fw::InterestScheduler* scheduler = strategy->getInterestScheduler();
+  BOOST_REQUIRE(scheduler != nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 0);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/control/brake"),
+                    fw::InterestScheduler::DEFAULT_PRIORITY_CLASS);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 500);
+  BOOST_CHECK_EQUAL(scheduler->getBurst(), 10);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/control/brake"), 0);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/video/1"), 2);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/other"),
+                    fw::InterestScheduler::DEFAULT_PRIORITY_CLASS);
+}
+
+BOOST_AUTO_TEST_CASE(Reload)
+{
+  const std::string CONFIG_WITH_SCHEDULER =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      rate 500\n"
+    "      priority\n"
+    "      {\n"
+    "        /vehicle/control 0\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  const std::string CONFIG_WITHOUT_STRATEGY =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "  }\n"
+    "}\n";
+
+  fw::Strategy* strategy = m_strategyChoice.getStrategy(fw::VehicularPriorityStrategy::STRATEGY_NAME);
+  BOOST_REQUIRE(strategy != nullptr);
+  fw::InterestScheduler* scheduler = strategy->getInterestScheduler();
+  BOOST_REQUIRE(scheduler != nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITH_SCHEDULER, false));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 500);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/control/brake"), 0);
+
+  // dry run does not change the scheduler
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITHOUT_STRATEGY, true));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 500);
+
+  // removed subsection removes rate limit and priority classes
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITHOUT_STRATEGY, false));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 0);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/control/brake"),
+                    fw::InterestScheduler::DEFAULT_PRIORITY_CLASS);
+
+  // removed section does the same
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG_WITH_SCHEDULER, false));
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(scheduler->getRate(), 0);
+  BOOST_CHECK_EQUAL(scheduler->getPriorityClass("/vehicle/control/brake"),
+                    fw::InterestScheduler::DEFAULT_PRIORITY_CLASS);
+}
+
+BOOST_AUTO_TEST_CASE(WithoutScheduler)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/best-route\n"
+    "    {\n"
+    "      rate 500\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidOption)
+{
+  const std::string CONFIG1 =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      rate -1\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(runConfig(CONFIG1, true), ConfigFile::Error);
+
+  const std::string CONFIG2 =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      burst 0\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(runConfig(CONFIG2, true), ConfigFile::Error);
+
+  const std::string CONFIG3 =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      priority\n"
+    "      {\n"
+    "        /vehicle/control high\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(runConfig(CONFIG3, true), ConfigFile::Error);
+
+  const std::string CONFIG4 =
+    "tables\n"
+    "{\n"
+    "  interest_scheduling\n"
+    "  {\n"
+    "    /localhost/nfd/strategy/vehicular-priority\n"
+    "    {\n"
+    "      queue_length 10\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+  BOOST_CHECK_THROW(runConfig(CONFIG4, true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // InterestScheduling
+
 BOOST_AUTO_TEST_SUITE_END() // TestTableConfigSection
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
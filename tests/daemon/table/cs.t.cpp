@@ -353,6 +353,24 @@ BOOST_AUTO_TEST_CASE(CachePolicyNoCache)
           bind([] { BOOST_CHECK(true); }));
 }
 
+BOOST_AUTO_TEST_CASE(CopyFromLargerBuffer)
+{
+  Cs cs(3);
+
+  // Data decoded from a larger packet buffer is copied out
+  Block dataWire = makeData("ndn:/A")->wireEncode();
+  auto packet = make_shared<Buffer>(dataWire.size() + 16);
+  std::copy(dataWire.begin(), dataWire.end(), packet->begin() + 8);
+  auto data = make_shared<Data>(Block(packet, packet->begin() + 8,
+                                      packet->begin() + 8 + dataWire.size()));
+  cs.insert(*data);
+
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  const Data& cached = cs.begin()->getData();
+  BOOST_CHECK(cached.wireEncode() == dataWire);
+  BOOST_CHECK_EQUAL(cached.wireEncode().getBuffer()->size(), dataWire.size());
+}
+
 BOOST_AUTO_TEST_CASE(Enumeration)
 {
   Cs cs;
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cuckoo-dead-nonce-list.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TableCuckooDeadNonceList, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const uint32_t nonce1 = 0x53b4eaa8;
+  const uint32_t nonce2 = 0x1f46372b;
+
+  CuckooDeadNonceList dnl;
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
+}
+
+BOOST_AUTO_TEST_CASE(MinLifetime)
+{
+  BOOST_CHECK_THROW(CuckooDeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Grow)
+{
+  const uint32_t N_NONCES = CuckooDeadNonceList::MIN_SLICE_CAPACITY * 40;
+  Name name("ndn:/N");
+
+  CuckooDeadNonceList dnl;
+  for (uint32_t nonce = 0; nonce < N_NONCES; ++nonce) {
+    dnl.add(name, nonce);
+  }
+  BOOST_CHECK_EQUAL(dnl.size(), N_NONCES);
+  BOOST_CHECK_GT(dnl.m_slices[dnl.m_current].size(), 1);
+
+  size_t nFound = 0;
+  for (uint32_t nonce = 0; nonce < N_NONCES; ++nonce) {
+    nFound += dnl.has(name, nonce);
+  }
+  BOOST_CHECK_EQUAL(nFound, N_NONCES);
+}
+
+BOOST_FIXTURE_TEST_CASE(Lifetime, UnitTestTimeFixture)
+{
+  const time::nanoseconds LIFETIME = time::milliseconds(200);
+  const time::nanoseconds TICK = LIFETIME / CuckooDeadNonceList::N_SLICES / 2;
+  CuckooDeadNonceList dnl(LIFETIME);
+  BOOST_CHECK_EQUAL(dnl.getLifetime(), LIFETIME);
+
+  this->advanceClocks(TICK, LIFETIME * 3);
+
+  Name nameC("ndn:/C");
+  const uint32_t nonceC = 0x25390656;
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocks(TICK, LIFETIME / 2); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocks(TICK, LIFETIME); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(SliceCapacity, UnitTestTimeFixture)
+{
+  const time::nanoseconds LIFETIME = time::milliseconds(200);
+  const time::nanoseconds SLICE = LIFETIME / CuckooDeadNonceList::N_SLICES;
+  const size_t RATE = CuckooDeadNonceList::MIN_SLICE_CAPACITY * 8; // Nonces per slice
+  CuckooDeadNonceList dnl(LIFETIME);
+  Name name("ndn:/N");
+
+  uint32_t nonce = 0;
+  for (size_t i = 0; i < CuckooDeadNonceList::N_SLICES * 3; ++i) {
+    for (size_t j = 0; j < RATE; ++j) {
+      dnl.add(name, ++nonce);
+    }
+    this->advanceClocks(SLICE);
+  }
+
+  // after warming up, each slice is sized for the observed rate in a single filter
+  BOOST_CHECK_EQUAL(dnl.m_slices[dnl.m_current].size(), 1);
+  BOOST_CHECK_GE(dnl.m_slices[dnl.m_current].front()->getCapacity(), RATE);
+  BOOST_CHECK_LE(dnl.size(), RATE * (CuckooDeadNonceList::N_SLICES + 1));
+  BOOST_CHECK_EQUAL(dnl.has(name, nonce), true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cuckoo-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TableCuckooFilter, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  CuckooFilter filter(64);
+  BOOST_CHECK_GE(filter.getCapacity(), 64);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.contains(0x3a3e5c7bd1f25edcULL), false);
+
+  BOOST_CHECK_EQUAL(filter.insert(0x3a3e5c7bd1f25edcULL), true);
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK_EQUAL(filter.contains(0x3a3e5c7bd1f25edcULL), true);
+  BOOST_CHECK_EQUAL(filter.contains(0x6e1b3cf1a92473e0ULL), false);
+
+  filter.clear();
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.contains(0x3a3e5c7bd1f25edcULL), false);
+}
+
+BOOST_AUTO_TEST_CASE(Full)
+{
+  CuckooFilter filter(1024);
+
+  std::vector<CuckooFilter::Hash> inserted;
+  CuckooFilter::Hash hash = 0x9e3779b97f4a7c15ULL;
+  while (inserted.size() <= filter.getCapacity()) {
+    hash = hash * 6364136223846793005ULL + 1442695040888963407ULL;
+    if (!filter.insert(hash)) {
+      break;
+    }
+    inserted.push_back(hash);
+  }
+
+  // the filter must fill up before exceeding its capacity, and then refuse insertion
+  BOOST_CHECK_LE(inserted.size(), filter.getCapacity());
+  BOOST_CHECK_GT(inserted.size(), filter.getCapacity() / 2);
+  BOOST_CHECK_EQUAL(filter.size(), inserted.size());
+  BOOST_CHECK_EQUAL(filter.insert(~hash), false);
+
+  // no false negatives
+  for (CuckooFilter::Hash h : inserted) {
+    BOOST_CHECK_EQUAL(filter.contains(h), true);
+  }
+
+  filter.clear();
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.insert(hash), true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
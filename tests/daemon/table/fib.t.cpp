@@ -53,14 +53,14 @@ BOOST_AUTO_TEST_CASE(Entry)
   const fib::NextHopList& nexthops2 = entry.getNextHops();
   // [(face1,20)]
   BOOST_CHECK_EQUAL(nexthops2.size(), 1);
-  BOOST_CHECK_EQUAL(nexthops2.begin()->getFace(), face1);
+  BOOST_CHECK_EQUAL(&nexthops2.begin()->getFace(), face1.get());
   BOOST_CHECK_EQUAL(nexthops2.begin()->getCost(), 20);
 
   entry.addNextHop(face1, 30);
   const fib::NextHopList& nexthops3 = entry.getNextHops();
   // [(face1,30)]
   BOOST_CHECK_EQUAL(nexthops3.size(), 1);
-  BOOST_CHECK_EQUAL(nexthops3.begin()->getFace(), face1);
+  BOOST_CHECK_EQUAL(&nexthops3.begin()->getFace(), face1.get());
   BOOST_CHECK_EQUAL(nexthops3.begin()->getCost(), 30);
 
   entry.addNextHop(face2, 40);
@@ -73,11 +73,11 @@ BOOST_AUTO_TEST_CASE(Entry)
     ++i;
     switch (i) {
       case 0:
-        BOOST_CHECK_EQUAL(it->getFace(), face1);
+        BOOST_CHECK_EQUAL(&it->getFace(), face1.get());
         BOOST_CHECK_EQUAL(it->getCost(), 30);
         break;
       case 1:
-        BOOST_CHECK_EQUAL(it->getFace(), face2);
+        BOOST_CHECK_EQUAL(&it->getFace(), face2.get());
         BOOST_CHECK_EQUAL(it->getCost(), 40);
         break;
     }
@@ -93,11 +93,11 @@ BOOST_AUTO_TEST_CASE(Entry)
     ++i;
     switch (i) {
       case 0:
-        BOOST_CHECK_EQUAL(it->getFace(), face2);
+        BOOST_CHECK_EQUAL(&it->getFace(), face2.get());
         BOOST_CHECK_EQUAL(it->getCost(), 10);
         break;
       case 1:
-        BOOST_CHECK_EQUAL(it->getFace(), face1);
+        BOOST_CHECK_EQUAL(&it->getFace(), face1.get());
         BOOST_CHECK_EQUAL(it->getCost(), 30);
         break;
     }
@@ -107,14 +107,14 @@ BOOST_AUTO_TEST_CASE(Entry)
   const fib::NextHopList& nexthops6 = entry.getNextHops();
   // [(face2,10)]
   BOOST_CHECK_EQUAL(nexthops6.size(), 1);
-  BOOST_CHECK_EQUAL(nexthops6.begin()->getFace(), face2);
+  BOOST_CHECK_EQUAL(&nexthops6.begin()->getFace(), face2.get());
   BOOST_CHECK_EQUAL(nexthops6.begin()->getCost(), 10);
 
   entry.removeNextHop(face1);
   const fib::NextHopList& nexthops7 = entry.getNextHops();
   // [(face2,10)]
   BOOST_CHECK_EQUAL(nexthops7.size(), 1);
-  BOOST_CHECK_EQUAL(nexthops7.begin()->getFace(), face2);
+  BOOST_CHECK_EQUAL(&nexthops7.begin()->getFace(), face2.get());
   BOOST_CHECK_EQUAL(nexthops7.begin()->getCost(), 10);
 
   entry.removeNextHop(face2);
@@ -128,6 +128,34 @@ BOOST_AUTO_TEST_CASE(Entry)
   BOOST_CHECK_EQUAL(nexthops9.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ManyNextHops)
+{
+  fib::Entry entry("ndn:/ihA2VbQK");
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < fib::NextHopList::N_INLINE + 2; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+    entry.addNextHop(faces.back(), 100 - i);
+  }
+  // nexthops overflow into a vector
+
+  const fib::NextHopList& nexthops = entry.getNextHops();
+  BOOST_REQUIRE_EQUAL(nexthops.size(), faces.size());
+  for (size_t i = 0; i < faces.size(); ++i) {
+    BOOST_CHECK_EQUAL(&nexthops.begin()[i].getFace(), faces[faces.size() - 1 - i].get());
+  }
+
+  entry.removeNextHop(faces[0]);
+  entry.removeNextHop(faces[3]);
+  entry.removeNextHop(faces[5]);
+  // nexthops are stored inline again
+  BOOST_REQUIRE_EQUAL(nexthops.size(), 3);
+  BOOST_CHECK_EQUAL(&nexthops.begin()[0].getFace(), faces[4].get());
+  BOOST_CHECK_EQUAL(&nexthops.begin()[1].getFace(), faces[2].get());
+  BOOST_CHECK_EQUAL(&nexthops.begin()[2].getFace(), faces[1].get());
+  BOOST_CHECK_EQUAL(entry.hasNextHop(faces[3]), false);
+  BOOST_CHECK_EQUAL(entry.hasNextHop(faces[2]), true);
+}
+
 BOOST_AUTO_TEST_CASE(Insert_LongestPrefixMatch)
 {
   Name nameEmpty;
@@ -319,7 +347,7 @@ BOOST_AUTO_TEST_CASE(RemoveNextHopFromAllEntries)
   BOOST_CHECK_EQUAL(entry->getPrefix(), nameA);
   const fib::NextHopList& nexthopsA = entry->getNextHops();
   BOOST_CHECK_EQUAL(nexthopsA.size(), 1);
-  BOOST_CHECK_EQUAL(nexthopsA.begin()->getFace(), face2);
+  BOOST_CHECK_EQUAL(&nexthopsA.begin()->getFace(), face2.get());
 
   entry = fib.findLongestPrefixMatch(nameB);
   BOOST_CHECK_EQUAL(entry->getPrefix(), nameEmpty);
@@ -341,6 +369,40 @@ BOOST_AUTO_TEST_CASE(RemoveNextHopFromManyEntries)
   BOOST_CHECK_EQUAL(fib.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(RemoveNextHopFaceIndex)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  shared_ptr<fib::Entry> entryA = fib.insert("/A").first;
+  entryA->addNextHop(face1, 0);
+  entryA->addNextHop(face2, 0);
+  shared_ptr<fib::Entry> entryB = fib.insert("/B").first;
+  entryB->addNextHop(face1, 0);
+  shared_ptr<fib::Entry> entryC = fib.insert("/C").first;
+  entryC->addNextHop(face1, 0);
+  entryC->removeNextHop(face1);
+  entryC->addNextHop(face2, 0);
+
+  // erased entry is not affected
+  fib.erase("/B");
+  entryB->addNextHop(face2, 0);
+  BOOST_CHECK_EQUAL(fib.size(), 2);
+
+  fib.removeNextHopFromAllEntries(face1);
+  BOOST_CHECK_EQUAL(fib.size(), 2);
+  BOOST_CHECK_EQUAL(entryA->hasNextHop(face1), false);
+  BOOST_CHECK_EQUAL(entryA->hasNextHop(face2), true);
+  BOOST_CHECK_EQUAL(entryB->hasNextHop(face1), true);
+  BOOST_CHECK_EQUAL(entryC->hasNextHop(face2), true);
+
+  fib.removeNextHopFromAllEntries(face2);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+  BOOST_CHECK_EQUAL(entryB->hasNextHop(face2), true);
+}
+
 void
 validateFindExactMatch(const Fib& fib, const Name& target)
 {
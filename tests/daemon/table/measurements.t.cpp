@@ -231,6 +231,38 @@ BOOST_AUTO_TEST_CASE(Lifetime)
   BOOST_CHECK_EQUAL(measurements.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(LifetimeBeyondTimingWheel)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  measurements.get(nameB);
+
+  // repeatedly extended, as a strategy would do on every Data
+  const time::nanoseconds EXTEND_A = time::seconds(100);
+  for (int i = 0; i < 10; ++i) {
+    this->advanceClocks(time::milliseconds(100));
+    measurements.extendLifetime(*measurements.get(nameA), EXTEND_A);
+  }
+  // A expires at EXTEND_A + 1s
+
+  // entry is re-filed each time its slot comes around, including past a full wheel revolution
+  this->advanceClocks(time::milliseconds(500), EXTEND_A - time::seconds(1));
+  BOOST_CHECK(measurements.findExactMatch(nameA) != nullptr);
+  BOOST_CHECK(measurements.findExactMatch(nameB) == nullptr);
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+
+  this->advanceClocks(time::milliseconds(500), time::seconds(1) + Measurements::getTimingWheelTick());
+  BOOST_CHECK(measurements.findExactMatch(nameA) == nullptr);
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+
+  // timing wheel restarts after becoming idle
+  measurements.get(nameB);
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+  this->advanceClocks(time::milliseconds(500),
+                      Measurements::getInitialLifetime() + Measurements::getTimingWheelTick());
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   size_t nNameTreeEntriesBefore = nameTree.size();
@@ -55,6 +55,30 @@ BOOST_AUTO_TEST_CASE(InProducerRegion)
   BOOST_CHECK_EQUAL(nrt4.isInProducerRegion(*link), true);
 }
 
+BOOST_AUTO_TEST_CASE(InsertClear)
+{
+  shared_ptr<Link> link = makeLink("/net/ndnsim", {{10, "/telia/terabits"}, {20, "/ucla/cs"}});
+
+  NetworkRegionTable nrt;
+  BOOST_CHECK(nrt.empty());
+  uint64_t version0 = nrt.getVersion();
+
+  BOOST_CHECK_EQUAL(nrt.insert("/ucla/cs/irl").second, true);
+  BOOST_CHECK_EQUAL(nrt.insert("/ucla/cs/irl").second, false);
+  BOOST_CHECK_EQUAL(nrt.size(), 1);
+  BOOST_CHECK(nrt.find("/ucla/cs/irl") != nrt.end());
+  // prefixes of a region name are indexed, but are not region names themselves
+  BOOST_CHECK(nrt.find("/ucla/cs") == nrt.end());
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(*link), true);
+  uint64_t version1 = nrt.getVersion();
+  BOOST_CHECK_NE(version1, version0);
+
+  nrt.clear();
+  BOOST_CHECK(nrt.empty());
+  BOOST_CHECK_EQUAL(nrt.isInProducerRegion(*link), false);
+  BOOST_CHECK_NE(nrt.getVersion(), version1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
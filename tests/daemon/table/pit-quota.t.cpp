@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "table/pit-quota.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TablePitQuota, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Unlimited)
+{
+  PitQuota quota;
+  BOOST_CHECK_EQUAL(quota.getCapacity(), PitQuota::UNLIMITED);
+  BOOST_CHECK_EQUAL(quota.getFaceQuota(), PitQuota::UNLIMITED);
+
+  for (int i = 0; i < 100; ++i) {
+    Name name("/A");
+    name.appendNumber(i);
+    BOOST_CHECK_EQUAL(quota.check(name, 256, i), PitQuota::REJECT_NONE);
+    quota.afterInsert(name, 256);
+  }
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(256), 100);
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  PitQuota quota;
+  quota.setCapacity(2);
+
+  BOOST_CHECK_EQUAL(quota.check("/A/1", 256, 0), PitQuota::REJECT_NONE);
+  BOOST_CHECK_EQUAL(quota.check("/A/1", 256, 1), PitQuota::REJECT_NONE);
+  BOOST_CHECK_EQUAL(quota.check("/A/1", 256, 2), PitQuota::REJECT_CAPACITY);
+
+  quota.recordReject(PitQuota::REJECT_CAPACITY, 256);
+  BOOST_CHECK_EQUAL(quota.getCounters().nCapacityRejects, 1);
+  BOOST_REQUIRE(quota.getFaceCounters(256) != nullptr);
+  BOOST_CHECK_EQUAL(quota.getFaceCounters(256)->nCapacityRejects, 1);
+  BOOST_CHECK(quota.getFaceCounters(257) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Face)
+{
+  PitQuota quota;
+  quota.setFaceQuota(2);
+
+  quota.afterInsert("/A/1", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/2", 256, 1), PitQuota::REJECT_NONE);
+  quota.afterInsert("/A/2", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/3", 256, 2), PitQuota::REJECT_FACE);
+  BOOST_CHECK_EQUAL(quota.check("/A/3", 257, 2), PitQuota::REJECT_NONE);
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(256), 2);
+
+  quota.beforeErase("/A/1", 256);
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(256), 1);
+  BOOST_CHECK_EQUAL(quota.check("/A/3", 256, 1), PitQuota::REJECT_NONE);
+
+  quota.recordReject(PitQuota::REJECT_FACE, 256);
+  BOOST_CHECK_EQUAL(quota.getCounters().nFaceRejects, 1);
+  BOOST_CHECK_EQUAL(quota.getFaceCounters(256)->nFaceRejects, 1);
+
+  quota.removeFace(256);
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(256), 0);
+  BOOST_CHECK(quota.getFaceCounters(256) == nullptr);
+  BOOST_CHECK_EQUAL(quota.getCounters().nFaceRejects, 1);
+
+  // erasing an entry of a removed face is harmless
+  quota.beforeErase("/A/2", 256);
+  BOOST_CHECK_EQUAL(quota.getNFaceEntries(256), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Prefix)
+{
+  PitQuota quota;
+  quota.setPrefixQuota("/A", 1);
+  quota.setPrefixQuota("/A/B", 3);
+
+  quota.afterInsert("/A/B/1", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/B/2", 256, 1), PitQuota::REJECT_PREFIX);
+  BOOST_CHECK_EQUAL(quota.check("/C/1", 256, 1), PitQuota::REJECT_NONE);
+
+  // raise quota of /A
+  quota.setPrefixQuota("/A", 2);
+  BOOST_CHECK_EQUAL(quota.check("/A/B/2", 256, 1), PitQuota::REJECT_NONE);
+  quota.afterInsert("/A/B/2", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/B/3", 256, 2), PitQuota::REJECT_PREFIX);
+
+  quota.beforeErase("/A/B/1", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/B/3", 256, 1), PitQuota::REJECT_NONE);
+
+  quota.clearPrefixQuotas();
+  quota.afterInsert("/A/B/3", 256);
+  quota.afterInsert("/A/B/4", 256);
+  BOOST_CHECK_EQUAL(quota.check("/A/B/5", 256, 3), PitQuota::REJECT_NONE);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TablePitQuota
+
+} // namespace tests
+} // namespace nfd
@@ -154,6 +154,55 @@ BOOST_AUTO_TEST_CASE(InOutRecords)
   BOOST_CHECK(entry.getOutRecord(*face2) == entry.getOutRecords().end());
 }
 
+BOOST_AUTO_TEST_CASE(InRecordWire)
+{
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Interest> interest1 = makeInterest("ndn:/uWiUzvyp");
+  interest1->setInterestLifetime(time::milliseconds(3279));
+  interest1->setNonce(20587);
+  interest1->setMustBeFresh(true);
+
+  pit::Entry entry(*interest1);
+  pit::InRecordCollection::iterator in1 = entry.insertOrUpdateInRecord(face1, *interest1);
+  BOOST_CHECK(in1->getInterestWire() == interest1->wireEncode());
+
+  const Interest& decoded1 = in1->getInterest();
+  BOOST_CHECK_EQUAL(decoded1, *interest1);
+  BOOST_CHECK(&decoded1 != interest1.get());
+  BOOST_REQUIRE(decoded1.getTag<lp::IncomingFaceIdTag>() != nullptr);
+  BOOST_CHECK_EQUAL(*decoded1.getTag<lp::IncomingFaceIdTag>(), face1->getId());
+  // decoded only once until the next update
+  BOOST_CHECK_EQUAL(&in1->getInterest(), &decoded1);
+
+  // Interest decoded from a larger packet buffer is copied out
+  Block interest2Wire = makeInterest("ndn:/uWiUzvyp")->wireEncode();
+  auto packet = make_shared<Buffer>(interest2Wire.size() + 16);
+  std::copy(interest2Wire.begin(), interest2Wire.end(), packet->begin() + 8);
+  Interest interest2(Block(packet, packet->begin() + 8, packet->begin() + 8 + interest2Wire.size()));
+  in1 = entry.insertOrUpdateInRecord(face1, interest2);
+  BOOST_CHECK(in1->getInterestWire() == interest2Wire);
+  BOOST_CHECK_EQUAL(in1->getInterestWire().getBuffer()->size(), interest2Wire.size());
+  BOOST_CHECK_EQUAL(in1->getInterest().getNonce(), interest2.getNonce());
+}
+
+BOOST_AUTO_TEST_CASE(InterestCopiedOutOfBuffer)
+{
+  shared_ptr<Interest> interest1 = makeInterest("ndn:/Yvd4Vb2L");
+  pit::Entry entry1(*interest1);
+  BOOST_CHECK_EQUAL(&entry1.getInterest(), interest1.get());
+
+  // Interest decoded from a larger packet buffer is copied out
+  Block interest2Wire = makeInterest("ndn:/Yvd4Vb2L")->wireEncode();
+  auto packet = make_shared<Buffer>(interest2Wire.size() + 16);
+  std::copy(interest2Wire.begin(), interest2Wire.end(), packet->begin() + 8);
+  auto interest2 = make_shared<Interest>(Block(packet, packet->begin() + 8,
+                                               packet->begin() + 8 + interest2Wire.size()));
+  pit::Entry entry2(*interest2);
+  BOOST_CHECK_NE(&entry2.getInterest(), interest2.get());
+  BOOST_CHECK_EQUAL(entry2.getInterest(), *interest2);
+  BOOST_CHECK_EQUAL(entry2.getInterest().wireEncode().getBuffer()->size(), interest2Wire.size());
+}
+
 BOOST_AUTO_TEST_CASE(Nonce)
 {
   shared_ptr<Face> face1 = make_shared<DummyFace>();
@@ -506,6 +555,73 @@ BOOST_AUTO_TEST_CASE(MatchFullName) // Bug 3363
   BOOST_CHECK_EQUAL(found->getName(), fullName);
 }
 
+BOOST_AUTO_TEST_CASE(MatchExact)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+
+  shared_ptr<Data> data = makeData("/A/B");
+  auto countMatches = [&] {
+    pit::DataMatchResult matches = pit.findAllDataMatches(*data);
+    BOOST_CHECK_EQUAL(static_cast<size_t>(std::distance(matches.begin(), matches.end())),
+                      matches.size());
+    return matches.size();
+  };
+
+  // exact match entries on Data Name only
+  shared_ptr<Interest> interestAB1 = makeInterest("/A/B");
+  shared_ptr<Interest> interestAB2 = makeInterest("/A/B");
+  interestAB2->setMustBeFresh(true);
+  shared_ptr<pit::Entry> entryAB1 = pit.insert(*interestAB1).first;
+  pit.insert(*interestAB2);
+  shared_ptr<name_tree::Entry> nteAB = nameTree.findExactMatch("/A/B");
+  BOOST_REQUIRE(nteAB != nullptr);
+  BOOST_CHECK_EQUAL(entryAB1->isExactMatch(), true);
+  BOOST_CHECK_EQUAL(nteAB->hasOnlyExactMatchPitEntries(), true);
+  BOOST_CHECK_EQUAL(nteAB->hasPitEntriesInAncestors(), false);
+  BOOST_CHECK_EQUAL(countMatches(), 2);
+
+  // selector that rejects Data
+  shared_ptr<Interest> interestAB3 = makeInterest("/A/B");
+  interestAB3->setMinSuffixComponents(3);
+  shared_ptr<pit::Entry> entryAB3 = pit.insert(*interestAB3).first;
+  BOOST_CHECK_EQUAL(entryAB3->isExactMatch(), false);
+  BOOST_CHECK_EQUAL(nteAB->hasOnlyExactMatchPitEntries(), false);
+  BOOST_CHECK_EQUAL(countMatches(), 2);
+
+  pit.erase(entryAB3);
+  BOOST_CHECK_EQUAL(nteAB->hasOnlyExactMatchPitEntries(), true);
+  BOOST_CHECK_EQUAL(countMatches(), 2);
+
+  // implicit digest
+  shared_ptr<Interest> interestFull = makeInterest(data->getFullName());
+  shared_ptr<pit::Entry> entryFull = pit.insert(*interestFull).first;
+  BOOST_CHECK_EQUAL(entryFull->isExactMatch(), false);
+  BOOST_CHECK_EQUAL(nteAB->hasOnlyExactMatchPitEntries(), false);
+  BOOST_CHECK_EQUAL(countMatches(), 3);
+  pit.erase(entryFull);
+
+  // prefix Interest on ancestor
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<pit::Entry> entryA = pit.insert(*interestA).first;
+  BOOST_CHECK_EQUAL(nteAB->hasPitEntriesInAncestors(), true);
+  BOOST_CHECK_EQUAL(countMatches(), 3);
+  pit.erase(entryA);
+  BOOST_CHECK_EQUAL(nteAB->hasPitEntriesInAncestors(), false);
+
+  // more entries than inline capacity
+  for (int childSelector = 0; childSelector <= 1; ++childSelector) {
+    for (bool mustBeFresh : {false, true}) {
+      shared_ptr<Interest> interest = makeInterest("/A/B");
+      interest->setChildSelector(childSelector);
+      interest->setMustBeFresh(mustBeFresh);
+      pit.insert(*interest);
+    }
+  }
+  BOOST_CHECK_GT(pit.size(), pit::DataMatchResult::N_INLINE);
+  BOOST_CHECK_EQUAL(countMatches(), 6);
+}
+
 BOOST_AUTO_TEST_CASE(Iterator)
 {
   NameTree nameTree(16);
@@ -152,6 +152,42 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithPitEntry)
   BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitFull).getName(), nameQ);
 }
 
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCached)
+{
+  Forwarder forwarder;
+  Name nameP("ndn:/strategy/P");
+  Name nameQ("ndn:/strategy/Q");
+  shared_ptr<Strategy> strategyP = make_shared<DummyStrategy>(ref(forwarder), nameP);
+  shared_ptr<Strategy> strategyQ = make_shared<DummyStrategy>(ref(forwarder), nameQ);
+  StrategyChoice& table = forwarder.getStrategyChoice();
+  table.install(strategyP);
+  table.install(strategyQ);
+
+  BOOST_CHECK(table.insert("/A", nameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<pit::Entry> pitABCD = pit.insert(*makeInterest("/A/B/C/D")).first;
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameP);
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameP);
+
+  // insert between PIT entry and effective StrategyChoice entry
+  BOOST_CHECK(table.insert("/A/B", nameQ));
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameQ);
+
+  // change strategy of effective StrategyChoice entry
+  BOOST_CHECK(table.insert("/A/B", nameP));
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameP);
+
+  // erase effective StrategyChoice entry
+  BOOST_CHECK(table.insert("/A", nameQ));
+  table.erase("/A/B");
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameQ);
+
+  // insert on the PIT entry's own prefix
+  BOOST_CHECK(table.insert("/A/B/C/D", nameP));
+  BOOST_CHECK_EQUAL(table.findEffectiveStrategy(*pitABCD).getName(), nameP);
+}
+
 BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
 {
   Forwarder forwarder;
@@ -75,6 +75,30 @@ public:
   int m_id;
 };
 
+/** \brief a StrategyInfo type stored in a fixed slot
+ */
+class DummySlotStrategyInfo : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1020;
+  }
+
+  DummySlotStrategyInfo(int id)
+    : m_id(id)
+  {
+  }
+
+  int m_id;
+};
+
+static_assert(fw::getStrategyInfoSlot(DummySlotStrategyInfo::getTypeId()) < fw::STRATEGY_INFO_N_SLOTS,
+              "DummySlotStrategyInfo should have a fixed slot");
+static_assert(fw::getStrategyInfoSlot(DummyStrategyInfo::getTypeId()) == fw::STRATEGY_INFO_N_SLOTS,
+              "DummyStrategyInfo should not have a fixed slot");
+
 BOOST_FIXTURE_TEST_SUITE(TableStrategyInfoHost, BaseFixture)
 
 BOOST_AUTO_TEST_CASE(SetGetClear)
@@ -85,15 +109,13 @@ BOOST_AUTO_TEST_CASE(SetGetClear)
 
   g_DummyStrategyInfo_count = 0;
 
-  shared_ptr<DummyStrategyInfo> info = make_shared<DummyStrategyInfo>(7591);
-  host.setStrategyInfo(info);
-  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
-  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
-
-  info.reset(); // unlink local reference
-  // host should still have a reference to info
+  unique_ptr<DummyStrategyInfo> info = make_unique<DummyStrategyInfo>(7591);
+  DummyStrategyInfo* infoPtr = info.get();
+  host.setStrategyInfo(std::move(info));
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>(), infoPtr);
   BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
   BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 7591);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
 
   host.clearStrategyInfo();
   BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
@@ -132,6 +154,23 @@ BOOST_AUTO_TEST_CASE(Types)
 
   BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
   BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 8063);
+
+  BOOST_CHECK(host.getStrategyInfo<DummySlotStrategyInfo>() == nullptr);
+  DummySlotStrategyInfo* slotInfo = host.getOrCreateStrategyInfo<DummySlotStrategyInfo>(4417);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummySlotStrategyInfo>(), slotInfo);
+  BOOST_CHECK_EQUAL(slotInfo->m_id, 4417);
+  BOOST_CHECK_EQUAL(host.getOrCreateStrategyInfo<DummySlotStrategyInfo>(1795), slotInfo);
+
+  host.setStrategyInfo<DummySlotStrategyInfo>(nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummySlotStrategyInfo>() == nullptr);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo2>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo2>()->m_id, 2871);
+
+  host.getOrCreateStrategyInfo<DummySlotStrategyInfo>(4417);
+  host.clearStrategyInfo();
+  BOOST_CHECK(host.getStrategyInfo<DummySlotStrategyInfo>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo2>() == nullptr);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/dead-nonce-list.hpp"
+#include "table/cuckoo-dead-nonce-list.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class DeadNonceListBenchmarkFixture : public BaseFixture
+{
+protected:
+  DeadNonceListBenchmarkFixture()
+    : name("/dead-nonce-list/benchmark/A/B/C")
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief add N_NONCES Nonces, then look up each of them and N_NONCES unknown Nonces
+   */
+  template<typename Dnl>
+  void
+  run(Dnl& dnl, const std::string& label)
+  {
+    time::microseconds d = timedRun([&] {
+      for (uint32_t i = 0; i < N_NONCES; ++i) {
+        dnl.add(name, i);
+      }
+    });
+    BOOST_TEST_MESSAGE(label << " add " << N_NONCES << ": " << d);
+
+    size_t nHits = 0;
+    d = timedRun([&] {
+      for (uint32_t i = 0; i < N_NONCES; ++i) {
+        nHits += dnl.has(name, i);
+      }
+    });
+    BOOST_TEST_MESSAGE(label << " has(hit) " << N_NONCES << ": " << d << ", found " << nHits);
+
+    size_t nFalsePositives = 0;
+    d = timedRun([&] {
+      for (uint32_t i = 0; i < N_NONCES; ++i) {
+        nFalsePositives += dnl.has(name, N_NONCES + i);
+      }
+    });
+    BOOST_TEST_MESSAGE(label << " has(miss) " << N_NONCES << ": " << d <<
+                       ", false positives " << nFalsePositives);
+  }
+
+protected:
+  Name name;
+  /// same as DeadNonceList::MAX_CAPACITY
+  static const uint32_t N_NONCES = (1 << 24);
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableDeadNonceListBenchmark, DeadNonceListBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(MultiIndex)
+{
+  DeadNonceList dnl;
+#ifdef WITH_TESTS
+  // start at MAX_CAPACITY, otherwise it would take many lifetimes to grow there
+  dnl.m_capacity = DeadNonceList::MAX_CAPACITY;
+#else
+  BOOST_TEST_MESSAGE("DeadNonceList is limited to its initial capacity "
+                     "unless compiled with unit tests enabled");
+#endif // WITH_TESTS
+  this->run(dnl, "DeadNonceList");
+}
+
+BOOST_AUTO_TEST_CASE(Cuckoo)
+{
+  CuckooDeadNonceList dnl;
+  this->run(dnl, "CuckooDeadNonceList");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "table/fib.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class FibBenchmarkFixture : public BaseFixture
+{
+protected:
+  FibBenchmarkFixture()
+    : fib(nameTree)
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+    , face3(make_shared<DummyFace>())
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief inserts nRoutes FIB entries with a nexthop toward face
+   */
+  void
+  addRoutes(const Name& prefix, size_t nRoutes, shared_ptr<Face> face)
+  {
+    for (size_t i = 0; i < nRoutes; ++i) {
+      Name name(prefix);
+      name.appendNumber(i % 100).appendNumber(i);
+      fib.insert(name).first->addNextHop(face, 10);
+    }
+  }
+
+  /** \brief removes face from FIB
+   */
+  void
+  removeFace(const std::string& label, shared_ptr<Face> face)
+  {
+    size_t nEntriesBefore = fib.size();
+    time::microseconds d = timedRun([&] {
+      fib.removeNextHopFromAllEntries(face);
+    });
+    BOOST_TEST_MESSAGE(label << " removeNextHopFromAllEntries with " << nEntriesBefore <<
+                       " FIB entries: " << d << ", erased " << (nEntriesBefore - fib.size()));
+  }
+
+protected:
+  NameTree nameTree;
+  Fib fib;
+  shared_ptr<Face> face1;
+  shared_ptr<Face> face2;
+  shared_ptr<Face> face3;
+
+  static const size_t N_ROUTES = 100000;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableFibBenchmark, FibBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(FaceTeardown)
+{
+  // face1 has N_ROUTES routes, some of which are shared with face2
+  this->addRoutes("/wlan", N_ROUTES, face1);
+  this->addRoutes("/wlan", N_ROUTES / 10, face2);
+  this->addRoutes("/cellular", N_ROUTES, face2);
+  // face3 has only a few routes
+  this->addRoutes("/local", 100, face3);
+
+  this->removeFace("few-routes", face3);
+  this->removeFace("many-routes", face1);
+  BOOST_CHECK_EQUAL(fib.size(), N_ROUTES + N_ROUTES / 10);
+}
+
+BOOST_AUTO_TEST_CASE(FaceFlap)
+{
+  this->addRoutes("/cellular", N_ROUTES, face2);
+
+  // a wlan face comes and goes with a small number of routes
+  const size_t N_FLAPS = 100;
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < N_FLAPS; ++i) {
+      this->addRoutes("/wlan", 100, face1);
+      fib.removeNextHopFromAllEntries(face1);
+    }
+  });
+  BOOST_TEST_MESSAGE("flap " << N_FLAPS << " times with " << fib.size() << " FIB entries: " << d);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
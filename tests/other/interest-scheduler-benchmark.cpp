@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/interest-scheduler.hpp"
+#include "fw/forwarder.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd {
+namespace tests {
+
+/** \brief measures latency of control Interests on an uplink saturated by bulk Interests
+ *
+ *  Latency is the time an Interest waits in the scheduler, on the mock clock.
+ */
+class InterestSchedulerBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  InterestSchedulerBenchmarkFixture()
+    : scheduler(bind(&InterestSchedulerBenchmarkFixture::sendInterest, this, _1))
+    , downstream(make_shared<DummyFace>())
+    , upstream(make_shared<DummyFace>())
+    , nControlSent(0)
+    , totalControlLatency(0)
+    , maxControlLatency(0)
+  {
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream);
+    scheduler.setRate(UPLINK_RATE, 10);
+  }
+
+  void
+  sendInterest(const shared_ptr<pit::Entry>& pitEntry)
+  {
+    auto it = controlScheduleTimes.find(pitEntry->getName());
+    if (it != controlScheduleTimes.end()) {
+      time::nanoseconds latency = time::steady_clock::now() - it->second;
+      totalControlLatency += latency;
+      maxControlLatency = std::max(maxControlLatency, latency);
+      ++nControlSent;
+    }
+  }
+
+  void
+  schedule(const Name& name)
+  {
+    shared_ptr<Interest> interest = makeInterest(name);
+    interest->setInterestLifetime(time::seconds(4));
+    shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(downstream, *interest);
+    scheduler.schedule(pitEntry, upstream, time::milliseconds(50));
+  }
+
+  /** \brief offers bulk Interests at 1.2 times the uplink rate, and a control Interest
+   *         every 100ms, for 10 seconds
+   */
+  void
+  run()
+  {
+    static const int N_TICKS = 2000;
+    static const time::milliseconds TICK(5);
+    static const int N_BULK_PER_TICK = UPLINK_RATE * 6 / 5 * 5 / 1000;
+    static const int N_TICKS_PER_CONTROL = 20;
+
+    for (int tick = 0; tick < N_TICKS; ++tick) {
+      for (int i = 0; i < N_BULK_PER_TICK; ++i) {
+        this->schedule(Name("/bulk").appendNumber(tick * N_BULK_PER_TICK + i));
+      }
+      if (tick % N_TICKS_PER_CONTROL == 0) {
+        Name name = Name("/control").appendNumber(tick / N_TICKS_PER_CONTROL);
+        controlScheduleTimes[name] = time::steady_clock::now();
+        this->schedule(name);
+      }
+      this->advanceClocks(TICK);
+    }
+    this->advanceClocks(TICK, time::seconds(5));
+
+    BOOST_TEST_MESSAGE("control sent " << nControlSent << "/" << controlScheduleTimes.size() <<
+                       ", mean latency " << time::duration_cast<time::microseconds>(
+                                              totalControlLatency / std::max<size_t>(nControlSent, 1)) <<
+                       ", max latency " << time::duration_cast<time::microseconds>(maxControlLatency) <<
+                       "; total sent " << scheduler.getCounters().nSent <<
+                       ", deadline missed " << scheduler.getCounters().nDeadlineMissed);
+  }
+
+protected:
+  Forwarder forwarder;
+  fw::InterestScheduler scheduler;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream;
+
+  std::map<Name, time::steady_clock::TimePoint> controlScheduleTimes;
+  size_t nControlSent;
+  time::nanoseconds totalControlLatency;
+  time::nanoseconds maxControlLatency;
+
+  static const int UPLINK_RATE = 1000;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FwInterestSchedulerBenchmark, InterestSchedulerBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(WithoutPriority)
+{
+  this->run();
+}
+
+BOOST_AUTO_TEST_CASE(ControlPriority)
+{
+  scheduler.setPriorityClass("/control", 0);
+  this->run();
+  BOOST_CHECK_EQUAL(nControlSent, controlScheduleTimes.size());
+  BOOST_CHECK_LE(maxControlLatency, time::milliseconds(5));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "table/measurements.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <chrono>
+
+namespace nfd {
+namespace tests {
+
+class MeasurementsBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  MeasurementsBenchmarkFixture()
+    : measurements(nameTree)
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  /** \brief measures wall clock time, which is not affected by the mock clocks
+   */
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    f();
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+    return time::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+  }
+
+protected:
+  NameTree nameTree;
+  Measurements measurements;
+  std::vector<shared_ptr<measurements::Entry>> entries;
+
+  static const size_t N_ENTRIES = 1000000;
+  static const size_t REPEAT = 4;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableMeasurementsBenchmark, MeasurementsBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(ExtendLifetime)
+{
+  entries.reserve(N_ENTRIES);
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < N_ENTRIES; ++i) {
+      Name name("/measurements");
+      name.appendNumber(i % 1000).appendNumber(i);
+      entries.push_back(measurements.get(name));
+    }
+  });
+  BOOST_TEST_MESSAGE("insert " << N_ENTRIES << ": " << d);
+  BOOST_REQUIRE_EQUAL(measurements.size(), N_ENTRIES);
+
+  // every entry is extended on each Data, as AccessStrategy does
+  for (size_t j = 0; j < REPEAT; ++j) {
+    this->advanceClocks(time::milliseconds(500));
+    d = timedRun([&] {
+      for (const shared_ptr<measurements::Entry>& entry : entries) {
+        measurements.extendLifetime(*entry, time::seconds(8));
+      }
+    });
+    BOOST_TEST_MESSAGE("extendLifetime " << N_ENTRIES << ": " << d);
+  }
+
+  // entries that are no longer extended expire in bulk
+  entries.clear();
+  d = timedRun([&] {
+    this->advanceClocks(time::seconds(1), time::seconds(8) + Measurements::getTimingWheelTick());
+  });
+  BOOST_TEST_MESSAGE("expire " << N_ENTRIES << ": " << d);
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <unordered_set>
+
+namespace nfd {
+namespace tests {
+
+class PitBenchmarkFixture : public BaseFixture
+{
+protected:
+  PitBenchmarkFixture()
+    : pit(nameTree)
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief makes N_WORKLOAD Data, and an Interest for each Data
+   *  \param prefixInterval every prefixInterval-th Interest is for the prefix of Data Name
+   *                        instead of Data Name; 0 means all Interests are exact
+   */
+  void
+  makeWorkload(size_t prefixInterval)
+  {
+    interestWorkload.resize(N_WORKLOAD);
+    dataWorkload.resize(N_WORKLOAD);
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      Name name("/pit/benchmark");
+      name.appendNumber(i % 16).appendNumber(i).appendSegment(i % 8);
+      dataWorkload[i] = makeData(name);
+
+      bool isPrefix = prefixInterval > 0 && i % prefixInterval == 0;
+      interestWorkload[i] = makeInterest(isPrefix ? name.getPrefix(-1) : name);
+    }
+  }
+
+  /** \brief inserts every Interest into PIT, then matches and erases for every Data
+   */
+  void
+  run(const std::string& label)
+  {
+    size_t nMatches = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const shared_ptr<Interest>& interest : interestWorkload) {
+          pit.insert(*interest);
+        }
+        for (const shared_ptr<Data>& data : dataWorkload) {
+          pit::DataMatchResult matches = pit.findAllDataMatches(*data);
+          for (const shared_ptr<pit::Entry>& pitEntry : matches) {
+            ++nMatches;
+            pit.erase(pitEntry);
+          }
+        }
+      }
+    });
+    BOOST_REQUIRE_EQUAL(pit.size(), 0);
+    BOOST_TEST_MESSAGE(label << " insert-match-erase " << (N_WORKLOAD * REPEAT) << ": " << d <<
+                       ", matches " << nMatches);
+  }
+
+protected:
+  NameTree nameTree;
+  Pit pit;
+  std::vector<shared_ptr<Interest>> interestWorkload;
+  std::vector<shared_ptr<Data>> dataWorkload;
+
+  static const size_t N_WORKLOAD = 100000;
+  static const size_t REPEAT = 4;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TablePitBenchmark, PitBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(AllExact)
+{
+  this->makeWorkload(0);
+  this->run("exact");
+}
+
+BOOST_AUTO_TEST_CASE(Mixed)
+{
+  this->makeWorkload(4);
+  this->run("mixed(1/4 prefix)");
+}
+
+BOOST_AUTO_TEST_CASE(AllPrefix)
+{
+  this->makeWorkload(1);
+  this->run("prefix");
+}
+
+/** \brief reports memory retained by PIT entries
+ *
+ *  Every PIT entry has an in-record from each of N_DOWNSTREAMS faces. Each Interest is decoded
+ *  from its own packet buffer of PACKET_SIZE octets, as a datagram face would deliver it.
+ *  'decoded' is the footprint when each in-record keeps its decoded Interest and thus the packet
+ *  buffer; 'wire' is the footprint of the in-records as implemented.
+ */
+BOOST_AUTO_TEST_CASE(InRecordFootprint)
+{
+  static const size_t N_ENTRIES = 10000;
+  static const size_t N_DOWNSTREAMS = 4;
+  static const size_t PACKET_SIZE = 1500;
+
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < N_DOWNSTREAMS; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  size_t decodedBytes = 0;
+  for (size_t i = 0; i < N_ENTRIES; ++i) {
+    Name name("/pit/benchmark");
+    name.appendNumber(i);
+
+    for (size_t j = 0; j < N_DOWNSTREAMS; ++j) {
+      Block wire = makeInterest(name, static_cast<uint32_t>(i * N_DOWNSTREAMS + j))->wireEncode();
+      auto packet = make_shared<Buffer>(PACKET_SIZE);
+      std::copy(wire.begin(), wire.end(), packet->begin());
+      auto interest = make_shared<Interest>(Block(packet, packet->begin(),
+                                                  packet->begin() + wire.size()));
+
+      shared_ptr<pit::Entry> entry = pit.insert(*interest).first;
+      entry->insertOrUpdateInRecord(faces[j], *interest);
+      decodedBytes += sizeof(Interest) + PACKET_SIZE;
+    }
+  }
+  BOOST_REQUIRE_EQUAL(pit.size(), N_ENTRIES);
+
+  size_t wireBytes = 0;
+  std::unordered_set<const Buffer*> buffers;
+  for (const pit::Entry& entry : pit) {
+    for (const pit::InRecord& inRecord : entry.getInRecords()) {
+      if (buffers.insert(inRecord.getInterestWire().getBuffer().get()).second) {
+        wireBytes += inRecord.getInterestWire().getBuffer()->size();
+      }
+    }
+  }
+
+  BOOST_TEST_MESSAGE("in-record footprint per PIT entry with " << N_DOWNSTREAMS <<
+                     " downstreams: decoded " << (decodedBytes / N_ENTRIES) <<
+                     " octets, wire " << (wireBytes / N_ENTRIES) << " octets" <<
+                     " (sizeof(pit::InRecord)=" << sizeof(pit::InRecord) << ")");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
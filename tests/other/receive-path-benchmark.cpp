@@ -0,0 +1,422 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/datagram-transport.hpp"
+#include "face/receive-buffer-pool.hpp"
+#include "face/tcp-transport.hpp"
+#include "face/face.hpp"
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <set>
+
+namespace {
+
+// heap allocations made by the whole program, including the receive path
+size_t g_nAllocations = 0;
+size_t g_nAllocatedBytes = 0;
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+  ++g_nAllocations;
+  g_nAllocatedBytes += size;
+  void* p = std::malloc(size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+namespace ip = boost::asio::ip;
+
+/** \brief a LinkService that counts received packets, and releases them right away
+ */
+class CountingLinkService : public LinkService
+{
+public:
+  CountingLinkService()
+    : nReceived(0)
+    , nInPlace(0)
+  {
+  }
+
+private:
+  virtual void
+  doSendInterest(const Interest& interest) DECL_OVERRIDE
+  {
+    BOOST_ASSERT(false);
+  }
+
+  virtual void
+  doSendData(const Data& data) DECL_OVERRIDE
+  {
+    BOOST_ASSERT(false);
+  }
+
+  virtual void
+  doSendNack(const lp::Nack& nack) DECL_OVERRIDE
+  {
+    BOOST_ASSERT(false);
+  }
+
+  virtual void
+  doReceivePacket(Transport::Packet&& packet) DECL_OVERRIDE
+  {
+    ++nReceived;
+    // a packet copied out of the receive buffer has a buffer of its own
+    if (packet.packet.getBuffer()->size() != packet.packet.size()) {
+      ++nInPlace;
+    }
+  }
+
+public:
+  size_t nReceived;
+  size_t nInPlace;
+};
+
+/** \brief DatagramTransport on a connected UDP socket, without network interface tracking
+ */
+class LoopbackUdpTransport : public DatagramTransport<ip::udp, Unicast>
+{
+public:
+  LoopbackUdpTransport(protocol::socket&& socket, size_t batchSize)
+    : DatagramTransport(std::move(socket), batchSize)
+  {
+    this->setLocalUri(FaceUri(m_socket.local_endpoint()));
+    this->setRemoteUri(FaceUri(m_socket.remote_endpoint()));
+    this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+    this->setPersistency(ndn::nfd::FACE_PERSISTENCY_PERMANENT);
+    this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+    this->setMtu(MTU_UNLIMITED);
+  }
+
+protected:
+  virtual void
+  beforeChangePersistency(ndn::nfd::FacePersistency newPersistency) DECL_FINAL
+  {
+  }
+};
+
+class ReceivePathBenchmarkFixture : public BaseFixture
+{
+protected:
+  ReceivePathBenchmarkFixture()
+    : m_data(makeData("/receive-path-benchmark/data"))
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    m_data->setContent(std::vector<uint8_t>(1000, 0xBB).data(), 1000);
+    m_wire = m_data->wireEncode();
+  }
+
+  /** \brief writes N_PACKETS Data to \p sender in bursts of BURST_SIZE,
+   *         and waits for \p service to receive each burst
+   */
+  template<typename Socket>
+  void
+  run(const std::string& label, Socket& sender, const CountingLinkService& service)
+  {
+    size_t nAllocations = g_nAllocations;
+    size_t nAllocatedBytes = g_nAllocatedBytes;
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    for (size_t nSent = 0; nSent < N_PACKETS; nSent += BURST_SIZE) {
+      for (size_t i = 0; i < BURST_SIZE; ++i) {
+        boost::asio::write(sender, boost::asio::buffer(m_wire.wire(), m_wire.size()));
+      }
+
+      std::chrono::steady_clock::time_point lastReceive = std::chrono::steady_clock::now();
+      while (service.nReceived < nSent + BURST_SIZE &&
+             std::chrono::steady_clock::now() - lastReceive < std::chrono::milliseconds(100)) {
+        size_t nReceived = service.nReceived;
+        g_io.poll();
+        if (service.nReceived > nReceived) {
+          lastReceive = std::chrono::steady_clock::now();
+        }
+      }
+    }
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - t1);
+    size_t nReceived = std::max<size_t>(service.nReceived, 1);
+    BOOST_TEST_MESSAGE(label << ": received=" << service.nReceived <<
+                       " in-place=" << service.nInPlace <<
+                       " allocations/packet=" << (g_nAllocations - nAllocations) / nReceived <<
+                       " allocatedBytes/packet=" <<
+                       (g_nAllocatedBytes - nAllocatedBytes) / nReceived <<
+                       " time=" << d.count() << "us");
+    BOOST_CHECK_GT(service.nReceived, 0);
+  }
+
+  void
+  runUdp(size_t batchSize)
+  {
+    ip::udp::socket senderSocket(g_io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    ip::udp::socket receiverSocket(g_io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    senderSocket.connect(receiverSocket.local_endpoint());
+    receiverSocket.connect(senderSocket.local_endpoint());
+
+    auto service = make_unique<CountingLinkService>();
+    const CountingLinkService& serviceRef = *service;
+    Face face(std::move(service),
+              make_unique<LoopbackUdpTransport>(std::move(receiverSocket), batchSize));
+
+    this->run("UDP batchSize=" + to_string(batchSize), senderSocket, serviceRef);
+  }
+
+protected:
+  static const size_t N_PACKETS = 100000;
+  static const size_t BURST_SIZE = 32;
+
+  shared_ptr<Data> m_data;
+  Block m_wire;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FaceReceivePathBenchmark, ReceivePathBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(UdpUnbatched)
+{
+  this->runUdp(1);
+}
+
+BOOST_AUTO_TEST_CASE(UdpBatch32)
+{
+  this->runUdp(32);
+}
+
+BOOST_AUTO_TEST_CASE(Tcp)
+{
+  ip::tcp::acceptor acceptor(g_io, ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ip::tcp::socket senderSocket(g_io);
+  senderSocket.connect(acceptor.local_endpoint());
+  ip::tcp::socket receiverSocket(g_io);
+  acceptor.accept(receiverSocket);
+
+  auto service = make_unique<CountingLinkService>();
+  const CountingLinkService& serviceRef = *service;
+  Face face(std::move(service),
+            make_unique<TcpTransport>(std::move(receiverSocket),
+                                      ndn::nfd::FACE_PERSISTENCY_PERSISTENT));
+
+  this->run("TCP", senderSocket, serviceRef);
+}
+
+/** \brief parses a stream of packets arriving in 4096-octet segments,
+ *         with Block::fromBuffer as StreamTransport used to, and with ReceiveBufferPool
+ */
+BOOST_AUTO_TEST_CASE(StreamParse)
+{
+  const size_t segmentSize = 4096;
+  std::vector<uint8_t> stream;
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    stream.insert(stream.end(), m_wire.begin(), m_wire.end());
+  }
+
+  // copying: parse into a new Block, move leftover octets to the front of the buffer
+  {
+    size_t nAllocations = g_nAllocations;
+    size_t nCopiedBytes = 0;
+    size_t nPackets = 0;
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    std::vector<uint8_t> buffer(ndn::MAX_NDN_PACKET_SIZE);
+    size_t bufferSize = 0;
+    for (size_t pos = 0; pos < stream.size();) {
+      size_t nBytes = std::min(std::min(segmentSize, stream.size() - pos),
+                               buffer.size() - bufferSize);
+      std::memcpy(buffer.data() + bufferSize, stream.data() + pos, nBytes);
+      pos += nBytes;
+      bufferSize += nBytes;
+
+      size_t offset = 0;
+      bool isOk = true;
+      Block element;
+      while (offset < bufferSize) {
+        std::tie(isOk, element) = Block::fromBuffer(buffer.data() + offset, bufferSize - offset);
+        if (!isOk)
+          break;
+        offset += element.size();
+        nCopiedBytes += element.size();
+        ++nPackets;
+      }
+      std::copy(buffer.begin() + offset, buffer.begin() + bufferSize, buffer.begin());
+      nCopiedBytes += bufferSize - offset;
+      bufferSize -= offset;
+    }
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - t1);
+    BOOST_TEST_MESSAGE("Block::fromBuffer: packets=" << nPackets <<
+                       " allocations=" << g_nAllocations - nAllocations <<
+                       " copiedBytes=" << nCopiedBytes <<
+                       " time=" << d.count() << "us");
+    BOOST_CHECK_EQUAL(nPackets, N_PACKETS);
+  }
+
+  // in place: parse Blocks referencing the slab
+  {
+    size_t nAllocations = g_nAllocations;
+    size_t nPackets = 0;
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    ReceiveBufferPool pool;
+    for (size_t pos = 0; pos < stream.size();) {
+      pool.prepare();
+      size_t nBytes = std::min(std::min(segmentSize, stream.size() - pos),
+                               pool.getWritableSize());
+      std::memcpy(pool.getWritePosition(), stream.data() + pos, nBytes); // as done by the kernel
+      pos += nBytes;
+      pool.commit(nBytes);
+
+      while (std::get<0>(pool.extractBlock())) {
+        ++nPackets;
+      }
+    }
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - t1);
+    BOOST_TEST_MESSAGE("ReceiveBufferPool: packets=" << nPackets <<
+                       " allocations=" << g_nAllocations - nAllocations <<
+                       " copiedBytes=" << pool.getNCopiedBytes() <<
+                       " slabs=" << pool.getNAllocatedSlabs() <<
+                       " time=" << d.count() << "us");
+    BOOST_CHECK_EQUAL(nPackets, N_PACKETS);
+  }
+}
+
+/** \brief retains one in every 32 Data received through ReceiveBufferPool,
+ *         as the received packet and in the ContentStore, and reports the memory they pin
+ */
+BOOST_AUTO_TEST_CASE(RetainData)
+{
+  const size_t nPackets = 10000;
+  const size_t retainInterval = 32;
+  const size_t segmentSize = 4096;
+  std::vector<uint8_t> stream;
+  for (size_t i = 0; i < nPackets; ++i) {
+    auto data = make_shared<Data>(Name("/receive-path-benchmark/retain").appendSegment(i));
+    data->setContent(std::vector<uint8_t>(1000, 0xBB).data(), 1000);
+    const Block& wire = signData(data)->wireEncode();
+    stream.insert(stream.end(), wire.begin(), wire.end());
+  }
+
+  // receives the stream, and passes every retainInterval-th Data to retain
+  auto receive = [&] (const function<void(const shared_ptr<Data>&)>& retain) {
+    ReceiveBufferPool pool;
+    size_t nReceived = 0;
+    for (size_t pos = 0; pos < stream.size();) {
+      pool.prepare();
+      size_t nBytes = std::min(std::min(segmentSize, stream.size() - pos),
+                               pool.getWritableSize());
+      std::memcpy(pool.getWritePosition(), stream.data() + pos, nBytes);
+      pos += nBytes;
+      pool.commit(nBytes);
+
+      for (;;) {
+        bool isOk = false;
+        Block block;
+        std::tie(isOk, block) = pool.extractBlock();
+        if (!isOk) {
+          break;
+        }
+        if (++nReceived % retainInterval == 0) {
+          retain(make_shared<Data>(block));
+        }
+      }
+    }
+    return pool.getNAllocatedSlabs();
+  };
+
+  // octets of all distinct buffers that hold the wire encoding of retained Data
+  auto countPinnedBytes = [] (const std::vector<shared_ptr<const Data>>& retained) {
+    std::set<const ndn::Buffer*> buffers;
+    size_t nBytes = 0;
+    for (const shared_ptr<const Data>& data : retained) {
+      const ndn::Buffer* buffer = data->wireEncode().getBuffer().get();
+      if (buffers.insert(buffer).second) {
+        nBytes += buffer->size();
+      }
+    }
+    return nBytes;
+  };
+
+  // the received Data keeps its slab alive
+  std::vector<shared_ptr<const Data>> received;
+  uint64_t nSlabs = receive([&] (const shared_ptr<Data>& data) { received.push_back(data); });
+  size_t nReceivedPinned = countPinnedBytes(received);
+  BOOST_TEST_MESSAGE("retain received Data: retained=" << received.size() <<
+                     " slabs=" << nSlabs <<
+                     " pinnedBytes/Data=" << nReceivedPinned / received.size());
+
+  // the ContentStore copies the Data out of the slab
+  Cs cs(nPackets);
+  size_t nAllocations = g_nAllocations;
+  std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+  nSlabs = receive([&] (const shared_ptr<Data>& data) { cs.insert(*data); });
+  auto d = std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - t1);
+  std::vector<shared_ptr<const Data>> cached;
+  for (const cs::Entry& entry : cs) {
+    cached.push_back(entry.getData().shared_from_this());
+  }
+  size_t nCachedPinned = countPinnedBytes(cached);
+  BOOST_TEST_MESSAGE("retain in ContentStore: retained=" << cached.size() <<
+                     " slabs=" << nSlabs <<
+                     " pinnedBytes/Data=" << nCachedPinned / cached.size() <<
+                     " allocations=" << g_nAllocations - nAllocations <<
+                     " time=" << d.count() << "us");
+
+  BOOST_REQUIRE_EQUAL(cached.size(), nPackets / retainInterval);
+  BOOST_CHECK_LT(nCachedPinned, nReceivedPinned);
+  BOOST_CHECK_LE(nCachedPinned, cached.size() * stream.size() / nPackets);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
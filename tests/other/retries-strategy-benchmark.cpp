@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/retries-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include <chrono>
+
+namespace nfd {
+namespace tests {
+
+/** \brief RetriesStrategy that exposes insertPendingInterest
+ */
+class RetriesBenchmarkStrategy : public fw::RetriesStrategy
+{
+public:
+  explicit
+  RetriesBenchmarkStrategy(Forwarder& forwarder)
+    : RetriesStrategy(forwarder, STRATEGY_NAME)
+  {
+  }
+
+  virtual void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       shared_ptr<fib::Entry> fibEntry,
+                       shared_ptr<pit::Entry> pitEntry) DECL_OVERRIDE
+  {
+  }
+
+  using RetriesStrategy::insertPendingInterest;
+
+public:
+  // RetriesStrategy keeps a reference to its name
+  static const Name STRATEGY_NAME;
+};
+
+const Name RetriesBenchmarkStrategy::STRATEGY_NAME("ndn:/retries-benchmark-strategy");
+
+class RetriesStrategyBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  RetriesStrategyBenchmarkFixture()
+    : strategy(forwarder)
+    , downstream(make_shared<DummyFace>())
+    , upstream(make_shared<DummyFace>())
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream);
+    fibEntry = forwarder.getFib().insert("/").first;
+    fibEntry->addNextHop(upstream, 0);
+  }
+
+  /** \brief measures wall clock time, which is not affected by the mock clocks
+   */
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    f();
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+    return time::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+  }
+
+protected:
+  Forwarder forwarder;
+  RetriesBenchmarkStrategy strategy;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream;
+  shared_ptr<fib::Entry> fibEntry;
+
+  static const size_t N_INTERESTS = 10000;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FwRetriesStrategyBenchmark, RetriesStrategyBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(OutstandingInterests)
+{
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  std::vector<shared_ptr<Data>> dataPackets;
+  interests.reserve(N_INTERESTS);
+  pitEntries.reserve(N_INTERESTS);
+  dataPackets.reserve(N_INTERESTS);
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    Name name("/retries");
+    name.appendNumber(i);
+    interests.push_back(makeInterest(name));
+    interests.back()->setInterestLifetime(time::seconds(60));
+    pitEntries.push_back(forwarder.getPit().insert(*interests.back()).first);
+    pitEntries.back()->insertOrUpdateInRecord(downstream, *interests.back());
+    dataPackets.push_back(makeData(name));
+  }
+
+  time::microseconds d = timedRun([&] {
+    for (size_t i = 0; i < N_INTERESTS; ++i) {
+      strategy.insertPendingInterest(*interests[i], upstream, fibEntry, pitEntries[i]);
+    }
+  });
+  BOOST_TEST_MESSAGE("insert " << N_INTERESTS << ": " << d);
+  BOOST_CHECK_EQUAL(upstream->sentInterests.size(), N_INTERESTS);
+
+  // retransmissions from downstream find the existing pending Interest
+  d = timedRun([&] {
+    for (size_t i = 0; i < N_INTERESTS; ++i) {
+      strategy.insertPendingInterest(*interests[i], nullptr, fibEntry, pitEntries[i]);
+    }
+  });
+  BOOST_TEST_MESSAGE("update " << N_INTERESTS << ": " << d);
+
+  // Data arrives in reverse order, which is the worst case for a linear search
+  d = timedRun([&] {
+    for (size_t i = N_INTERESTS; i > 0; --i) {
+      strategy.beforeSatisfyInterest(pitEntries[i - 1], *upstream, *dataPackets[i - 1]);
+    }
+  });
+  BOOST_TEST_MESSAGE("satisfy " << N_INTERESTS << ": " << d);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/forwarder.hpp"
+#include "fw/best-route-strategy2.hpp"
+#include "fw/multicast-strategy.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class StrategyChoiceBenchmarkFixture : public BaseFixture
+{
+protected:
+  StrategyChoiceBenchmarkFixture()
+    : strategyChoice(forwarder.getStrategyChoice())
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief inserts N_CHOICES StrategyChoice entries at depth 2 and 3,
+   *         and N_PIT_ENTRIES PIT entries at depth 8
+   */
+  void
+  makeWorkload()
+  {
+    for (size_t i = 0; i < N_CHOICES; ++i) {
+      Name prefix("/sc");
+      prefix.appendNumber(i % 64);
+      if (i >= 64) {
+        prefix.appendNumber(i);
+      }
+      strategyChoice.insert(prefix, i % 2 == 0 ? fw::BestRouteStrategy2::STRATEGY_NAME :
+                                                 fw::MulticastStrategy::STRATEGY_NAME);
+    }
+
+    Pit& pit = forwarder.getPit();
+    for (size_t i = 0; i < N_PIT_ENTRIES; ++i) {
+      Name name("/sc");
+      name.appendNumber(i % 64).appendNumber(i % N_CHOICES)
+          .append("app").append("video").append("frame").appendNumber(i).appendSegment(i % 8);
+      pitEntries.push_back(pit.insert(*makeInterest(name)).first);
+    }
+  }
+
+  /** \brief finds effective strategy of every PIT entry, REPEAT times
+   */
+  void
+  run(const std::string& label, size_t repeat)
+  {
+    size_t nBestRoute = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t j = 0; j < repeat; ++j) {
+        for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+          fw::Strategy& strategy = strategyChoice.findEffectiveStrategy(*pitEntry);
+          nBestRoute += &strategy == bestRoute;
+        }
+      }
+    });
+    BOOST_TEST_MESSAGE(label << " findEffectiveStrategy " << (N_PIT_ENTRIES * repeat) << ": " <<
+                       d << ", best-route " << nBestRoute);
+  }
+
+protected:
+  Forwarder forwarder;
+  StrategyChoice& strategyChoice;
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  const fw::Strategy* bestRoute = nullptr;
+
+  static const size_t N_CHOICES = 1000;
+  static const size_t N_PIT_ENTRIES = 100000;
+  static const size_t REPEAT = 10;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableStrategyChoiceBenchmark, StrategyChoiceBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategy)
+{
+  this->makeWorkload();
+  bestRoute = &strategyChoice.findEffectiveStrategy("/sc/0");
+
+  this->run("cold", 1);
+  this->run("cached", REPEAT);
+
+  // any StrategyChoice change invalidates every cached strategy
+  strategyChoice.insert("/sc/0/0", fw::MulticastStrategy::STRATEGY_NAME);
+  this->run("after-insert", 1);
+  this->run("cached", REPEAT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "face/datagram-transport.hpp"
+#include "face/face.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-receive-link-service.hpp"
+
+#include <chrono>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+namespace ip = boost::asio::ip;
+
+/** \brief DatagramTransport on a connected UDP socket, without network interface tracking
+ */
+class LoopbackUdpTransport : public DatagramTransport<ip::udp, Unicast>
+{
+public:
+  LoopbackUdpTransport(protocol::socket&& socket, size_t batchSize)
+    : DatagramTransport(std::move(socket), batchSize)
+  {
+    this->setLocalUri(FaceUri(m_socket.local_endpoint()));
+    this->setRemoteUri(FaceUri(m_socket.remote_endpoint()));
+    this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+    this->setPersistency(ndn::nfd::FACE_PERSISTENCY_PERMANENT);
+    this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+    this->setMtu(MTU_UNLIMITED);
+  }
+
+protected:
+  virtual void
+  beforeChangePersistency(ndn::nfd::FacePersistency newPersistency) DECL_FINAL
+  {
+  }
+};
+
+class UdpTransportBenchmarkFixture : public BaseFixture
+{
+protected:
+  UdpTransportBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  /** \brief sends N_PACKETS from one face to another over loopback
+   *
+   *  Packets are sent in bursts of BURST_SIZE per turn of the event loop,
+   *  so that batched send can coalesce each burst.
+   */
+  void
+  run(size_t batchSize)
+  {
+    ip::udp::socket senderSocket(g_io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    ip::udp::socket receiverSocket(g_io, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+    receiverSocket.set_option(ip::udp::socket::receive_buffer_size(4 * 1024 * 1024));
+    senderSocket.connect(receiverSocket.local_endpoint());
+    receiverSocket.connect(senderSocket.local_endpoint());
+
+    auto senderTransport = make_unique<LoopbackUdpTransport>(std::move(senderSocket), batchSize);
+    LoopbackUdpTransport* sender = senderTransport.get();
+    Face senderFace(make_unique<DummyReceiveLinkService>(), std::move(senderTransport));
+
+    auto receiverService = make_unique<DummyReceiveLinkService>();
+    std::vector<Transport::Packet>& receivedPackets = receiverService->receivedPackets;
+    receivedPackets.reserve(N_PACKETS);
+    Face receiverFace(std::move(receiverService),
+                      make_unique<LoopbackUdpTransport>(std::move(receiverSocket), batchSize));
+
+    Block packet = makeInterest("/udp-transport-benchmark/packet")->wireEncode();
+    size_t nSent = 0;
+    std::function<void()> sendBurst = [&] {
+      for (size_t i = 0; i < BURST_SIZE && nSent < N_PACKETS; ++i, ++nSent) {
+        sender->send(Transport::Packet(Block(packet)));
+      }
+      if (nSent < N_PACKETS) {
+        g_io.post(sendBurst);
+      }
+    };
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastReceive = t1;
+    g_io.post(sendBurst);
+    while (receivedPackets.size() < N_PACKETS &&
+           std::chrono::steady_clock::now() - lastReceive < std::chrono::milliseconds(200)) {
+      size_t nReceived = receivedPackets.size();
+      g_io.run_one();
+      if (receivedPackets.size() > nReceived) {
+        lastReceive = std::chrono::steady_clock::now();
+      }
+    }
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(lastReceive - t1);
+    BOOST_TEST_MESSAGE("batchSize=" << sender->getBatchSize() <<
+                       " sent=" << nSent << " received=" << receivedPackets.size() <<
+                       " time=" << d.count() << "us" <<
+                       " rate=" << receivedPackets.size() * 1000000 / std::max<int64_t>(d.count(), 1) <<
+                       "pps");
+    BOOST_CHECK_GT(receivedPackets.size(), 0);
+  }
+
+protected:
+  static const size_t N_PACKETS = 200000;
+  static const size_t BURST_SIZE = 64;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FaceUdpTransportBenchmark, UdpTransportBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(Unbatched)
+{
+  this->run(1);
+}
+
+BOOST_AUTO_TEST_CASE(Batch8)
+{
+  this->run(8);
+}
+
+BOOST_AUTO_TEST_CASE(Batch32)
+{
+  this->run(32);
+}
+
+BOOST_AUTO_TEST_CASE(Batch64)
+{
+  this->run(64);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,208 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "rib/fib-updater.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/identity-management-fixture.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace nfd {
+namespace rib {
+namespace tests {
+
+using namespace nfd::tests;
+using ndn::nfd::ControlParameters;
+using ndn::nfd::ControlResponse;
+
+class FibUpdaterBatchFixture : public IdentityManagementFixture
+                             , public UnitTestTimeFixture
+{
+public:
+  FibUpdaterBatchFixture()
+    : face(ndn::util::makeDummyClientFace(g_io, {true, true}))
+    , controller(*face, m_keyChain)
+    , fibUpdater(rib, controller, *face, m_keyChain)
+    , nSuccesses(0)
+    , nFailures(0)
+  {
+    fibUpdater.m_batchFaceId = 1;
+  }
+
+  void
+  addUpdates(uint64_t faceId, size_t nUpdates, size_t componentLength = 8)
+  {
+    FibUpdater::FibUpdateList& updates = (faceId == fibUpdater.m_batchFaceId) ?
+                                         fibUpdater.m_updatesForBatchFaceId :
+                                         fibUpdater.m_updatesForNonBatchFaceId;
+    for (size_t i = 0; i < nUpdates; ++i) {
+      Name name("/batch");
+      name.append(std::string(componentLength, 'x')).appendNumber(faceId).appendNumber(i);
+      updates.push_back(FibUpdate::createAddUpdate(name, faceId, 10));
+    }
+  }
+
+  void
+  send()
+  {
+    fibUpdater.sendUpdatesForBatchFaceId(
+      [this] (RibUpdateList) { ++nSuccesses; },
+      [this] (uint32_t code, const std::string&) {
+        ++nFailures;
+        failureCode = code;
+      });
+    advanceClocks(time::milliseconds(1));
+  }
+
+  /** \return FibBatchUpdate carried by the last command sent to NFD
+   */
+  FibBatchUpdate
+  getLastBatch()
+  {
+    BOOST_REQUIRE(!face->sentInterests.empty());
+    const Name& name = face->sentInterests.back().getName();
+    BOOST_REQUIRE(FibUpdater::BATCH_UPDATE_COMMAND_PREFIX.isPrefixOf(name));
+    return FibBatchUpdate(name.at(FibUpdater::BATCH_UPDATE_COMMAND_PREFIX.size()).blockFromValue());
+  }
+
+  void
+  respond(const ControlResponse& response)
+  {
+    BOOST_REQUIRE(!face->sentInterests.empty());
+    shared_ptr<Data> data = makeData(face->sentInterests.back().getName());
+    data->setContent(response.wireEncode());
+    face->receive(*data);
+    advanceClocks(time::milliseconds(1));
+  }
+
+public:
+  shared_ptr<ndn::util::DummyClientFace> face;
+  ndn::nfd::Controller controller;
+  Rib rib;
+  FibUpdater fibUpdater;
+
+  int nSuccesses;
+  int nFailures;
+  uint32_t failureCode;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdaterBatch, FibUpdaterBatchFixture)
+
+BOOST_AUTO_TEST_CASE(SingleUpdate)
+{
+  addUpdates(1, 1);
+  send();
+
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 1);
+  BOOST_CHECK(Name("/localhost/nfd/fib/add-nexthop").isPrefixOf(face->sentInterests[0].getName()));
+}
+
+BOOST_AUTO_TEST_CASE(Segmented)
+{
+  addUpdates(1, 200, 200);
+  addUpdates(2, 2);
+  send();
+
+  size_t nBatchFaceUpdates = 0;
+  size_t nCommands = 0;
+  while (!fibUpdater.m_updatesForBatchFaceId.empty() && nCommands < 200) {
+    BOOST_REQUIRE_EQUAL(face->sentInterests.size(), nCommands + 1);
+    FibBatchUpdate batch = getLastBatch();
+    BOOST_CHECK_LE(batch.wireEncode().value_size(), FibUpdater::MAX_BATCH_UPDATE_SIZE);
+    BOOST_CHECK_EQUAL(batch.getEntries().front().faceId, 1);
+
+    nBatchFaceUpdates += batch.size();
+    ++nCommands;
+    respond(ControlResponse(200, "Success").setBody(batch.wireEncode()));
+  }
+  BOOST_CHECK_EQUAL(nBatchFaceUpdates, 200);
+  BOOST_CHECK_GT(nCommands, 1);
+  BOOST_CHECK_EQUAL(nSuccesses, 0);
+
+  // updates for other faces follow
+  FibBatchUpdate batch = getLastBatch();
+  BOOST_CHECK_EQUAL(batch.size(), 2);
+  respond(ControlResponse(200, "Success").setBody(batch.wireEncode()));
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK_EQUAL(nFailures, 0);
+  BOOST_CHECK(fibUpdater.m_updatesForNonBatchFaceId.empty());
+}
+
+BOOST_AUTO_TEST_CASE(NonBatchFaceNotFound)
+{
+  addUpdates(2, 2);
+  addUpdates(3, 2);
+  send();
+
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(getLastBatch().size(), 4);
+  respond(ControlResponse(410, "Face not found").setBody(ControlParameters().setFaceId(2).wireEncode()));
+
+  // nothing was applied, so the updates for face 3 are sent again
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 2);
+  FibBatchUpdate batch = getLastBatch();
+  BOOST_REQUIRE_EQUAL(batch.size(), 2);
+  BOOST_CHECK_EQUAL(batch.getEntries()[0].faceId, 3);
+  BOOST_CHECK_EQUAL(batch.getEntries()[1].faceId, 3);
+
+  respond(ControlResponse(200, "Success").setBody(batch.wireEncode()));
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK_EQUAL(nFailures, 0);
+}
+
+BOOST_AUTO_TEST_CASE(BatchFaceNotFound)
+{
+  addUpdates(1, 2);
+  addUpdates(2, 2);
+  send();
+
+  respond(ControlResponse(410, "Face not found").setBody(ControlParameters().setFaceId(1).wireEncode()));
+  BOOST_CHECK_EQUAL(face->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(nSuccesses, 0);
+  BOOST_CHECK_EQUAL(nFailures, 1);
+  BOOST_CHECK_EQUAL(failureCode, 410);
+}
+
+BOOST_AUTO_TEST_CASE(Timeout)
+{
+  addUpdates(1, 3);
+  send();
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 1);
+
+  advanceClocks(time::milliseconds(100), time::seconds(5));
+  BOOST_REQUIRE_EQUAL(face->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(getLastBatch().size(), 3);
+
+  respond(ControlResponse(200, "Success").setBody(getLastBatch().wireEncode()));
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdaterBatch
+
+} // namespace tests
+} // namespace rib
+} // namespace nfd
@@ -61,7 +61,7 @@ public:
   FibUpdatesFixture()
     : face(ndn::util::makeDummyClientFace())
     , controller(*face, keyChain)
-    , fibUpdater(rib, controller)
+    , fibUpdater(rib, controller, *face, keyChain)
   {
   }
 